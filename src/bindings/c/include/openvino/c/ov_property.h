@@ -106,6 +106,15 @@ ov_property_key_cache_dir;
 OPENVINO_C_VAR(const char*)
 ov_property_key_cache_mode;
 
+/**
+ * @brief Read-write property<string> to set the path to the weights file of the compiled model,
+ * which allows the device to refer to the weights file instead of storing the weights in the cache
+ * with optimize_size cache mode.
+ * @ingroup ov_property_c_api
+ */
+OPENVINO_C_VAR(const char*)
+ov_property_key_weights_path;
+
 /**
  * @brief Read-write property<uint32_t string> to set/get the number of executor logical partitions.
  * @ingroup ov_property_c_api
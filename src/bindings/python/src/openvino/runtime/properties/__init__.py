@@ -10,6 +10,7 @@ from openvino._pyopenvino.properties import CacheMode
 from openvino._pyopenvino.properties import enable_profiling
 from openvino._pyopenvino.properties import cache_dir
 from openvino._pyopenvino.properties import cache_mode
+from openvino._pyopenvino.properties import weights_path
 from openvino._pyopenvino.properties import auto_batch_timeout
 from openvino._pyopenvino.properties import num_streams
 from openvino._pyopenvino.properties import inference_num_threads
@@ -29,6 +29,7 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_properties, ov::enable_profiling, "enable_profiling");
     wrap_property_RW(m_properties, ov::cache_dir, "cache_dir");
     wrap_property_RW(m_properties, ov::cache_mode, "cache_mode");
+    wrap_property_RW(m_properties, ov::weights_path, "weights_path");
     wrap_property_RW(m_properties, ov::auto_batch_timeout, "auto_batch_timeout");
     wrap_property_RW(m_properties, ov::num_streams, "num_streams");
     wrap_property_RW(m_properties, ov::inference_num_threads, "inference_num_threads");
@@ -103,6 +104,21 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_intel_cpu,
                      ov::intel_cpu::sparse_weights_decompression_rate,
                      "sparse_weights_decompression_rate");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::kv_cache_page_size, "kv_cache_page_size");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::kv_cache_group_size, "kv_cache_group_size");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::dataflow_execution, "dataflow_execution");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::execution_plan_replay, "execution_plan_replay");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::activation_memory_budget, "activation_memory_budget");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::shared_scratchpad, "shared_scratchpad");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::cross_model_weights_sharing, "cross_model_weights_sharing");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::snippets_autotuning, "snippets_autotuning");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::shape_warm_up, "shape_warm_up");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::kv_cache_pool_used_size, "kv_cache_pool_used_size");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::kv_cache_pool_allocated_size, "kv_cache_pool_allocated_size");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::peak_activation_memory_size, "peak_activation_memory_size");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::scratchpad_pool_size, "scratchpad_pool_size");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::shared_weights_size, "shared_weights_size");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::primitive_cache_statistics, "primitive_cache_statistics");
 
     // Submodule intel_gpu
     py::module m_intel_gpu =
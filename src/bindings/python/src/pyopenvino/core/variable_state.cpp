@@ -41,4 +41,19 @@ void regclass_VariableState(py::module m) {
                              R"(
         Gets/sets variable state.
     )");
+
+    variable_st.def("fork",
+                    &ov::VariableState::fork,
+                    py::arg("source"),
+                    py::arg("length"),
+                    R"(
+        Sets the state to the first `length` elements of another variable state along the sequence axis.
+        The plugin may share the common part with the source state instead of copying it.
+
+        :param source: The variable state with the same name of another infer request
+                       created from the same compiled model.
+        :type source: openvino.runtime.VariableState
+        :param length: The number of elements (tokens) along the sequence axis to take from the source state.
+        :type length: int
+    )");
 }
@@ -192,6 +192,12 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (intel_gpu.uarch_version, "GPU_UARCH_VERSION"),
         (intel_gpu.execution_units_count, "GPU_EXECUTION_UNITS_COUNT"),
         (intel_gpu.memory_statistics, "GPU_MEMORY_STATISTICS"),
+        (intel_cpu.kv_cache_pool_used_size, "CPU_KV_CACHE_POOL_USED_SIZE"),
+        (intel_cpu.kv_cache_pool_allocated_size, "CPU_KV_CACHE_POOL_ALLOCATED_SIZE"),
+        (intel_cpu.peak_activation_memory_size, "CPU_PEAK_ACTIVATION_MEMORY_SIZE"),
+        (intel_cpu.scratchpad_pool_size, "CPU_SCRATCHPAD_POOL_SIZE"),
+        (intel_cpu.shared_weights_size, "CPU_SHARED_WEIGHTS_SIZE"),
+        (intel_cpu.primitive_cache_statistics, "CPU_PRIMITIVE_CACHE_STATISTICS"),
     ],
 )
 def test_properties_ro(ov_property_ro, expected_value):
@@ -229,6 +235,11 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (props.CacheMode.OPTIMIZE_SPEED, props.CacheMode.OPTIMIZE_SPEED),
             ),
         ),
+        (
+            props.weights_path,
+            "WEIGHTS_PATH",
+            (("./model.bin", "./model.bin"),),
+        ),
         (
             props.auto_batch_timeout,
             "AUTO_BATCH_TIMEOUT",
@@ -336,6 +347,69 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (2.0, 2.0),
             ),
         ),
+        (
+            intel_cpu.kv_cache_page_size,
+            "CPU_KV_CACHE_PAGE_SIZE",
+            ((32, 32),),
+        ),
+        (
+            intel_cpu.kv_cache_group_size,
+            "CPU_KV_CACHE_GROUP_SIZE",
+            ((32, 32),),
+        ),
+        (
+            intel_cpu.dataflow_execution,
+            "CPU_DATAFLOW_EXECUTION",
+            (
+                (True, True),
+                (False, False),
+            ),
+        ),
+        (
+            intel_cpu.execution_plan_replay,
+            "CPU_EXECUTION_PLAN_REPLAY",
+            (
+                (True, True),
+                (False, False),
+            ),
+        ),
+        (
+            intel_cpu.activation_memory_budget,
+            "CPU_ACTIVATION_MEMORY_BUDGET",
+            ((1048576, 1048576),),
+        ),
+        (
+            intel_cpu.shared_scratchpad,
+            "CPU_SHARED_SCRATCHPAD",
+            (
+                (True, True),
+                (False, False),
+            ),
+        ),
+        (
+            intel_cpu.cross_model_weights_sharing,
+            "CPU_CROSS_MODEL_WEIGHTS_SHARING",
+            (
+                (True, True),
+                (False, False),
+            ),
+        ),
+        (
+            intel_cpu.snippets_autotuning,
+            "CPU_SNIPPETS_AUTOTUNING",
+            (
+                (True, True),
+                (False, False),
+            ),
+        ),
+        (
+            intel_cpu.shape_warm_up,
+            "CPU_SHAPE_WARM_UP",
+            (
+                (True, True),
+                (False, False),
+            ),
+        ),
         (
             intel_auto.device_bind_buffer,
             "DEVICE_BIND_BUFFER",
@@ -448,6 +448,24 @@ def test_query_state_write_buffer(device, input_shape, data_type, mode):
         assert np.allclose(res[list(res)[0]], expected_res, atol=1e-6), f"Expected values: {expected_res} \n Actual values: {res} \n"
 
 
+@pytest.mark.skipif(
+    os.environ.get("TEST_DEVICE", "CPU") != "CPU",
+    reason=f"Can't run test on device {os.environ.get('TEST_DEVICE', 'CPU')}, "
+    "fork of the variable states is implemented only on CPU",
+)
+def test_query_state_fork(device):
+    core = Core()
+    model = generate_model_with_memory([10], np.float32)
+    compiled_model = core.compile_model(model=model, device_name=device)
+    source = compiled_model.create_infer_request()
+    target = compiled_model.create_infer_request()
+    source.infer({0: np.ones([10], dtype=np.float32)})
+
+    # only the KV cache states of the attention layers can be forked, the other states refuse it
+    with pytest.raises(RuntimeError, match="does not support fork"):
+        target.query_state()[0].fork(source.query_state()[0], 1)
+
+
 @pytest.mark.parametrize("share_inputs", [True, False])
 def test_get_results(device, share_inputs):
     core = Core()
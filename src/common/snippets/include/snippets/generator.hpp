@@ -25,6 +25,8 @@ class Generator;
  * @param compiled_snippet pointer to interface class that encapsulates compiled binary code
  * @param buffer_scratchpad_size the amount of additional memory required by the binary code to execute.
  * Must be allocated and freed by the backend.
+ * @param linear_ir the lowered LinearIR of the shape-agnostic kernel. It's used to update the runtime parameters
+ * of the kernel for the new input shapes. Nullptr if the kernel is generated for the static shapes.
  */
 class LoweringResult {
     friend class Generator;
@@ -35,6 +37,7 @@ class LoweringResult {
 public:
     std::shared_ptr<CompiledSnippet> compiled_snippet = nullptr;
     size_t buffer_scratchpad_size = 0;
+    std::shared_ptr<lowered::LinearIR> linear_ir = nullptr;
 };
 
 /**
@@ -68,6 +68,13 @@ public:
      * @return m_handlers
      */
     const SpecificIterationHandlers& get_handlers() const;
+    /**
+     * @brief Returns increment of the main body Loop if this Loop processes the tail of the dynamic Loop.
+     *        The work amount of such Loop is the remainder of the main body work amount divided by this increment
+     *        and can be known only at runtime. Returns 0 for all other Loops.
+     * @return m_main_body_increment
+     */
+    size_t get_main_body_increment() const;
 
     /**
      * @brief Sets `dim_idx` to all entry and exit points
@@ -99,6 +106,11 @@ public:
      * @param handlers - transformations for loop specific iterations
      */
     void set_handlers(SpecificIterationHandlers handlers);
+    /**
+     * @brief Set m_main_body_increment value
+     * @param increment - increment of the main body Loop which tail is processed by this Loop
+     */
+    void set_main_body_increment(size_t increment);
 
     /**
      * @brief Register loop specific iteration handler
@@ -132,6 +144,7 @@ private:
     std::vector<LoopPort> m_entry_points = {};
     std::vector<LoopPort> m_exit_points = {};
     SpecificIterationHandlers m_handlers = {};
+    size_t m_main_body_increment = 0;
 };
 using LoopInfoPtr = std::shared_ptr<LoopInfo>;
 
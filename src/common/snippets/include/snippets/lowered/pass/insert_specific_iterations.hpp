@@ -6,6 +6,8 @@
 
 #include "pass.hpp"
 
+#include "snippets/op/loop.hpp"
+
 namespace ov {
 namespace snippets {
 namespace lowered {
@@ -15,6 +17,8 @@ namespace pass {
  * @interface InsertSpecificIterations
  * @brief Inserts separate loop bodies for first/last iterations if needed.
  * Also calls previously registered SpecificIterationHandlers for the inserted bodies and the main body.
+ * The tail of a dynamic loop is inserted before the main body as a dynamic loop with the tail increment.
+ * Its work amount is set at runtime (see RuntimeConfigurator), so one kernel handles all the work amounts.
  * @ingroup snippets
  */
 class InsertSpecificIterations : public RangedPass {
@@ -32,6 +36,9 @@ public:
     static LinearIR::constExprIt insert_copy_loop(LinearIR& linear_ir,
                                                   const size_t loop_id,
                                                   const LinearIR::constExprIt& insert_pos);
+
+private:
+    static bool insert_dynamic_tail(LinearIR& linear_ir, const std::shared_ptr<op::LoopEndDynamic>& loop_end);
 };
 
 } // namespace pass
@@ -0,0 +1,42 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/pattern/matcher.hpp"
+#include "snippets/pass/tokenization.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface TokenizeFCSnippets
+ * @brief Tokenize FullyConnected (MatMul with Constant weights) with the eltwise prologue on activations to a subgraph:
+ *        [eltwise ops with Constant second inputs (e.g. dequantization or scale)] -> MatMul
+ *        The weights are passed to the subgraph as an input, the transposed weights are folded to the planar layout.
+ *        The subgraph isn't completed, so the eltwise consumers (activation, gating Multiply) are attached by TokenizeSnippets,
+ *        and two FullyConnected subgraphs with the same input (gate and up projections of LLM feed-forward layer) are merged
+ *        into one subgraph by the gating Multiply.
+ *        The transformation callback is called on MatMul.
+ * @ingroup snippets
+ */
+class TokenizeFCSnippets : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("TokenizeFCSnippets", "0");
+    TokenizeFCSnippets();
+
+    static bool is_supported_fc(const std::shared_ptr<const ov::Node>& node);
+    /**
+     * @brief Returns the Multiply that gates the output of the FullyConnected by the output of another FullyConnected
+     *        with the same input: Multiply(Activation(MatMul(X, W0)), MatMul(X, W1)), the activations are optional.
+     *        Returns nullptr if the FullyConnected isn't a part of such pattern.
+     * @param node MatMul
+     */
+    static std::shared_ptr<ov::Node> get_gating_multiply(const std::shared_ptr<const ov::Node>& node);
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ov
@@ -0,0 +1,27 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface MVNDecomposition
+ * @brief Decomposes MVN over the last dimension to a range of low-level operations
+ * @ingroup snippets
+ */
+class MVNDecomposition: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MVNDecomposition", "0");
+    MVNDecomposition();
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ov
@@ -0,0 +1,32 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/pattern/matcher.hpp"
+#include "snippets/pass/tokenization.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface TokenizeNormSnippets
+ * @brief Tokenize the normalization blocks of transformers to a subgraph:
+ *        [residual Add] -> LayerNorm (MVN over the last axis) or RMSNorm -> [Multiply by scale] -> [Add bias] -> [FakeQuantize or Convert]
+ *        RMSNorm is matched as x / Sqrt(ReduceMean(x ^ 2) + eps) or x * Power(ReduceMean(x ^ 2) + eps, -0.5).
+ *        The output of the residual Add becomes an additional output of the subgraph if it has the other consumers.
+ *        The transformation callback is called on the normalization node (MVN or ReduceMean).
+ *        The Subgraph is not created if it needs more data pointers than SnippetsTokenization::Config::norm_data_ptr_count.
+ * @ingroup snippets
+ */
+class TokenizeNormSnippets : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("TokenizeNormSnippets", "0");
+    TokenizeNormSnippets(const SnippetsTokenization::Config& config = {});
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ov
@@ -14,6 +14,7 @@ namespace pass {
 /**
  * @interface ReduceToSnippetsReduce
  * @brief Converts ReduceMax snd ReduceSum from openvino opset to snippets opset.
+ *        ReduceMean is converted to ReduceSum multiplied by the inverted size of the reduced dimension.
  * Also checks that reduction operation is supported by snippets.
  * @ingroup snippets
  */
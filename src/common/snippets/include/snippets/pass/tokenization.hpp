@@ -81,6 +81,9 @@ public:
         // Note that in general Snippets support Transpose of any ranks.
         // But at the moment Transpose is used only in MHA pattern where 3D and 4D tensors are supported.
         std::set<size_t> mha_supported_transpose_ranks = { 3, 4 };
+        // Max count of the data pointers (inputs, outputs and buffers) of the Norm Subgraph.
+        // Each pointer is held in a general-purpose register by the target, so the limit is set by the plugin.
+        size_t norm_data_ptr_count = 11;
     };
 
     OPENVINO_RTTI("SnippetsTokenization", "0");
@@ -0,0 +1,92 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "snippets/lowered/linear_ir.hpp"
+#include "snippets/lowered/port_descriptor.hpp"
+
+namespace ov {
+namespace snippets {
+
+/**
+ * @interface RuntimeConfig
+ * @brief The runtime parameters of the shape-agnostic kernel that depend on the input shapes
+ * @param master_shape the master shape of the kernel
+ * @param io_data_offsets the byte offsets of the input and output data pointers per each dimension of the master shape
+ *        (except for the last one which is processed by the kernel itself)
+ * @param loop_descriptors the runtime arguments of the dynamic loops in the kernel by the loop IDs
+ * @ingroup snippets
+ */
+class RuntimeConfig {
+public:
+    /**
+     * @interface LoopDescriptor
+     * @brief Work amount, pointer increments and finalization offsets of the dynamic loop.
+     *        The increments and offsets are in bytes and are ordered as the data pointers of the corresponding LoopEnd.
+     */
+    struct LoopDescriptor {
+        int64_t work_amount = 0;
+        std::vector<int64_t> ptr_increments = {};
+        std::vector<int64_t> finalization_offsets = {};
+    };
+
+    RuntimeConfig() = default;
+    virtual ~RuntimeConfig() = default;
+
+    VectorDims master_shape = {};
+    std::vector<VectorDims> io_data_offsets = {};
+    std::map<size_t, LoopDescriptor> loop_descriptors = {};
+};
+
+/**
+ * @interface RuntimeConfigurator
+ * @brief Updates the runtime parameters of the lowered LinearIR with dynamic shapes for the new input shapes:
+ *        infers the shapes of all the expressions, reinitializes the work amounts, the pointer increments and
+ *        the finalization offsets of the dynamic loops and calculates the data offsets of the inputs and outputs.
+ *        So the kernel generated once for the dynamic shapes can be executed for any input shapes of the same rank and layout.
+ * @ingroup snippets
+ */
+class RuntimeConfigurator {
+public:
+    RuntimeConfigurator(std::shared_ptr<RuntimeConfig> c = std::make_shared<RuntimeConfig>());
+    virtual ~RuntimeConfigurator() = default;
+
+    /**
+     * @brief Updates the shapes of the lowered LinearIR and the RuntimeConfig for the new input shapes
+     * @param linear_ir the lowered LinearIR. It must be the same object for all the calls
+     * @param input_shapes the new input shapes
+     * @return the updated RuntimeConfig
+     */
+    const std::shared_ptr<RuntimeConfig>& get_updated_config(const std::shared_ptr<lowered::LinearIR>& linear_ir,
+                                                             const std::vector<VectorDimsRef>& input_shapes);
+
+protected:
+    /**
+     * @brief Updates RuntimeConfig after the shape inference of LinearIR. Backends may override it to fill their specific parameters
+     * @param linear_ir the lowered LinearIR
+     */
+    virtual void update(const std::shared_ptr<lowered::LinearIR>& linear_ir);
+    /**
+     * @brief Saves the shape-independent information about LinearIR: I/O port descriptors, data sizes and
+     *        the compile-time work amounts of the dynamic loops
+     * @param linear_ir the lowered LinearIR
+     */
+    void initialization(const std::shared_ptr<lowered::LinearIR>& linear_ir);
+    void update_shapes(const std::shared_ptr<lowered::LinearIR>& linear_ir, const std::vector<VectorDimsRef>& input_shapes) const;
+    void update_loop_descriptors(const std::shared_ptr<lowered::LinearIR>& linear_ir) const;
+    void update_data_offsets() const;
+
+    std::shared_ptr<RuntimeConfig> m_config = nullptr;
+
+    std::shared_ptr<lowered::LinearIR> m_linear_ir = nullptr;
+    size_t m_in_num = 0;
+    std::vector<lowered::PortDescriptorPtr> m_io_descs = {};
+    std::vector<size_t> m_io_data_sizes = {};
+    // [loop end expression, work amount of the loop in the compile time]
+    std::vector<std::pair<lowered::ExpressionPtr, size_t>> m_dynamic_loops = {};
+};
+
+} // namespace snippets
+} // namespace ov
@@ -53,7 +53,9 @@ std::shared_ptr<LoopInfo> LoopInfo::clone_with_new_expr(const ExpressionMap& exp
     const auto& new_entry_points = clone_loop_ports(m_entry_points);
     const auto& new_exit_points = clone_loop_ports(m_exit_points);
 
-    return std::make_shared<LoopInfo>(m_work_amount, m_increment, new_entry_points, new_exit_points, m_handlers);
+    const auto cloned = std::make_shared<LoopInfo>(m_work_amount, m_increment, new_entry_points, new_exit_points, m_handlers);
+    cloned->m_main_body_increment = m_main_body_increment;
+    return cloned;
 }
 
 size_t LoopInfo::get_work_amount() const {
@@ -76,6 +78,10 @@ const SpecificIterationHandlers& LoopInfo::get_handlers() const {
     return m_handlers;
 }
 
+size_t LoopInfo::get_main_body_increment() const {
+    return m_main_body_increment;
+}
+
 size_t LoopInfo::get_dim_idx() const {
     OPENVINO_ASSERT(!m_entry_points.empty(), "Loop info must have at least one entry point");
     auto equal_dim_idxes = [&](const LoopPort& p) {
@@ -117,6 +123,10 @@ void LoopInfo::set_handlers(SpecificIterationHandlers handlers) {
     m_handlers = std::move(handlers);
 }
 
+void LoopInfo::set_main_body_increment(size_t increment) {
+    m_main_body_increment = increment;
+}
+
 void LoopInfo::update_entry_points(const std::function<void(LoopPort&)>& updater) {
     std::for_each(m_entry_points.begin(), m_entry_points.end(), updater);
 }
@@ -48,12 +48,45 @@ LinearIR::constExprIt InsertSpecificIterations::insert_copy_loop(LinearIR& linea
     const auto new_id = loop_manager->replace_with_new_loop(linear_ir, new_loop_begin_pos, new_loop_end_pos,
                                                             original_loop_info->get_work_amount(), original_loop_info->get_increment(),
                                                             new_entry_points, new_exit_points, loop_id);
-    const auto loop_end = ov::as_type_ptr<op::LoopEndStatic>(std::prev(new_loop_end_pos)->get()->get_node());
+    const auto loop_end = ov::as_type_ptr<op::LoopEnd>(std::prev(new_loop_end_pos)->get()->get_node());
     OPENVINO_ASSERT(loop_end, "Cloned Loop does not contain LoopEnd op at the expected place.");
     loop_end->set_id(new_id);
     return new_loop_begin_pos;
 }
 
+bool InsertSpecificIterations::insert_dynamic_tail(LinearIR& linear_ir, const std::shared_ptr<op::LoopEndDynamic>& loop_end) {
+    const auto& loop_manager = linear_ir.get_loop_manager();
+    const auto& loop_info = loop_manager->get_loop_info(loop_end->get_id());
+    const auto work_amount = loop_info->get_work_amount();
+    const auto increment = loop_info->get_increment();
+    const auto& handlers = loop_info->get_handlers();
+    OPENVINO_ASSERT(handlers.get_first_iter_handlers().empty(), "First iteration handlers are not supported by dynamic loops");
+
+    // Note: the specific iteration handlers of the loop with unknown work amount are created for the tail of size 1
+    const auto tail_size = utils::is_dynamic_value(work_amount) ? 1lu : work_amount % increment;
+    if (increment == 1 || tail_size == 0)
+        return false;
+
+    const auto main_loop_begin_it = linear_ir.find(linear_ir.get_expr_by_node(loop_end->get_loop_begin()));
+    const auto main_loop_end_it = linear_ir.find_after(main_loop_begin_it, linear_ir.get_expr_by_node(loop_end));
+    // The tail is inserted before the main body: the work amount of the main body is known only at runtime,
+    // so the main body loop finalizes the data pointers shifted by the both loops
+    const auto tail_begin_pos = insert_copy_loop(linear_ir, loop_end->get_id(), main_loop_begin_it);
+    const auto tail_begin = ov::as_type_ptr<op::LoopBeginDynamic>(tail_begin_pos->get()->get_node());
+    OPENVINO_ASSERT(tail_begin, "Cloned Loop does not contain LoopBegin op at the expected place.");
+    const auto tail_end = ov::as_type_ptr<op::LoopEndDynamic>(tail_begin->get_loop_end());
+    OPENVINO_ASSERT(tail_end, "Cloned Loop does not contain LoopEnd op at the expected place.");
+    const auto tail_end_pos = linear_ir.find_after(tail_begin_pos, linear_ir.get_expr_by_node(tail_end));
+    handlers.get_last_iter_handlers().run(linear_ir, std::next(tail_begin_pos), tail_end_pos);
+    tail_end->set_increment(tail_size);
+    const auto& tail_info = loop_manager->get_loop_info(tail_end->get_id());
+    tail_info->set_increment(tail_size);
+    tail_info->set_main_body_increment(increment);
+
+    handlers.get_main_iter_handlers().run(linear_ir, std::next(main_loop_begin_it), main_loop_end_it);
+    return true;
+}
+
 bool InsertSpecificIterations::run(LinearIR& linear_ir, lowered::LinearIR::constExprIt begin, lowered::LinearIR::constExprIt end) {
     OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::InsertSpecificIterations")
     const auto& loop_manager = linear_ir.get_loop_manager();
@@ -62,6 +95,10 @@ bool InsertSpecificIterations::run(LinearIR& linear_ir, lowered::LinearIR::const
     for (auto expr_it = begin; expr_it != end; ++expr_it) {
         const auto& expr = *expr_it;
         const auto node = expr->get_node();
+        if (const auto loop_end_dynamic = ov::as_type_ptr<op::LoopEndDynamic>(node)) {
+            modified |= insert_dynamic_tail(linear_ir, loop_end_dynamic);
+            continue;
+        }
         const auto loop_end = ov::as_type_ptr<op::LoopEndStatic>(node);
         if (!loop_end)
             continue;
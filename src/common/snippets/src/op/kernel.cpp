@@ -5,6 +5,7 @@
 #include "snippets/op/kernel.hpp"
 
 #include "snippets/op/loop.hpp"
+#include "snippets/utils.hpp"
 
 namespace ov {
 namespace snippets {
@@ -13,13 +14,20 @@ namespace op {
 Kernel::Kernel(lowered::LinearIR nested) : Op(), region(std::move(nested)) {}
 
 std::shared_ptr<Kernel> Kernel::make_kernel(const lowered::LinearIR& region) {
-    // TODO: In general the decision should be based on LinearIR.is_dynamic().
-    //       Need to add this condition when full dynamic pipeline support is completed
+    // Note: LinearIR.is_dynamic() can't be used here since the shapes of dynamic LinearIR may be already inferred
+    //       for the particular input shapes. The kernel is shape-agnostic if it has dynamic loops or dynamic I/O shapes:
+    //       even if all the loops are static, the data offsets of the I/O are known only at runtime.
     auto is_dynamic_loop = [](const lowered::ExpressionPtr& expr) {
         return ov::is_type<op::LoopBeginDynamic>(expr->get_node()) || ov::is_type<op::LoopEndDynamic>(expr->get_node());
     };
+    auto is_dynamic_io = [](const std::shared_ptr<lowered::IOExpression>& expr) {
+        const auto& desc = expr->get_type() == lowered::IOExpression::io_type::INPUT ? expr->get_output_port_descriptor(0)
+                                                                                     : expr->get_input_port_descriptor(0);
+        return utils::is_dynamic_vdims(desc->get_shape());
+    };
 
-    if (std::any_of(region.cbegin(), region.cend(), is_dynamic_loop)) {
+    const auto& io_exprs = region.get_IO_ops();
+    if (std::any_of(region.cbegin(), region.cend(), is_dynamic_loop) || std::any_of(io_exprs.cbegin(), io_exprs.cend(), is_dynamic_io)) {
         return std::make_shared<KernelDynamic>(region);
     } else {
         return std::make_shared<KernelStatic>(region);
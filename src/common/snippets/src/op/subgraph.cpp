@@ -19,6 +19,7 @@
 #include "snippets/pass/align_element_types.hpp"
 #include "snippets/pass/reduce_to_snippets_reduce.hpp"
 #include "snippets/pass/gn_decomposition.hpp"
+#include "snippets/pass/mvn_decomposition.hpp"
 
 #include "snippets/utils.hpp"
 
@@ -49,6 +50,8 @@
 #include "transformations/utils/utils.hpp"
 
 #include "snippets/pass/manager.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/reduce_mean.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "ov_ops/type_relaxed.hpp"
 #include "openvino/pass/serialize.hpp"
@@ -80,6 +83,8 @@ auto Subgraph::is_domain_sensitive_op(const std::shared_ptr<ov::Node>& op) -> bo
            ov::is_type<ov::op::v1::Broadcast>(op) || // Broadcast is domain sensetive op because the output shape depends on
            ov::is_type<ov::op::v3::Broadcast>(op) ||   // the both input and broadcast shapes (the both - are inputs of op). Note: is used only in MHA pattern
            ov::is_type<ov::op::v12::GroupNormalization>(op) ||
+           ov::is_type<ov::op::v6::MVN>(op) ||
+           ov::is_type<ov::op::v1::ReduceMean>(op) ||
            ov::is_type<op::Reshape>(op);
 }
 
@@ -400,6 +405,7 @@ void Subgraph::data_flow_transformations(const BlockedShapeVector& blocked_input
         manager.register_pass<snippets::pass::TransposeDecomposition>();
         manager.register_pass<snippets::pass::SoftmaxDecomposition>();
         manager.register_pass<snippets::pass::GNDecomposition>();
+        manager.register_pass<snippets::pass::MVNDecomposition>();
     }
     manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
     manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
@@ -477,22 +483,27 @@ snippets::Schedule Subgraph::generate_from_linear_ir(const std::shared_ptr<lower
     // Note: some transformations performed in the generator, e.g. tail insertion, can break shape propagation
     //  until we fix this behavior, we have to make a copy of LIR before giving it to the generator.
     OPENVINO_ASSERT(m_linear_ir, "Attempt to call generate, when linear IR was not initialized");
-    auto linear_ir {*m_linear_ir->clone()};
+    const auto linear_ir = m_linear_ir->clone();
     LoweringResult lowering_result;
-    control_flow_transformations(linear_ir, lowering_result, lowered_pass_config, backed_passes);
+    control_flow_transformations(*linear_ir, lowering_result, lowered_pass_config, backed_passes);
 #ifdef SNIPPETS_DEBUG_CAPS
-    if (linear_ir.get_config().perf_count_mode != lowered::PerfCountMode::Disabled) {
+    if (linear_ir->get_config().perf_count_mode != lowered::PerfCountMode::Disabled) {
         lowered::pass::InsertPerfCount perf_count_pass({});
-        perf_count_pass.run(linear_ir, linear_ir.cbegin(), linear_ir.cend());
+        perf_count_pass.run(*linear_ir, linear_ir->cbegin(), linear_ir->cend());
     }
 #endif
-    m_generator->generate(linear_ir, lowering_result, compile_params);
+    m_generator->generate(*linear_ir, lowering_result, compile_params);
 
-    VectorDims parallel_exec_domain = linear_ir.get_master_shape();
-    const size_t loop_depth = linear_ir.get_config().m_loop_depth;
+    VectorDims parallel_exec_domain = linear_ir->get_master_shape();
+    const size_t loop_depth = linear_ir->get_config().m_loop_depth;
     for (size_t i = 0; i < loop_depth; i++)
         parallel_exec_domain[parallel_exec_domain.size() - 1 - i] = 1;
 
+    // The shape-agnostic kernel is generated for the undefined shapes: its runtime parameters are updated
+    // using the lowered LinearIR (see RuntimeConfigurator), so it must be kept
+    if (utils::is_dynamic_vdims(parallel_exec_domain))
+        lowering_result.linear_ir = linear_ir;
+
     return {parallel_exec_domain, std::move(lowering_result)};
 }
 
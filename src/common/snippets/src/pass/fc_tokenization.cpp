@@ -0,0 +1,189 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/fc_tokenization.hpp"
+
+#include "snippets/itt.hpp"
+#include "snippets/op/subgraph.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
+#include "snippets/utils.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+#include <map>
+#include <set>
+
+namespace {
+using namespace ov::snippets;
+
+std::shared_ptr<ov::Node> get_single_consumer(const std::shared_ptr<const ov::Node>& node) {
+    const auto consumers = node->get_output_target_inputs(0);
+    return consumers.size() == 1 ? consumers.begin()->get_node()->shared_from_this() : nullptr;
+}
+
+// The eltwise op keeps the shape of the data on the first input and has only Constants on the other inputs,
+// so it can be moved to the Subgraph together with its data input without creating cyclic dependencies
+bool is_fusible_eltwise(const std::shared_ptr<ov::Node>& node) {
+    if (!node || node->get_input_size() == 0 || node->get_output_size() != 1 ||
+        ov::is_type<ov::op::v0::FakeQuantize>(node) || op::Subgraph::is_domain_sensitive_op(node) ||
+        pass::GetSnippetsNodeType(node) == pass::SnippetsNodeType::SkippedByPlugin ||
+        !pass::TokenizeSnippets::AppropriateForSubgraph(node))
+        return false;
+    if (node->get_input_partial_shape(0) != node->get_output_partial_shape(0) ||
+        ov::is_type<ov::op::v0::Constant>(node->get_input_node_shared_ptr(0)))
+        return false;
+    for (size_t i = 1; i < node->get_input_size(); ++i) {
+        if (!ov::is_type<ov::op::v0::Constant>(node->get_input_node_shared_ptr(i)))
+            return false;
+    }
+    return true;
+}
+}  // namespace
+
+bool ov::snippets::pass::TokenizeFCSnippets::is_supported_fc(const std::shared_ptr<const ov::Node>& node) {
+    const auto matmul = ov::as_type_ptr<const ov::op::v0::MatMul>(node);
+    if (!matmul || matmul->is_dynamic() || matmul->get_transpose_a() ||
+        !ov::is_type<ov::op::v0::Constant>(matmul->get_input_node_shared_ptr(1)))
+        return false;
+    const auto rank_a = matmul->get_input_shape(0).size();
+    const auto rank_w = matmul->get_input_shape(1).size();
+    const auto in_type0 = matmul->get_input_element_type(0);
+    const auto in_type1 = matmul->get_input_element_type(1);
+    return rank_a >= 2 && rank_a <= 4 && rank_w == 2 && in_type0 == in_type1 &&
+           utils::one_of(in_type0, element::f32, element::bf16);
+}
+
+std::shared_ptr<ov::Node> ov::snippets::pass::TokenizeFCSnippets::get_gating_multiply(const std::shared_ptr<const ov::Node>& node) {
+    if (!is_supported_fc(node))
+        return nullptr;
+
+    const ov::Node* branch = node.get();
+    auto consumer = get_single_consumer(node);
+    if (is_fusible_eltwise(consumer)) {
+        branch = consumer.get();
+        consumer = get_single_consumer(consumer);
+    }
+    const auto multiply = ov::as_type_ptr<ov::op::v1::Multiply>(consumer);
+    if (!multiply)
+        return nullptr;
+
+    auto other = multiply->get_input_node_ptr(0) == branch ? multiply->get_input_node_shared_ptr(1) : multiply->get_input_node_shared_ptr(0);
+    if (is_fusible_eltwise(other) && other->get_output_target_inputs(0).size() == 1)
+        other = other->get_input_node_shared_ptr(0);
+    const bool is_gating = other.get() != node.get() && other->get_output_target_inputs(0).size() == 1 &&
+                           is_supported_fc(other) && other->input_value(0) == node->input_value(0);
+    return is_gating ? multiply : nullptr;
+}
+
+ov::snippets::pass::TokenizeFCSnippets::TokenizeFCSnippets() {
+    MATCHER_SCOPE(TokenizeFCSnippets);
+
+    auto fc_pattern = ov::pass::pattern::wrap_type<ov::op::v0::MatMul>({ov::pass::pattern::any_input(),
+                                                                         ov::pass::pattern::wrap_type<ov::op::v0::Constant>()});
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::pass::TokenizeFCSnippets")
+        const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(m.get_match_root());
+        if (!is_supported_fc(matmul) || transformation_callback(matmul))
+            return false;
+
+        // The prologue ops have the single consumer, so they are not needed outside the Subgraph
+        ov::NodeVector ordered_ops{matmul};
+        auto data = matmul->get_input_node_shared_ptr(0);
+        while (is_fusible_eltwise(data) && data->get_output_target_inputs(0).size() == 1) {
+            ordered_ops.insert(ordered_ops.begin(), data);
+            data = data->get_input_node_shared_ptr(0);
+        }
+
+        auto is_inside = [&ordered_ops](const ov::Node* node) {
+            return std::any_of(ordered_ops.begin(), ordered_ops.end(),
+                               [node](const std::shared_ptr<ov::Node>& op) { return op.get() == node; });
+        };
+
+        // The weights and the other non-scalar Constants are passed to the body as Parameters
+        std::set<ov::Output<ov::Node>> external_inputs;
+        for (const auto& op : ordered_ops) {
+            for (const auto& input : op->input_values()) {
+                const auto parent = input.get_node_shared_ptr();
+                if (!is_inside(parent.get()) && !utils::is_scalar_constant(parent))
+                    external_inputs.insert(input);
+            }
+        }
+        // TODO [75567]: move this plugin-specific constraint to the plugin callback
+        const auto buffer_count = op::Subgraph::get_estimated_buffer_count(ordered_ops);
+        if (external_inputs.size() + 1 + buffer_count > 11)
+            return false;
+
+        // Brgemm doesn't support transposed inputs, so the transposed weights are folded to the planar layout once
+        if (matmul->get_transpose_b()) {
+            const auto weights = matmul->input_value(1);
+            const auto order = ov::op::v0::Constant::create(ov::element::i32, {2}, {1, 0});
+            const auto transpose = std::make_shared<ov::op::v1::Transpose>(weights, order);
+            ov::OutputVector folded(1);
+            if (!transpose->constant_fold(folded, transpose->input_values()))
+                return false;
+            const auto folded_weights = folded[0].get_node_shared_ptr();
+            folded_weights->set_friendly_name(weights.get_node_shared_ptr()->get_friendly_name());
+            ov::copy_runtime_info(weights.get_node_shared_ptr(), folded_weights);
+            matmul->input(1).replace_source_output(folded[0]);
+            matmul->set_transpose_b(false);
+            matmul->validate_and_infer_types();
+        }
+
+        ov::OutputVector subgraph_inputs;
+        ov::ParameterVector body_parameters;
+        std::map<ov::Output<ov::Node>, std::shared_ptr<ov::opset1::Parameter>> parameters;
+        std::string fused_names;
+        for (const auto& op : ordered_ops) {
+            for (size_t i = 0; i < op->get_input_size(); ++i) {
+                const auto input = op->input(i);
+                const auto source = input.get_source_output();
+                const auto parent = source.get_node_shared_ptr();
+                if (is_inside(parent.get()))
+                    continue;
+                if (utils::is_scalar_constant(parent)) {
+                    // Constants shared with the ops outside are copied to the body
+                    if (parent->get_output_target_inputs(0).size() != 1)
+                        op->set_argument(i, parent->clone_with_new_inputs({}));
+                    continue;
+                }
+                auto& parameter = parameters[source];
+                if (!parameter) {
+                    parameter = std::make_shared<ov::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+                    // Note: TokenizeSnippets unites the Parameters of the merged Subgraphs by the parent names,
+                    //       so the activations shared by two FullyConnected are passed to the merged Subgraph once
+                    parameter->set_friendly_name(parent->get_friendly_name());
+                    body_parameters.push_back(parameter);
+                    subgraph_inputs.push_back(source);
+                }
+                input.replace_source_output(parameter);
+            }
+            op->clear_control_dependencies();
+            fused_names += (fused_names.empty() ? "" : ",") + op->get_friendly_name();
+        }
+
+        const auto subgraph_result_inputs = matmul->get_output_target_inputs(0);
+        ov::ResultVector body_results{std::make_shared<ov::opset1::Result>(matmul->output(0))};
+
+        auto body = op::create_body(matmul->get_friendly_name(), body_results, body_parameters);
+        auto subgraph = op::build_subgraph(matmul, subgraph_inputs, body);
+        for (const auto& target_input : subgraph_result_inputs) {
+            target_input.replace_source_output(subgraph->output(0));
+        }
+        op::update_out_tensor_name(subgraph);
+        subgraph->validate_and_infer_types();
+
+        const auto& act_body = subgraph->body_ptr();
+        for (size_t i = 0; i < act_body->get_parameters().size(); i++) {
+            act_body->get_parameters()[i]->set_friendly_name(body_parameters[i]->get_friendly_name());
+        }
+        subgraph->get_rt_info()["originalLayersNames"] = fused_names;
+
+        return true;
+    };
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(fc_pattern, matcher_name);
+    register_matcher(m, callback);
+}
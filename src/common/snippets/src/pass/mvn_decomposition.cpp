@@ -0,0 +1,75 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/mvn_decomposition.hpp"
+
+#include "openvino/op/mvn.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "snippets/itt.hpp"
+#include "snippets/snippets_isa.hpp"
+#include "openvino/core/rt_info.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+// mvn = (x - mean) / Sqrt(ReduceMean((x - mean) ^ 2) + eps),
+// where mean = ReduceMean(x) and ReduceMean is ReduceSum multiplied by the inverted size of the last dimension
+MVNDecomposition::MVNDecomposition() {
+    MATCHER_SCOPE(MVNDecomposition);
+    auto mvn_pattern = ov::pass::pattern::wrap_type<ov::op::v6::MVN>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::pass::MVNDecomposition")
+        auto mvn_node = ov::as_type_ptr<ov::op::v6::MVN>(m.get_match_root());
+
+        const auto data = mvn_node->input_value(0);
+        const auto& shape = data.get_partial_shape();
+        OPENVINO_ASSERT(shape.rank().is_static() && shape[shape.size() - 1].is_static(),
+                        "MVN decomposition in snippets supports only static normalized dimension.");
+        // Note: we do not check the axes here. If the MVN was tokenized, then we assume that it's over the last dimension
+        const size_t axis = shape.size() - 1;
+        const float size_inv = 1.0f / static_cast<float>(shape[axis].get_length());
+
+        // reduceMean
+        const auto reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(data, axis);
+        op::ReduceBase::compute_and_set_reduce_subtensors(reduce_sum);
+        const auto size_inv_node = std::make_shared<ov::op::v0::Constant>(element::f32, Shape{}, std::vector<float>{size_inv});
+        const auto mean = std::make_shared<ov::op::v1::Multiply>(reduce_sum, size_inv_node);
+
+        // x - mean
+        std::shared_ptr<ov::Node> result = std::make_shared<ov::op::v1::Subtract>(data, mean);
+        if (mvn_node->get_normalize_variance()) {
+            // (x - mean) ^ 2
+            const auto sqr_const = std::make_shared<ov::op::v0::Constant>(element::f32, Shape{1}, std::vector<float>{2});
+            const auto sqr = std::make_shared<ov::op::v1::Power>(result, sqr_const);
+            // reduceMean((x - mean) ^ 2)
+            const auto sqr_reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(sqr, axis);
+            op::ReduceBase::compute_and_set_reduce_subtensors(sqr_reduce_sum);
+            const auto size_inv_node_aux = std::make_shared<ov::op::v0::Constant>(element::f32, Shape{}, std::vector<float>{size_inv});
+            const auto variance = std::make_shared<ov::op::v1::Multiply>(sqr_reduce_sum, size_inv_node_aux);
+            // stddev = sqrt(variance + eps) or sqrt(variance) + eps
+            const auto eps_node = std::make_shared<ov::op::v0::Constant>(element::f32, Shape{1},
+                                                                         std::vector<float>{mvn_node->get_eps()});
+            std::shared_ptr<ov::Node> stddev = nullptr;
+            if (mvn_node->get_eps_mode() == ov::op::MVNEpsMode::INSIDE_SQRT) {
+                stddev = std::make_shared<ov::op::v0::Sqrt>(std::make_shared<ov::op::v1::Add>(variance, eps_node));
+            } else {
+                stddev = std::make_shared<ov::op::v1::Add>(std::make_shared<ov::op::v0::Sqrt>(variance), eps_node);
+            }
+            // divide stddev
+            const auto stddev_inv = std::make_shared<ov::snippets::op::PowerStatic>(stddev, -1.f);
+            result = std::make_shared<ov::op::v1::Multiply>(result, stddev_inv);
+        }
+
+        return ov::replace_node_update_name(mvn_node, result);
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(mvn_pattern, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ov
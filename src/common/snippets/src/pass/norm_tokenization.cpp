@@ -0,0 +1,267 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/norm_tokenization.hpp"
+
+#include "snippets/itt.hpp"
+#include "snippets/op/subgraph.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
+#include "snippets/pass/fq_decomposition.hpp"
+#include "snippets/utils.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+#include <map>
+#include <set>
+
+namespace {
+using namespace ov::snippets;
+
+std::shared_ptr<ov::Node> get_single_consumer(const std::shared_ptr<ov::Node>& node) {
+    const auto consumers = node->get_output_target_inputs(0);
+    return consumers.size() == 1 ? consumers.begin()->get_node()->shared_from_this() : nullptr;
+}
+
+// Returns the input of the binary op which isn't connected to the parent
+ov::Output<ov::Node> get_other_input(const std::shared_ptr<ov::Node>& node, const std::shared_ptr<ov::Node>& parent) {
+    return node->get_input_node_ptr(0) == parent.get() ? node->input_value(1) : node->input_value(0);
+}
+
+bool is_scalar_constant_equal_to(const ov::Output<ov::Node>& out, float value) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(out.get_node_shared_ptr());
+    return constant && ov::shape_size(constant->get_shape()) == 1 && constant->cast_vector<float>()[0] == value;
+}
+
+bool is_last_axis(const ov::Output<ov::Node>& axes, const ov::PartialShape& shape) {
+    const auto axes_constant = ov::as_type_ptr<ov::op::v0::Constant>(axes.get_node_shared_ptr());
+    const auto rank = shape.rank();
+    if (!axes_constant || rank.is_dynamic() || ov::shape_size(axes_constant->get_shape()) != 1)
+        return false;
+    const auto axis = ov::util::normalize_axis(axes_constant->get_friendly_name(), axes_constant->cast_vector<int64_t>()[0], rank);
+    return axis == rank.get_length() - 1 && shape[axis].is_static();
+}
+
+// Scale and bias of the normalization are broadcasted along all the dimensions except the normalized one
+bool is_channel_wise_constant(const ov::Output<ov::Node>& out, const ov::PartialShape& data_shape) {
+    if (!ov::is_type<ov::op::v0::Constant>(out.get_node_shared_ptr()))
+        return false;
+    const auto& shape = out.get_shape();
+    if (shape.size() > data_shape.size())
+        return false;
+    const auto hidden = static_cast<size_t>(data_shape[data_shape.size() - 1].get_length());
+    return shape.empty() ||
+           (std::all_of(shape.begin(), shape.end() - 1, [](size_t dim) { return dim == 1; }) &&
+            (shape.back() == 1 || shape.back() == hidden));
+}
+
+// MVN over the last axis (LayerNorm without the affine part)
+bool match_mvn(const std::shared_ptr<ov::Node>& node, ov::NodeVector& norm_ops, ov::Output<ov::Node>& data) {
+    const auto mvn = ov::as_type_ptr<ov::op::v6::MVN>(node);
+    if (!mvn || !is_last_axis(mvn->input_value(1), mvn->get_input_partial_shape(0)))
+        return false;
+    data = mvn->input_value(0);
+    norm_ops = {mvn};
+    return true;
+}
+
+// x / Sqrt(ReduceMean(x ^ 2) + eps) or x * Power(ReduceMean(x ^ 2) + eps, -0.5)
+bool match_rms(const std::shared_ptr<ov::Node>& node, ov::NodeVector& norm_ops, ov::Output<ov::Node>& data) {
+    const auto mean = ov::as_type_ptr<ov::op::v1::ReduceMean>(node);
+    if (!mean || !mean->get_keep_dims() || !is_last_axis(mean->input_value(1), mean->get_input_partial_shape(0)))
+        return false;
+
+    const auto sqr = mean->get_input_node_shared_ptr(0);
+    if (ov::is_type<ov::op::v1::Power>(sqr) && is_scalar_constant_equal_to(sqr->input_value(1), 2.f)) {
+        data = sqr->input_value(0);
+    } else if (ov::is_type<ov::op::v1::Multiply>(sqr) && sqr->input_value(0) == sqr->input_value(1)) {
+        data = sqr->input_value(0);
+    } else {
+        return false;
+    }
+    if (sqr->get_output_target_inputs(0).size() != 1)
+        return false;
+
+    const auto add_eps = ov::as_type_ptr<ov::op::v1::Add>(get_single_consumer(mean));
+    if (!add_eps || !utils::is_scalar_constant(get_other_input(add_eps, mean).get_node_shared_ptr()))
+        return false;
+
+    const auto inv_stddev = get_single_consumer(add_eps);
+    std::shared_ptr<ov::Node> normalized = nullptr;
+    if (ov::is_type<ov::op::v0::Sqrt>(inv_stddev)) {
+        normalized = ov::as_type_ptr<ov::op::v1::Divide>(get_single_consumer(inv_stddev));
+        if (!normalized || normalized->input_value(0) != data || normalized->get_input_node_ptr(1) != inv_stddev.get())
+            return false;
+    } else if (ov::is_type<ov::op::v1::Power>(inv_stddev) && is_scalar_constant_equal_to(inv_stddev->input_value(1), -0.5f) &&
+               inv_stddev->get_input_node_ptr(0) == add_eps.get()) {
+        normalized = ov::as_type_ptr<ov::op::v1::Multiply>(get_single_consumer(inv_stddev));
+        if (!normalized || get_other_input(normalized, inv_stddev) != data)
+            return false;
+    } else {
+        return false;
+    }
+    norm_ops = {sqr, mean, add_eps, inv_stddev, normalized};
+    return true;
+}
+}  // namespace
+
+ov::snippets::pass::TokenizeNormSnippets::TokenizeNormSnippets(const SnippetsTokenization::Config& config) {
+    MATCHER_SCOPE(TokenizeNormSnippets);
+
+    auto norm_pattern = ov::pass::pattern::wrap_type<ov::op::v6::MVN, ov::op::v1::ReduceMean>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::pass::TokenizeNormSnippets")
+        const auto norm = m.get_match_root();
+        if (norm->get_input_element_type(0) != element::f32 || transformation_callback(norm))
+            return false;
+
+        ov::NodeVector ordered_ops;
+        ov::Output<ov::Node> data;
+        if (!match_mvn(norm, ordered_ops, data) && !match_rms(norm, ordered_ops, data))
+            return false;
+        const auto data_shape = data.get_partial_shape();
+
+        // The residual Add is skipped if the Plugin fuses it into the parent node (e.g. as sum post-op of FullyConnected)
+        const auto residual = ov::as_type_ptr<ov::op::v1::Add>(data.get_node_shared_ptr());
+        const bool has_residual = residual && GetSnippetsNodeType(residual) != SnippetsNodeType::SkippedByPlugin &&
+                                  residual->get_input_partial_shape(0) == residual->get_input_partial_shape(1) &&
+                                  residual->get_input_element_type(0) == element::f32 &&
+                                  residual->get_input_element_type(1) == element::f32 &&
+                                  !ov::is_type<ov::op::v0::Constant>(residual->get_input_node_shared_ptr(0)) &&
+                                  !ov::is_type<ov::op::v0::Constant>(residual->get_input_node_shared_ptr(1));
+        if (has_residual)
+            ordered_ops.insert(ordered_ops.begin(), residual);
+
+        // All the inputs of the ops after the normalization are Constants, so the ops can't create cyclic dependencies
+        size_t hidden_data_count = 0;
+        auto last_node = ordered_ops.back();
+        auto consumer = get_single_consumer(last_node);
+        if (ov::is_type<ov::op::v1::Multiply>(consumer) && is_channel_wise_constant(get_other_input(consumer, last_node), data_shape)) {
+            ordered_ops.push_back(consumer);
+            last_node = consumer;
+            consumer = get_single_consumer(last_node);
+        }
+        if (ov::is_type<ov::op::v1::Add>(consumer) && is_channel_wise_constant(get_other_input(consumer, last_node), data_shape)) {
+            ordered_ops.push_back(consumer);
+            last_node = consumer;
+            consumer = get_single_consumer(last_node);
+        }
+        if (const auto fq = ov::as_type_ptr<ov::op::v0::FakeQuantize>(consumer)) {
+            const auto inputs = fq->input_values();
+            const bool has_constant_ranges = std::all_of(inputs.begin() + 1, inputs.end(), [](const ov::Output<ov::Node>& in) {
+                return ov::is_type<ov::op::v0::Constant>(in.get_node_shared_ptr());
+            });
+            if (has_constant_ranges && fq->get_input_node_ptr(0) == last_node.get() &&
+                CommonFakeQuantizeDecomposition::is_supported_fq(fq)) {
+                ordered_ops.push_back(fq);
+                hidden_data_count += utils::get_non_scalar_constant_count_for_fq(fq);
+            }
+        } else if (const auto convert = ov::as_type_ptr<ov::op::v0::Convert>(consumer)) {
+            if (TokenizeSnippets::get_supported_element_types().count(convert->get_destination_type()))
+                ordered_ops.push_back(convert);
+        }
+        last_node = ordered_ops.back();
+
+        auto is_inside = [&ordered_ops](const ov::Node* node) {
+            return std::any_of(ordered_ops.begin(), ordered_ops.end(),
+                               [node](const std::shared_ptr<ov::Node>& op) { return op.get() == node; });
+        };
+
+        // The output of the residual Add is stored for the next residual connection of the model
+        std::set<ov::Input<ov::Node>> residual_consumers;
+        if (has_residual) {
+            for (const auto& target : residual->get_output_target_inputs(0)) {
+                if (!is_inside(target.get_node()))
+                    residual_consumers.insert(target);
+            }
+        }
+
+        // The non-scalar Constants (scale and bias) are passed to the body as Parameters,
+        // the same external tensor (e.g. the normalized data of RMSNorm) is passed once
+        std::set<ov::Output<ov::Node>> external_inputs;
+        for (const auto& op : ordered_ops) {
+            for (const auto& input : op->input_values()) {
+                const auto parent = input.get_node_shared_ptr();
+                if (!is_inside(parent.get()) && !utils::is_scalar_constant(parent) && !ov::is_type<ov::op::v0::FakeQuantize>(op))
+                    external_inputs.insert(input);
+            }
+        }
+        const size_t results_count = residual_consumers.empty() ? 1 : 2;
+        const auto buffer_count = op::Subgraph::get_estimated_buffer_count(ordered_ops);
+        if (external_inputs.size() + results_count + hidden_data_count + buffer_count > config.norm_data_ptr_count)
+            return false;
+
+        ov::OutputVector subgraph_inputs;
+        ov::ParameterVector body_parameters;
+        std::map<ov::Output<ov::Node>, std::shared_ptr<ov::opset1::Parameter>> parameters;
+        std::string fused_names;
+        for (const auto& op : ordered_ops) {
+            for (size_t i = 0; i < op->get_input_size(); ++i) {
+                const auto input = op->input(i);
+                const auto source = input.get_source_output();
+                const auto parent = source.get_node_shared_ptr();
+                if (is_inside(parent.get()))
+                    continue;
+                const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(parent);
+                if (constant && (ov::shape_size(input.get_shape()) == 1 || ov::is_type<ov::op::v0::FakeQuantize>(op))) {
+                    // Constants shared with the ops outside are copied to the body
+                    if (constant->get_output_target_inputs(0).size() != 1)
+                        op->set_argument(i, constant->clone_with_new_inputs({}));
+                    continue;
+                }
+                auto& parameter = parameters[source];
+                if (!parameter) {
+                    parameter = std::make_shared<ov::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+                    parameter->set_friendly_name(op->get_friendly_name());
+                    body_parameters.push_back(parameter);
+                    subgraph_inputs.push_back(source);
+                }
+                input.replace_source_output(parameter);
+            }
+            op->clear_control_dependencies();
+            fused_names += op->get_friendly_name() + ",";
+        }
+
+        std::vector<std::set<ov::Input<ov::Node>>> subgraph_result_inputs{last_node->get_output_target_inputs(0)};
+        ov::ResultVector body_results{std::make_shared<ov::opset1::Result>(last_node->output(0))};
+        if (!residual_consumers.empty()) {
+            subgraph_result_inputs.push_back(residual_consumers);
+            body_results.push_back(std::make_shared<ov::opset1::Result>(residual->output(0)));
+        }
+
+        auto body = op::create_body(last_node->get_friendly_name(), body_results, body_parameters);
+        auto subgraph = std::make_shared<op::Subgraph>(subgraph_inputs, body);
+        // Copy runtime info from last node to subgraph - to copy topological order
+        copy_runtime_info(last_node, subgraph);
+        subgraph->set_friendly_name(last_node->get_friendly_name());
+
+        for (size_t i = 0; i < subgraph->get_output_size(); ++i) {
+            for (const auto& target_input : subgraph_result_inputs[i]) {
+                target_input.replace_source_output(subgraph->output(i));
+            }
+        }
+        op::update_out_tensor_name(subgraph);
+        subgraph->validate_and_infer_types();
+
+        const auto& act_body = subgraph->body_ptr();
+        for (size_t i = 0; i < act_body->get_parameters().size(); i++) {
+            act_body->get_parameters()[i]->set_friendly_name(body_parameters[i]->get_friendly_name());
+        }
+        subgraph->get_rt_info()["originalLayersNames"] = fused_names;
+        subgraph->set_virtual_port_count(hidden_data_count);
+
+        // Mark the Subgraph as Completed: the reduction over the normalized dimension defines the parallel domain
+        // of the whole Subgraph, so the ops with the other domains must not be included in common Tokenization.
+        SetSnippetsSubgraphType(subgraph, SnippetsSubgraphType::Completed);
+
+        return true;
+    };
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(norm_pattern, matcher_name);
+    register_matcher(m, callback);
+}
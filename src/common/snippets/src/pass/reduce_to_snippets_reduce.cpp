@@ -5,7 +5,9 @@
 #include "snippets/pass/reduce_to_snippets_reduce.hpp"
 
 #include "openvino/core/rt_info.hpp"
+#include "openvino/op/multiply.hpp"
 #include "openvino/op/reduce_max.hpp"
+#include "openvino/op/reduce_mean.hpp"
 #include "openvino/op/reduce_sum.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "snippets/itt.hpp"
@@ -19,7 +21,7 @@ namespace pass {
 using namespace lowered;
 snippets::pass::ReduceToSnippetsReduce::ReduceToSnippetsReduce() {
     MATCHER_SCOPE(ReduceToSnippetsReduce);
-    auto reduce_pattern = ov::pass::pattern::wrap_type<ov::op::v1::ReduceSum, ov::op::v1::ReduceMax>();
+    auto reduce_pattern = ov::pass::pattern::wrap_type<ov::op::v1::ReduceSum, ov::op::v1::ReduceMax, ov::op::v1::ReduceMean>();
 
     auto callback = [](ov::pass::pattern::Matcher &m) {
         OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::op::ReduceToSnippetsReduce")
@@ -36,7 +38,7 @@ snippets::pass::ReduceToSnippetsReduce::ReduceToSnippetsReduce() {
         const auto axis = ov::util::normalize_axis(reduce->get_friendly_name(), axis_constant->cast_vector<int32_t>(1)[0], reduce_rank);
 
         std::shared_ptr<snippets::op::ReduceBase> snippets_reduce = nullptr;
-        if (ov::is_type<ov::op::v1::ReduceSum>(reduce))
+        if (ov::is_type<ov::op::v1::ReduceSum>(reduce) || ov::is_type<ov::op::v1::ReduceMean>(reduce))
             snippets_reduce = std::make_shared<ov::snippets::op::ReduceSum>(data_input, axis);
         else if (ov::is_type<ov::op::v1::ReduceMax>(reduce))
             snippets_reduce = std::make_shared<ov::snippets::op::ReduceMax>(data_input, axis);
@@ -44,9 +46,19 @@ snippets::pass::ReduceToSnippetsReduce::ReduceToSnippetsReduce() {
             OPENVINO_THROW("Reduce ", reduce, " can't be converted to snippets opset.");
         ov::snippets::op::ReduceBase::compute_and_set_reduce_subtensors(snippets_reduce);
 
-        ov::replace_node(reduce, snippets_reduce);
-        snippets_reduce->set_friendly_name(reduce->get_friendly_name());
-        ov::copy_runtime_info(reduce, snippets_reduce);
+        // ReduceMean = ReduceSum * (1 / N), where N is the size of the reduced dimension
+        std::shared_ptr<ov::Node> snippets_result = snippets_reduce;
+        if (ov::is_type<ov::op::v1::ReduceMean>(reduce)) {
+            const auto& reduced_dim = reduce->get_input_partial_shape(0)[axis];
+            OPENVINO_ASSERT(reduced_dim.is_static(), "ReduceToSnippetsReduce supports ReduceMean only over static dimension.");
+            const auto size_inv = std::make_shared<ov::op::v0::Constant>(reduce->get_output_element_type(0), Shape{},
+                                                                         1.0f / static_cast<float>(reduced_dim.get_length()));
+            snippets_result = std::make_shared<ov::op::v1::Multiply>(snippets_reduce, size_inv);
+        }
+
+        ov::replace_node(reduce, snippets_result);
+        snippets_result->set_friendly_name(reduce->get_friendly_name());
+        ov::copy_runtime_info(reduce, {snippets_reduce, snippets_result});
         return true;
     };
 
@@ -10,6 +10,8 @@
 #include "snippets/pass/extract_reshapes_from_mha.hpp"
 #include "snippets/pass/mha_tokenization.hpp"
 #include "snippets/pass/gn_tokenization.hpp"
+#include "snippets/pass/norm_tokenization.hpp"
+#include "snippets/pass/fc_tokenization.hpp"
 #include "snippets/pass/collapse_subgraph.hpp"
 
 
@@ -83,6 +85,8 @@ bool SnippetsTokenization::run_on_model(const std::shared_ptr<ov::Model>& m) {
     manager.register_pass<ExtractReshapesFromMHA>();
     manager.register_pass<TokenizeMHASnippets>(m_config);
     manager.register_pass<TokenizeGNSnippets>();
+    manager.register_pass<TokenizeNormSnippets>(m_config);
+    manager.register_pass<TokenizeFCSnippets>();
     manager.register_pass<TokenizeSnippets>();
     manager.register_pass<CommonOptimizations>(m_config);
     manager.run_passes(m);
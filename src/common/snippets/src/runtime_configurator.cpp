@@ -0,0 +1,185 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/runtime_configurator.hpp"
+
+#include "snippets/lowered/loop_manager.hpp"
+#include "snippets/lowered/pass/init_loops.hpp"
+#include "snippets/op/loop.hpp"
+#include "snippets/op/memory_access.hpp"
+#include "snippets/utils.hpp"
+
+namespace ov {
+namespace snippets {
+
+RuntimeConfigurator::RuntimeConfigurator(std::shared_ptr<RuntimeConfig> c) : m_config(std::move(c)) {
+    OPENVINO_ASSERT(m_config, "Runtime config is nullptr!");
+}
+
+const std::shared_ptr<RuntimeConfig>& RuntimeConfigurator::get_updated_config(const std::shared_ptr<lowered::LinearIR>& linear_ir,
+                                                                              const std::vector<VectorDimsRef>& input_shapes) {
+    OPENVINO_ASSERT(linear_ir, "LinearIR is nullptr!");
+    if (m_linear_ir != linear_ir)
+        initialization(linear_ir);
+
+    update_shapes(linear_ir, input_shapes);
+    update(linear_ir);
+    return m_config;
+}
+
+void RuntimeConfigurator::initialization(const std::shared_ptr<lowered::LinearIR>& linear_ir) {
+    m_linear_ir = linear_ir;
+    m_in_num = 0;
+    m_io_descs.clear();
+    m_io_data_sizes.clear();
+    m_dynamic_loops.clear();
+
+    // Note: the descriptors are collected in the same way as in the Kernel emitter,
+    //       since the data pointers are shifted using the shapes and layouts of the memory access ports
+    for (const auto& io_expr : linear_ir->get_IO_ops()) {
+        lowered::PortDescriptorPtr desc = nullptr;
+        element::Type etype;
+        switch (io_expr->get_type()) {
+            case lowered::IOExpression::io_type::INPUT: {
+                // input->shape changing ops->load
+                const auto& shape_infer_seq = utils::get_first_child_shape_infer_expr_seq(io_expr);
+                const auto& mem_desc_expr = shape_infer_seq.empty() ? io_expr : shape_infer_seq.back();
+                for (const auto& child_input : mem_desc_expr->get_output_port_connector(0)->get_consumers()) {
+                    const auto ma = std::dynamic_pointer_cast<modifier::MemoryAccess>(child_input.get_expr()->get_node());
+                    if (ma && ma->is_memory_access_input_port(child_input.get_index())) {
+                        desc = child_input.get_descriptor_ptr();
+                        break;
+                    }
+                }
+                etype = mem_desc_expr->get_node()->get_output_element_type(0);
+                m_in_num++;
+                break;
+            }
+            case lowered::IOExpression::io_type::OUTPUT: {
+                // store->shape changing ops->result
+                const auto& shape_infer_seq = utils::get_first_parent_shape_infer_expr_seq(io_expr);
+                const auto& mem_desc_expr = shape_infer_seq.empty() ? io_expr : shape_infer_seq.back();
+                desc = mem_desc_expr->get_input_port_connector(0)->get_source().get_descriptor_ptr();
+                etype = mem_desc_expr->get_node()->get_input_element_type(0);
+                break;
+            } default : {
+                OPENVINO_THROW("Detected unsupported io_type");
+            }
+        }
+        OPENVINO_ASSERT(desc, "Failed to find the memory access port of the I/O expression");
+        m_io_descs.push_back(desc);
+        m_io_data_sizes.push_back(etype.size());
+    }
+
+    // Note: the work amounts of the loops are reinitialized from the shapes only if they are dynamic in the compile time.
+    //       Static work amounts (e.g. the loops of the split dimensions) must be kept as is
+    const auto& loop_manager = linear_ir->get_loop_manager();
+    for (const auto& expr : *linear_ir) {
+        if (const auto loop_end = ov::as_type_ptr<op::LoopEndDynamic>(expr->get_node())) {
+            const auto& loop_info = loop_manager->get_loop_info(loop_end->get_id());
+            m_dynamic_loops.emplace_back(expr, loop_info->get_work_amount());
+        }
+    }
+}
+
+void RuntimeConfigurator::update(const std::shared_ptr<lowered::LinearIR>& linear_ir) {
+    update_loop_descriptors(linear_ir);
+    m_config->master_shape = linear_ir->get_master_shape();
+    update_data_offsets();
+}
+
+void RuntimeConfigurator::update_shapes(const std::shared_ptr<lowered::LinearIR>& linear_ir,
+                                        const std::vector<VectorDimsRef>& input_shapes) const {
+    OPENVINO_ASSERT(input_shapes.size() == m_in_num, "Got invalid number of input shapes: expected ", m_in_num, " got ", input_shapes.size());
+    for (const auto& io_expr : linear_ir->get_IO_ops()) {
+        if (io_expr->get_type() == lowered::IOExpression::io_type::INPUT)
+            io_expr->get_output_port_descriptor(0)->set_shape(input_shapes[io_expr->get_index()]);
+    }
+    for (const auto& expr : *linear_ir) {
+        if (expr->needShapeInfer())
+            expr->updateShapes();
+    }
+}
+
+void RuntimeConfigurator::update_loop_descriptors(const std::shared_ptr<lowered::LinearIR>& linear_ir) const {
+    const auto& loop_manager = linear_ir->get_loop_manager();
+    auto& loop_descriptors = m_config->loop_descriptors;
+    loop_descriptors.clear();
+    for (const auto& dynamic_loop : m_dynamic_loops) {
+        const auto& loop_end_expr = dynamic_loop.first;
+        const auto loop_end = ov::as_type_ptr<op::LoopEndDynamic>(loop_end_expr->get_node());
+        const auto loop_id = loop_end->get_id();
+        const auto& loop_info = loop_manager->get_loop_info(loop_id);
+        loop_info->set_work_amount(dynamic_loop.second);
+        lowered::pass::InitLoops::init_loop_info(loop_info, loop_id, true);
+
+        RuntimeConfig::LoopDescriptor desc;
+        desc.work_amount = static_cast<int64_t>(loop_info->get_work_amount());
+        // The tail loop is executed before the main body and processes the remainder of the work amount.
+        // The data pointers are finalized by the main body loop
+        const auto main_body_increment = loop_info->get_main_body_increment();
+        const bool is_tail = main_body_increment != 0;
+        if (is_tail)
+            desc.work_amount %= static_cast<int64_t>(main_body_increment);
+
+        const auto& entry_points = loop_info->get_entry_points();
+        const auto& exit_points = loop_info->get_exit_points();
+        const auto& data_sizes = loop_end->get_element_type_sizes();
+        const auto input_num = loop_end->get_input_num();
+        const auto io_num = input_num + loop_end->get_output_num();
+        desc.ptr_increments.resize(io_num, 0);
+        desc.finalization_offsets.resize(io_num, 0);
+        for (size_t i = 0; i < io_num; ++i) {
+            // Note: the Loop ports might be duplicated after the inner Loop copying (e.g. tail insertion),
+            //       so the port is found by the connector of the corresponding LoopEnd input
+            const auto& connector = loop_end_expr->get_input_port_connector(i);
+            const auto& ports = i < input_num ? entry_points : exit_points;
+            const auto port_it = std::find_if(ports.cbegin(), ports.cend(), [&connector](const lowered::LoopPort& port) {
+                return port.expr_port->get_port_connector_ptr() == connector;
+            });
+            OPENVINO_ASSERT(port_it != ports.cend(), "Failed to find the Loop port of the LoopEnd input ", i);
+            OPENVINO_ASSERT(!port_it->is_dynamic(), "Loop port parameters are undefined after the shape inference");
+            desc.ptr_increments[i] = port_it->ptr_increment * static_cast<int64_t>(loop_end->get_increment()) * data_sizes[i];
+            desc.finalization_offsets[i] = is_tail ? 0 : port_it->finalization_offset * data_sizes[i];
+        }
+        loop_descriptors[loop_id] = std::move(desc);
+    }
+}
+
+void RuntimeConfigurator::update_data_offsets() const {
+    const auto& master_shape = m_config->master_shape;
+    // Note that we don't need offset for the last dim, since it's handled directly by the kernel
+    const size_t offset_rank = master_shape.size() - 1;
+    auto& io_data_offsets = m_config->io_data_offsets;
+    io_data_offsets.resize(m_io_descs.size());
+    for (size_t i = 0; i < m_io_descs.size(); ++i) {
+        const auto& shape = m_io_descs[i]->get_shape();
+        const auto& layout = m_io_descs[i]->get_layout();
+        const auto data_size = m_io_data_sizes[i];
+        const bool is_input = i < m_in_num;
+        // If a dim size == 1, then the next dim starts immediately and the stride is 0
+        VectorDims strides(shape.size());
+        size_t dim_step = 1;
+        strides[shape.size() - 1] = 1;
+        for (int k = static_cast<int>(shape.size()) - 2; k >= 0; k--) {
+            dim_step *= shape[k + 1];
+            strides[k] = shape[k] != 1 ? dim_step * data_size : 0;
+        }
+        if (!layout.empty()) {
+            VectorDims reordered_strides(strides.size());
+            for (size_t j = 0; j < layout.size(); j++) {
+                const auto& src_idx = is_input ? layout[j] : j;
+                const auto& dst_idx = is_input ? j : layout[j];
+                reordered_strides[dst_idx] = strides[src_idx];
+            }
+            strides = std::move(reordered_strides);
+        }
+        strides.pop_back();
+        strides.insert(strides.begin(), offset_rank - strides.size(), 0);
+        io_data_offsets[i] = std::move(strides);
+    }
+}
+
+} // namespace snippets
+} // namespace ov
@@ -15,7 +15,9 @@
 #include "snippets/lowered/pass/iter_handler.hpp"
 #include "snippets/lowered/pass/optimize_loop_single_evaluation.hpp"
 #include "snippets/lowered/pass/validate_loops.hpp"
+#include "snippets/runtime_configurator.hpp"
 #include "snippets/shape_inference/shape_inference.hpp"
+#include "snippets/utils.hpp"
 #include "subgraph_simple.hpp"
 
 using Snippets_TailProcessingTransformation = ::testing::Test;
@@ -169,4 +171,64 @@ TEST(Snippets_TailProcessingTransformation, BlockedTail_CleanUpPtrShifts) {
     reference[7] = { std::vector<int64_t>(3, 0), std::vector<int64_t>(3, 0)};  // Tail Blocked
 
     validate(linear_ir, reference);
-}
\ No newline at end of file
+}
+
+TEST(Snippets_TailProcessingTransformation, DynamicTail_RuntimeConfig) {
+    const auto body = ov::test::snippets::AddFunction({ov::PartialShape{-1, -1}, ov::PartialShape{-1, -1}}).getOriginal();
+    const auto linear_ir = std::make_shared<LinearIR>(body, std::make_shared<ov::snippets::IShapeInferSnippetsFactory>());
+    auto expr_it = std::find_if(linear_ir->cbegin(), linear_ir->cend(),
+                                [](const ExpressionPtr& expr) { return ov::is_type<ov::op::v1::Add>(expr->get_node()); });
+    ASSERT_TRUE(expr_it != linear_ir->cend());
+    const auto add = *expr_it;
+    const auto loop_entry_points = std::vector<ExpressionPort>{add->get_input_port(0), add->get_input_port(1)};
+    const auto loop_exit_points = std::vector<ExpressionPort>{add->get_output_port(0)};
+    const auto loop_manager = linear_ir->get_loop_manager();
+    const auto dynamic_wa = ov::snippets::utils::get_dynamic_value<size_t>();
+    loop_manager->mark_loop(expr_it, std::next(expr_it), dynamic_wa, vector_size, 0, loop_entry_points, loop_exit_points);
+    loop_manager->mark_loop(expr_it, std::next(expr_it), dynamic_wa, 1, 1, loop_entry_points, loop_exit_points);
+
+    apply_transformations(*linear_ir, std::make_shared<pass::PassConfig>());
+
+    // The tail of the inner Loop is inserted before the main body
+    std::vector<std::shared_ptr<ov::snippets::op::LoopEndDynamic>> loop_ends;
+    for (const auto& expr : *linear_ir) {
+        ASSERT_FALSE(ov::is_type<ov::snippets::op::LoopEndStatic>(expr->get_node()));
+        if (const auto loop_end = ov::as_type_ptr<ov::snippets::op::LoopEndDynamic>(expr->get_node()))
+            loop_ends.push_back(loop_end);
+    }
+    ASSERT_EQ(loop_ends.size(), 3);
+    ASSERT_EQ(loop_ends[0]->get_increment(), 1);
+    ASSERT_EQ(loop_ends[1]->get_increment(), vector_size);
+    ASSERT_EQ(loop_ends[2]->get_increment(), 1);
+    ASSERT_EQ(loop_manager->get_loop_info(loop_ends[0]->get_id())->get_main_body_increment(), vector_size);
+    ASSERT_EQ(loop_manager->get_loop_info(loop_ends[1]->get_id())->get_main_body_increment(), 0);
+
+    ov::snippets::RuntimeConfigurator configurator;
+    for (const auto& shape : std::vector<ov::snippets::VectorDims>{{2, 35}, {3, 16}, {1, 7}}) {
+        const std::vector<ov::snippets::VectorDimsRef> input_shapes{shape, shape};
+        const auto& config = configurator.get_updated_config(linear_ir, input_shapes);
+        const auto rows = static_cast<int64_t>(shape[0]);
+        const auto cols = static_cast<int64_t>(shape[1]);
+        const auto data_size = static_cast<int64_t>(sizeof(float));
+        ASSERT_EQ(config->master_shape, shape);
+        ASSERT_EQ(config->loop_descriptors.size(), 3);
+
+        const auto& tail = config->loop_descriptors.at(loop_ends[0]->get_id());
+        ASSERT_EQ(tail.work_amount, cols % static_cast<int64_t>(vector_size));
+        ASSERT_EQ(tail.ptr_increments, std::vector<int64_t>(3, data_size));
+        ASSERT_EQ(tail.finalization_offsets, std::vector<int64_t>(3, 0));
+
+        const auto& inner = config->loop_descriptors.at(loop_ends[1]->get_id());
+        ASSERT_EQ(inner.work_amount, cols);
+        ASSERT_EQ(inner.ptr_increments, std::vector<int64_t>(3, static_cast<int64_t>(vector_size) * data_size));
+        ASSERT_EQ(inner.finalization_offsets, std::vector<int64_t>(3, -cols * data_size));
+
+        const auto& outer = config->loop_descriptors.at(loop_ends[2]->get_id());
+        ASSERT_EQ(outer.work_amount, rows);
+        ASSERT_EQ(outer.ptr_increments, std::vector<int64_t>(3, cols * data_size));
+        ASSERT_EQ(outer.finalization_offsets, std::vector<int64_t>(3, -rows * cols * data_size));
+
+        const auto io_data_offset = ov::snippets::VectorDims{rows != 1 ? static_cast<size_t>(cols * data_size) : 0};
+        ASSERT_EQ(config->io_data_offsets, std::vector<ov::snippets::VectorDims>(3, io_data_offset));
+    }
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/core/runtime_attribute.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+
+/**
+ * @ingroup ov_runtime_attr_api
+ * @brief WeightlessCacheAttribute class represents runtime info attribute that holds
+ * the location of the Constant data in the original weights file (e.g. IR .bin).
+ * The device may store the location instead of the data in the cache blob and read the data
+ * from the weights file when the model is imported.
+ *
+ * The attribute is not copyable, so the constants created by the transformations don't refer to the original data.
+ */
+class TRANSFORMATIONS_API WeightlessCacheAttribute : public RuntimeAttribute {
+public:
+    OPENVINO_RTTI("WeightlessCacheAttribute", "0");
+
+    WeightlessCacheAttribute() = delete;
+
+    WeightlessCacheAttribute(size_t original_size, size_t bin_offset, ov::element::Type original_dtype)
+        : original_size(original_size),
+          bin_offset(bin_offset),
+          original_dtype(original_dtype) {}
+
+    bool is_copyable() const override {
+        return false;
+    }
+
+    size_t original_size;
+    size_t bin_offset;
+    ov::element::Type original_dtype;
+};
+
+}  // namespace ov
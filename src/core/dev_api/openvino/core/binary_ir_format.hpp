@@ -0,0 +1,212 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace binary_ir {
+
+/**
+ * @brief Layout of the compact binary graph format written by ov::pass::BinarySerialize and read by the IR frontend.
+ *
+ * The file consists of the header, the weights, the graph and the strings sections. The weights section is
+ * aligned, so the constants may refer to the memory mapped file directly. All the strings (types, names, string
+ * attributes) are stored once in the strings section and are referred by the index. The graph section contains
+ * the model record:
+ *   u32 name, u32 nodes count, nodes in topological order, parameters, results and sinks indices, rt_info tree.
+ * Every node record is:
+ *   u32 type, u32 opset, u32 friendly name,
+ *   u32 inputs count, {u32 producer node index, u32 producer output index} for each input, rt_info of each input,
+ *   u32 outputs count, {u32 element type, shape, tensor names, rt_info} for each output,
+ *   rt_info of the node, attributes table.
+ * The attributes table is a flat list of the typed records {u32 name, u8 AttrType, u64 payload size, payload},
+ * the numbers and the vectors of numbers are stored as the raw values, so no conversion is required on load.
+ * The values are stored in the host byte order, which is checked on load by the endianness marker.
+ */
+constexpr char magic[8] = {'O', 'V', 'B', 'I', 'N', 'I', 'R', '\0'};
+constexpr uint32_t format_version = 1;
+constexpr uint32_t endianness_marker = 0x01020304;
+constexpr size_t weights_alignment = 64;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t endianness;
+    uint64_t weights_offset;
+    uint64_t weights_size;
+    uint64_t graph_offset;
+    uint64_t graph_size;
+    uint64_t strings_offset;
+    uint64_t strings_count;
+};
+
+enum class AttrType : uint8_t {
+    BOOL,
+    I8,
+    I16,
+    I32,
+    I64,
+    U8,
+    U16,
+    U32,
+    U64,
+    F32,
+    F64,
+    STRING,
+    VEC_I8,
+    VEC_I16,
+    VEC_I32,
+    VEC_I64,
+    VEC_U8,
+    VEC_U16,
+    VEC_U32,
+    VEC_U64,
+    VEC_F32,
+    VEC_F64,
+    VEC_STRING,            // u64 count, u32 string index for each element
+    PARTIAL_SHAPE,         // i64 rank (-1 for dynamic rank), {i64 min, i64 max} for each dimension
+    DIMENSION,             // i64 min, i64 max
+    TYPE_VECTOR,           // u64 count, u32 string index of each element type
+    VARIABLE,              // u32 variable id, u32 element type, partial shape
+    BUFFER,                // u64 offset, u64 size in the weights section
+    STRING_BUFFER,         // u64 offset, u64 size of the packed string tensor in the weights section
+    MODEL,                 // model record
+    INPUT_DESCRIPTIONS,    // u64 count, {u8 PortDescription, u64 input index, u64 body parameter index, ...}
+    OUTPUT_DESCRIPTIONS,   // u64 count, {u8 PortDescription, u64 body value index, u64 output index, ...}
+    SPECIAL_BODY_PORTS,    // i64 current iteration input, i64 body condition output
+    FRAMEWORK_NODE_ATTRS,  // u32 type, u32 opset, u64 count, {u32 name, u32 value} pairs
+    STRING_SET,            // u64 count, u32 string index for each element
+};
+
+/// \brief Kinds of the sub-graph port descriptions, stored as u8 before the description fields
+enum class PortDescription : uint8_t { SLICE_INPUT, MERGED_INPUT, INVARIANT_INPUT, CONCAT_OUTPUT, BODY_OUTPUT };
+
+/// \brief Kinds of the rt_info tree values, stored as u8 after the key
+enum class RtInfoValue : uint8_t { STRING, MAP };
+
+/// \brief Maps the attribute value type to the tag of the record storing it as raw data
+template <typename T>
+struct AttrTypeOf;
+#define OV_BINARY_IR_ATTR_TYPE(T, SCALAR, VECTOR)   \
+    template <>                                     \
+    struct AttrTypeOf<T> {                          \
+        static constexpr AttrType scalar() {        \
+            return AttrType::SCALAR;                \
+        }                                           \
+        static constexpr AttrType vector() {        \
+            return AttrType::VECTOR;                \
+        }                                           \
+    };
+OV_BINARY_IR_ATTR_TYPE(int8_t, I8, VEC_I8)
+OV_BINARY_IR_ATTR_TYPE(int16_t, I16, VEC_I16)
+OV_BINARY_IR_ATTR_TYPE(int32_t, I32, VEC_I32)
+OV_BINARY_IR_ATTR_TYPE(int64_t, I64, VEC_I64)
+OV_BINARY_IR_ATTR_TYPE(uint8_t, U8, VEC_U8)
+OV_BINARY_IR_ATTR_TYPE(uint16_t, U16, VEC_U16)
+OV_BINARY_IR_ATTR_TYPE(uint32_t, U32, VEC_U32)
+OV_BINARY_IR_ATTR_TYPE(uint64_t, U64, VEC_U64)
+OV_BINARY_IR_ATTR_TYPE(float, F32, VEC_F32)
+OV_BINARY_IR_ATTR_TYPE(double, F64, VEC_F64)
+#undef OV_BINARY_IR_ATTR_TYPE
+
+/// \brief Appends the raw values to the memory buffer
+class Writer {
+public:
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written");
+        write_raw(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void write_vector(const std::vector<T>& values) {
+        write<uint64_t>(values.size());
+        write_raw(values.data(), values.size() * sizeof(T));
+    }
+
+    void write_raw(const void* data, size_t size) {
+        const auto ptr = static_cast<const char*>(data);
+        m_data.insert(m_data.end(), ptr, ptr + size);
+    }
+
+    /// \brief Reserves the place for the value which is known later, returns the position for the update
+    template <typename T>
+    size_t reserve() {
+        const auto pos = m_data.size();
+        m_data.resize(pos + sizeof(T));
+        return pos;
+    }
+
+    template <typename T>
+    void update(size_t pos, const T& value) {
+        std::memcpy(m_data.data() + pos, &value, sizeof(T));
+    }
+
+    size_t size() const {
+        return m_data.size();
+    }
+
+    const std::vector<char>& data() const {
+        return m_data;
+    }
+
+private:
+    std::vector<char> m_data;
+};
+
+/// \brief Reads the raw values from the memory with the bounds check
+class Reader {
+public:
+    Reader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    template <typename T>
+    T read() {
+        T value;
+        std::memcpy(&value, advance(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    std::vector<T> read_vector() {
+        const auto count = static_cast<size_t>(read<uint64_t>());
+        OPENVINO_ASSERT(count <= (m_size - m_pos) / sizeof(T), "Binary IR is corrupted: vector is out of bounds");
+        std::vector<T> values(count);
+        const auto data = advance(count * sizeof(T));
+        if (count != 0)
+            std::memcpy(values.data(), data, count * sizeof(T));
+        return values;
+    }
+
+    const char* advance(size_t size) {
+        OPENVINO_ASSERT(size <= m_size - m_pos, "Binary IR is corrupted: unexpected end of data");
+        const auto ptr = m_data + m_pos;
+        m_pos += size;
+        return ptr;
+    }
+
+    /// \brief Returns the reader over the next `size` bytes and skips them
+    Reader sub_reader(size_t size) {
+        return Reader(advance(size), size);
+    }
+
+    bool empty() const {
+        return m_pos == m_size;
+    }
+
+private:
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+}  // namespace binary_ir
+}  // namespace ov
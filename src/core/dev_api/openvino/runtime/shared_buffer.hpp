@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <streambuf>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 
 namespace ov {
@@ -28,4 +30,38 @@ private:
     T _shared_object;
 };
 
+/// \brief SharedStreamBuffer class to read the pre-allocated buffer via std::istream without copying it.
+/// The buffer is not owned, the client has to keep it alive while the stream is used.
+class SharedStreamBuffer : public std::streambuf {
+public:
+    SharedStreamBuffer(char* data, size_t size) {
+        setg(data, data, data + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off,
+                     std::ios_base::seekdir dir,
+                     std::ios_base::openmode which = std::ios_base::in) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        off_type base = 0;
+        if (dir == std::ios_base::cur) {
+            base = gptr() - eback();
+        } else if (dir == std::ios_base::end) {
+            base = egptr() - eback();
+        }
+        const off_type pos = base + off;
+        if (pos < 0 || pos > egptr() - eback())
+            return pos_type(off_type(-1));
+
+        setg(eback(), eback() + pos, egptr());
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
 }  // namespace ov
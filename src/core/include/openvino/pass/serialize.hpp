@@ -74,5 +74,27 @@ private:
     std::function<void(std::ostream&)> m_custom_data_serializer;
     const Serialize::Version m_version;
 };
+
+/**
+ * @brief BinarySerialize transformation converts ov::Model into the compact binary graph format
+ * @details The graph, the attributes and the weights are stored in a single file, the attributes are kept in the
+ * typed form, so the IR frontend loads the model without XML parsing and string to number conversions, and
+ * the constants refer to the memory mapped file. The format is versioned and is read by ov::Core::read_model.
+ * \ingroup ov_pass_cpp_api
+ */
+class OPENVINO_API BinarySerialize : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("BinarySerialize");
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+    explicit BinarySerialize(std::ostream& stream);
+
+    explicit BinarySerialize(const std::string& path);
+
+private:
+    std::ostream* m_stream;
+    const std::string m_path;
+};
 }  // namespace pass
 }  // namespace ov
@@ -0,0 +1,595 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <openvino/cc/pass/itt.hpp>
+#include <set>
+#include <unordered_map>
+
+#include "openvino/core/binary_ir_format.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/meta_data.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/op_types.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/string_aligned_buffer.hpp"
+#include "openvino/util/file_util.hpp"
+
+namespace {
+using ov::binary_ir::AttrType;
+using ov::binary_ir::Writer;
+
+std::string get_opset_name(const ov::Node* node) {
+    // TypeRelaxed and similar template internal operations keep the opset name in rt_info
+    auto opset_it = node->get_rt_info().find("opset");
+    if (opset_it != node->get_rt_info().end() && opset_it->second.is<std::string>()) {
+        return opset_it->second.as<std::string>();
+    }
+    return node->get_type_info().version_id == nullptr ? "experimental" : node->get_type_info().version_id;
+}
+
+void write_partial_shape(Writer& out, const ov::PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        out.write<int64_t>(-1);
+        return;
+    }
+    out.write<int64_t>(shape.rank().get_length());
+    for (const auto& dim : shape) {
+        out.write<int64_t>(dim.get_min_length());
+        out.write<int64_t>(dim.get_max_length());
+    }
+}
+
+class ModelWriter;
+
+/// \brief Stores the attributes visited by the node into the flat table of the typed records
+class AttributeWriter : public ov::AttributeVisitor {
+public:
+    AttributeWriter(ModelWriter& model_writer, Writer& out);
+
+    /// \brief Writes the number of the visited attributes in front of the table
+    void finalize() {
+        m_out.update(m_count_pos, m_count);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override;
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        write_record(name, AttrType::BOOL, [&]() {
+            m_out.write<uint8_t>(adapter.get() ? 1 : 0);
+        });
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override;
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        write_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        write_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        write_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        write_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        write_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        write_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        write_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        write_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        write_vector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override;
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override;
+
+private:
+    template <typename F>
+    void write_record(const std::string& name, AttrType type, F&& write_payload);
+
+    template <typename T>
+    void write_scalar(const std::string& name, ov::ValueAccessor<T>& adapter) {
+        write_record(name, ov::binary_ir::AttrTypeOf<T>::scalar(), [&]() {
+            m_out.write<T>(adapter.get());
+        });
+    }
+
+    template <typename T>
+    void write_vector(const std::string& name, ov::ValueAccessor<std::vector<T>>& adapter) {
+        write_record(name, ov::binary_ir::AttrTypeOf<T>::vector(), [&]() {
+            m_out.write_vector(adapter.get());
+        });
+    }
+
+    ModelWriter& m_model_writer;
+    Writer& m_out;
+    size_t m_count_pos;
+    uint32_t m_count = 0;
+};
+
+/// \brief Writes the graph records into the memory, the strings into the shared table and the weights
+/// directly into the output stream
+class ModelWriter {
+public:
+    explicit ModelWriter(std::ostream& stream) : m_stream(stream) {}
+
+    uint32_t string_id(const std::string& str) {
+        auto it = m_string_ids.find(str);
+        if (it == m_string_ids.end()) {
+            it = m_string_ids.emplace(str, static_cast<uint32_t>(m_strings.size())).first;
+            m_strings.push_back(&it->first);
+        }
+        return it->second;
+    }
+
+    const std::vector<const std::string*>& strings() const {
+        return m_strings;
+    }
+
+    /// \brief Pads the weights section to the alignment and returns the offset of the next data in it
+    uint64_t align_weights() {
+        static const char padding[ov::binary_ir::weights_alignment] = {};
+        const auto tail = m_weights_size % ov::binary_ir::weights_alignment;
+        if (tail != 0) {
+            append_weights(padding, ov::binary_ir::weights_alignment - tail);
+        }
+        return m_weights_size;
+    }
+
+    void append_weights(const char* data, size_t size) {
+        m_stream.write(data, size);
+        m_weights_size += size;
+    }
+
+    /// \brief Writes the constant data, the same buffer shared by several constants is stored once
+    uint64_t write_constant(const char* data, size_t size) {
+        const auto key = std::make_pair(static_cast<const void*>(data), size);
+        auto it = m_constants.find(key);
+        if (it != m_constants.end())
+            return it->second;
+        const auto offset = align_weights();
+        append_weights(data, size);
+        m_constants.emplace(key, offset);
+        return offset;
+    }
+
+    uint64_t weights_size() const {
+        return m_weights_size;
+    }
+
+    void write_model(Writer& out, const ov::Model& model) {
+        const auto ordered_ops = model.get_ordered_ops();
+        std::unordered_map<const ov::Node*, uint32_t> node_ids;
+        node_ids.reserve(ordered_ops.size());
+
+        out.write<uint32_t>(string_id(model.get_friendly_name()));
+        out.write<uint32_t>(static_cast<uint32_t>(ordered_ops.size()));
+        for (const auto& node : ordered_ops) {
+            write_node(out, *node, node_ids);
+            node_ids.emplace(node.get(), static_cast<uint32_t>(node_ids.size()));
+        }
+
+        const auto write_ids = [&](const std::vector<std::shared_ptr<ov::Node>>& nodes) {
+            out.write<uint32_t>(static_cast<uint32_t>(nodes.size()));
+            for (const auto& node : nodes) {
+                out.write<uint32_t>(node_ids.at(node.get()));
+            }
+        };
+        const auto& parameters = model.get_parameters();
+        const auto& results = model.get_results();
+        const auto& sinks = model.get_sinks();
+        write_ids({parameters.begin(), parameters.end()});
+        write_ids({results.begin(), results.end()});
+        write_ids({sinks.begin(), sinks.end()});
+
+        ov::AnyMap rt_info;
+        for (const auto& item : model.get_rt_info()) {
+            // IR version is specific to XML
+            if (item.first != "version")
+                rt_info.insert(item);
+        }
+        write_meta(out, rt_info);
+    }
+
+    void write_rt_info(Writer& out, const ov::RTMap& rt_info) {
+        const auto count_pos = out.reserve<uint32_t>();
+        uint32_t count = 0;
+        for (const auto& item : rt_info) {
+            if (!item.second.is<ov::RuntimeAttribute>())
+                continue;
+            const auto& attribute = item.second.as<ov::RuntimeAttribute>();
+            const auto& type_info = attribute.get_type_info();
+            Writer attribute_out;
+            AttributeWriter visitor(*this, attribute_out);
+            if (!const_cast<ov::RuntimeAttribute&>(attribute).visit_attributes(visitor))
+                continue;
+            visitor.finalize();
+            out.write<uint32_t>(string_id(type_info.name));
+            out.write<uint32_t>(string_id(type_info.get_version()));
+            out.write_raw(attribute_out.data().data(), attribute_out.size());
+            ++count;
+        }
+        out.update(count_pos, count);
+    }
+
+private:
+    void write_node(Writer& out, const ov::Node& node, const std::unordered_map<const ov::Node*, uint32_t>& node_ids) {
+        std::string type_name = node.get_type_name();
+        std::string opset_name = get_opset_name(&node);
+        if (const auto framework_node = dynamic_cast<const ov::op::util::FrameworkNode*>(&node)) {
+            type_name = framework_node->get_attrs().get_type_name();
+            opset_name = framework_node->get_attrs().get_opset_name();
+        }
+        out.write<uint32_t>(string_id(type_name));
+        out.write<uint32_t>(string_id(opset_name));
+        out.write<uint32_t>(string_id(node.get_friendly_name()));
+
+        out.write<uint32_t>(static_cast<uint32_t>(node.get_input_size()));
+        for (const auto& input : node.inputs()) {
+            const auto source = input.get_source_output();
+            out.write<uint32_t>(node_ids.at(source.get_node()));
+            out.write<uint32_t>(static_cast<uint32_t>(source.get_index()));
+            write_rt_info(out, input.get_rt_info());
+        }
+
+        out.write<uint32_t>(static_cast<uint32_t>(node.get_output_size()));
+        for (const auto& output : node.outputs()) {
+            out.write<uint32_t>(string_id(output.get_element_type().get_type_name()));
+            write_partial_shape(out, output.get_partial_shape());
+            const auto& names = output.get_names();
+            std::vector<std::string> sorted_names(names.begin(), names.end());
+            std::sort(sorted_names.begin(), sorted_names.end());
+            out.write<uint32_t>(static_cast<uint32_t>(sorted_names.size()));
+            for (const auto& name : sorted_names) {
+                out.write<uint32_t>(string_id(name));
+            }
+            write_rt_info(out, output.get_rt_info());
+        }
+
+        write_rt_info(out, node.get_rt_info());
+
+        AttributeWriter visitor(*this, out);
+        OPENVINO_ASSERT(const_cast<ov::Node&>(node).visit_attributes(visitor),
+                        "Visitor API is not supported in ",
+                        node);
+        visitor.finalize();
+    }
+
+    void write_meta(Writer& out, const ov::AnyMap& map) {
+        out.write<uint32_t>(static_cast<uint32_t>(map.size()));
+        for (const auto& item : map) {
+            out.write<uint32_t>(string_id(item.first));
+            if (item.second.is<std::shared_ptr<ov::Meta>>()) {
+                out.write(ov::binary_ir::RtInfoValue::MAP);
+                write_meta(out, static_cast<ov::AnyMap&>(*item.second.as<std::shared_ptr<ov::Meta>>()));
+            } else if (item.second.is<ov::AnyMap>()) {
+                out.write(ov::binary_ir::RtInfoValue::MAP);
+                write_meta(out, item.second.as<ov::AnyMap>());
+            } else {
+                out.write(ov::binary_ir::RtInfoValue::STRING);
+                out.write<uint32_t>(string_id(item.second.as<std::string>()));
+            }
+        }
+    }
+
+    std::ostream& m_stream;
+    uint64_t m_weights_size = 0;
+    std::unordered_map<std::string, uint32_t> m_string_ids;
+    std::vector<const std::string*> m_strings;
+    std::map<std::pair<const void*, size_t>, uint64_t> m_constants;
+};
+
+AttributeWriter::AttributeWriter(ModelWriter& model_writer, Writer& out)
+    : m_model_writer(model_writer),
+      m_out(out),
+      m_count_pos(out.reserve<uint32_t>()) {}
+
+template <typename F>
+void AttributeWriter::write_record(const std::string& name, AttrType type, F&& write_payload) {
+    m_out.write<uint32_t>(m_model_writer.string_id(name));
+    m_out.write(type);
+    const auto size_pos = m_out.reserve<uint64_t>();
+    const auto payload_begin = m_out.size();
+    write_payload();
+    m_out.update<uint64_t>(size_pos, m_out.size() - payload_begin);
+    ++m_count;
+}
+
+void AttributeWriter::on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) {
+    write_record(name, AttrType::STRING, [&]() {
+        m_out.write<uint32_t>(m_model_writer.string_id(adapter.get()));
+    });
+}
+
+void AttributeWriter::on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) {
+    write_record(name, AttrType::VEC_STRING, [&]() {
+        const auto& values = adapter.get();
+        m_out.write<uint64_t>(values.size());
+        for (const auto& value : values) {
+            m_out.write<uint32_t>(m_model_writer.string_id(value));
+        }
+    });
+}
+
+void AttributeWriter::on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) {
+    write_record(name, AttrType::MODEL, [&]() {
+        m_model_writer.write_model(m_out, *adapter.get());
+    });
+}
+
+void AttributeWriter::on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) {
+    using ov::op::util::MultiSubGraphOp;
+    using PortDescription = ov::binary_ir::PortDescription;
+
+    if (const auto a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+        write_record(name, AttrType::PARTIAL_SHAPE, [&]() {
+            write_partial_shape(m_out, a->get());
+        });
+    } else if (const auto a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+        write_record(name, AttrType::DIMENSION, [&]() {
+            m_out.write<int64_t>(a->get().get_min_length());
+            m_out.write<int64_t>(a->get().get_max_length());
+        });
+    } else if (const auto a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+        write_record(name, AttrType::TYPE_VECTOR, [&]() {
+            const auto& types = a->get();
+            m_out.write<uint64_t>(types.size());
+            for (const auto& type : types) {
+                m_out.write<uint32_t>(m_model_writer.string_id(type.get_type_name()));
+            }
+        });
+    } else if (const auto a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+        write_record(name, AttrType::STRING_SET, [&]() {
+            const auto& values = a->get();
+            m_out.write<uint64_t>(values.size());
+            for (const auto& value : values) {
+                m_out.write<uint32_t>(m_model_writer.string_id(value));
+            }
+        });
+    } else if (const auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+        write_record(name, AttrType::VARIABLE, [&]() {
+            const auto& info = a->get()->get_info();
+            m_out.write<uint32_t>(m_model_writer.string_id(info.variable_id));
+            m_out.write<uint32_t>(m_model_writer.string_id(info.data_type.get_type_name()));
+            write_partial_shape(m_out, info.data_shape);
+        });
+    } else if (const auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>>(&adapter)) {
+        write_record(name, AttrType::BUFFER, [&]() {
+            const auto& buffer = a->get();
+            m_out.write<uint64_t>(m_model_writer.write_constant(buffer->get_ptr<char>(), buffer->size()));
+            m_out.write<uint64_t>(buffer->size());
+        });
+    } else if (ov::is_type<ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>>(&adapter) ||
+               ov::is_type<ov::AttributeAdapter<std::shared_ptr<ov::SharedStringAlignedBuffer>>>(&adapter)) {
+        // the strings are stored as the packed string tensor: the header with the offsets followed by the strings
+        auto a1 = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>>(&adapter);
+        auto a2 = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::SharedStringAlignedBuffer>>>(&adapter);
+        std::shared_ptr<uint8_t> header;
+        size_t header_size = 0;
+        size_t num_elements = 0;
+        if (a1) {
+            a1->get_header(header, header_size);
+            num_elements = a1->get()->get_num_elements();
+        } else {
+            a2->get_header(header, header_size);
+            num_elements = a2->get()->get_num_elements();
+        }
+        const auto offset = m_model_writer.align_weights();
+        m_model_writer.append_weights(reinterpret_cast<const char*>(header.get()), header_size);
+        for (size_t i = 0; i < num_elements; ++i) {
+            const char* str = nullptr;
+            size_t str_size = 0;
+            if (a1) {
+                a1->get_raw_string_by_index(str, str_size, i);
+            } else {
+                a2->get_raw_string_by_index(str, str_size, i);
+            }
+            m_model_writer.append_weights(str, str_size);
+        }
+        const auto size = m_model_writer.weights_size() - offset;
+        write_record(name, AttrType::STRING_BUFFER, [&]() {
+            m_out.write<uint64_t>(offset);
+            m_out.write<uint64_t>(size);
+        });
+    } else if (const auto a = ov::as_type<
+                   ov::AttributeAdapter<std::vector<std::shared_ptr<MultiSubGraphOp::InputDescription>>>>(&adapter)) {
+        write_record(name, AttrType::INPUT_DESCRIPTIONS, [&]() {
+            const auto& descriptions = a->get();
+            m_out.write<uint64_t>(descriptions.size());
+            for (const auto& description : descriptions) {
+                const auto slice = ov::as_type_ptr<MultiSubGraphOp::SliceInputDescription>(description);
+                const auto merged = ov::as_type_ptr<MultiSubGraphOp::MergedInputDescription>(description);
+                m_out.write(slice    ? PortDescription::SLICE_INPUT
+                            : merged ? PortDescription::MERGED_INPUT
+                                     : PortDescription::INVARIANT_INPUT);
+                m_out.write<uint64_t>(description->m_input_index);
+                m_out.write<uint64_t>(description->m_body_parameter_index);
+                if (slice) {
+                    m_out.write<int64_t>(slice->m_start);
+                    m_out.write<int64_t>(slice->m_stride);
+                    m_out.write<int64_t>(slice->m_part_size);
+                    m_out.write<int64_t>(slice->m_end);
+                    m_out.write<int64_t>(slice->m_axis);
+                } else if (merged) {
+                    m_out.write<uint64_t>(merged->m_body_value_index);
+                }
+            }
+        });
+    } else if (const auto a = ov::as_type<
+                   ov::AttributeAdapter<std::vector<std::shared_ptr<MultiSubGraphOp::OutputDescription>>>>(&adapter)) {
+        write_record(name, AttrType::OUTPUT_DESCRIPTIONS, [&]() {
+            const auto& descriptions = a->get();
+            m_out.write<uint64_t>(descriptions.size());
+            for (const auto& description : descriptions) {
+                const auto concat = ov::as_type_ptr<MultiSubGraphOp::ConcatOutputDescription>(description);
+                const auto body = ov::as_type_ptr<MultiSubGraphOp::BodyOutputDescription>(description);
+                m_out.write(concat ? PortDescription::CONCAT_OUTPUT : PortDescription::BODY_OUTPUT);
+                m_out.write<uint64_t>(description->m_body_value_index);
+                m_out.write<uint64_t>(description->m_output_index);
+                if (concat) {
+                    m_out.write<int64_t>(concat->m_start);
+                    m_out.write<int64_t>(concat->m_stride);
+                    m_out.write<int64_t>(concat->m_part_size);
+                    m_out.write<int64_t>(concat->m_end);
+                    m_out.write<int64_t>(concat->m_axis);
+                } else {
+                    m_out.write<int64_t>(body ? body->m_iteration : -1);
+                }
+            }
+        });
+    } else if (const auto a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+        write_record(name, AttrType::SPECIAL_BODY_PORTS, [&]() {
+            m_out.write<int64_t>(a->get().current_iteration_input_idx);
+            m_out.write<int64_t>(a->get().body_condition_output_idx);
+        });
+    } else if (const auto a = ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+        write_record(name, AttrType::FRAMEWORK_NODE_ATTRS, [&]() {
+            const auto& attrs = a->get();
+            m_out.write<uint32_t>(m_model_writer.string_id(attrs.get_type_name()));
+            m_out.write<uint32_t>(m_model_writer.string_id(attrs.get_opset_name()));
+            // the attributes are sorted to make the output deterministic
+            std::map<std::string, std::string> sorted_attrs(attrs.begin(), attrs.end());
+            m_out.write<uint64_t>(sorted_attrs.size());
+            for (const auto& attr : sorted_attrs) {
+                m_out.write<uint32_t>(m_model_writer.string_id(attr.first));
+                m_out.write<uint32_t>(m_model_writer.string_id(attr.second));
+            }
+        });
+    } else {
+        OPENVINO_THROW("Unsupported attribute type for binary serialization: ", name);
+    }
+}
+
+}  // namespace
+
+namespace ov {
+bool pass::BinarySerialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(BinarySerialize);
+
+    const auto write = [&model](std::ostream& stream) {
+        /*
+            Format:
+            [ Header  ]
+            [ Weights ]
+            [ Graph   ]
+            [ Strings ]
+        */
+        binary_ir::Header header = {};
+        std::copy(std::begin(binary_ir::magic), std::end(binary_ir::magic), header.magic);
+        header.version = binary_ir::format_version;
+        header.endianness = binary_ir::endianness_marker;
+
+        const auto header_pos = stream.tellp();
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        // the weights section starts at the aligned offset, so the constants are aligned in the mapped file
+        const auto header_tail = sizeof(header) % binary_ir::weights_alignment;
+        if (header_tail != 0) {
+            const std::vector<char> padding(binary_ir::weights_alignment - header_tail, 0);
+            stream.write(padding.data(), padding.size());
+        }
+        header.weights_offset = static_cast<uint64_t>(stream.tellp() - header_pos);
+
+        ModelWriter model_writer(stream);
+        binary_ir::Writer graph;
+        model_writer.write_model(graph, *model);
+        header.weights_size = model_writer.weights_size();
+
+        header.graph_offset = header.weights_offset + header.weights_size;
+        header.graph_size = graph.size();
+        stream.write(graph.data().data(), graph.size());
+
+        header.strings_offset = header.graph_offset + header.graph_size;
+        header.strings_count = model_writer.strings().size();
+        binary_ir::Writer strings;
+        for (const auto& str : model_writer.strings()) {
+            strings.write<uint32_t>(static_cast<uint32_t>(str->size()));
+            strings.write_raw(str->data(), str->size());
+        }
+        stream.write(strings.data().data(), strings.size());
+
+        const auto end_pos = stream.tellp();
+        stream.seekp(header_pos);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.seekp(end_pos);
+        OPENVINO_ASSERT(stream.good(), "Failed to write the binary model");
+    };
+
+    if (m_stream) {
+        write(*m_stream);
+    } else {
+        auto dir = ov::util::get_directory(m_path);
+        if (dir != m_path)
+            ov::util::create_directory_recursive(dir);
+
+        std::ofstream file(m_path, std::ios::out | std::ios::binary);
+        OPENVINO_ASSERT(file, "Can't open binary model file: \"" + m_path + "\"");
+        try {
+            write(file);
+        } catch (const ov::Exception&) {
+            file.close();
+            std::remove(m_path.c_str());
+            throw;
+        }
+    }
+
+    // Return false because we didn't change ov Model
+    return false;
+}
+
+pass::BinarySerialize::BinarySerialize(std::ostream& stream) : m_stream{&stream}, m_path{} {}
+
+pass::BinarySerialize::BinarySerialize(const std::string& path) : m_stream{nullptr}, m_path{path} {}
+}  // namespace ov
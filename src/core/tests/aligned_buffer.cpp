@@ -4,7 +4,10 @@
 
 #include "openvino/runtime/aligned_buffer.hpp"
 
+#include <istream>
+
 #include "gtest/gtest.h"
+#include "openvino/runtime/shared_buffer.hpp"
 
 using namespace ov;
 
@@ -33,3 +36,24 @@ TEST(aligned_buffer, move) {
         EXPECT_NE(buffer2.get_ptr(), nullptr);
     }
 }
+
+TEST(shared_stream_buffer, read_and_seek) {
+    char data[] = "0123456789";
+    SharedStreamBuffer buffer(data, 10);
+    std::istream stream(&buffer);
+
+    char chunk[4] = {};
+    stream.read(chunk, 3);
+    EXPECT_EQ(std::string(chunk), "012");
+    EXPECT_EQ(stream.tellg(), 3);
+
+    stream.seekg(0, stream.end);
+    EXPECT_EQ(stream.tellg(), 10);
+
+    stream.seekg(7);
+    stream.read(chunk, 3);
+    EXPECT_EQ(std::string(chunk), "789");
+
+    stream.seekg(11);
+    EXPECT_TRUE(stream.fail());
+}
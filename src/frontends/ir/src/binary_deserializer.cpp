@@ -0,0 +1,547 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "binary_deserializer.hpp"
+
+#include "openvino/core/except.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/util/assign_base.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/read_value_base.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/runtime/string_aligned_buffer.hpp"
+
+using ov::binary_ir::AttrType;
+using ov::binary_ir::Reader;
+
+namespace {
+
+/// \brief Sets the attributes of the node from its flat table of the typed records
+class BinaryAttributeReader : public ov::AttributeVisitor {
+public:
+    BinaryAttributeReader(ov::BinaryDeserializer& deserializer, Reader& reader) : m_deserializer(deserializer) {
+        const auto count = reader.read<uint32_t>();
+        m_records.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto& name = m_deserializer.get_string(reader.read<uint32_t>());
+            const auto type = reader.read<AttrType>();
+            const auto size = static_cast<size_t>(reader.read<uint64_t>());
+            m_records.push_back({&name, type, reader.sub_reader(size)});
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override;
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        if (auto reader = find(name, AttrType::BOOL))
+            adapter.set(reader->read<uint8_t>() != 0);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        if (auto reader = find(name, AttrType::STRING))
+            adapter.set(m_deserializer.get_string(reader->read<uint32_t>()));
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        read_scalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        read_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        read_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        read_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        read_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        read_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        read_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        read_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        read_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        read_vector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        read_vector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        if (auto reader = find(name, AttrType::VEC_STRING))
+            adapter.set(read_strings<std::vector<std::string>>(*reader));
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        if (auto reader = find(name, AttrType::MODEL))
+            adapter.set(m_deserializer.read_model(*reader));
+    }
+
+private:
+    struct Record {
+        const std::string* name;
+        AttrType type;
+        Reader payload;
+    };
+
+    /// \brief Returns the reader of the attribute payload, nullptr if the attribute wasn't stored
+    Reader* find(const std::string& name, AttrType type) {
+        for (auto& record : m_records) {
+            if (*record.name == name) {
+                OPENVINO_ASSERT(record.type == type, "Binary IR attribute ", name, " has unexpected type");
+                return &record.payload;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    void read_scalar(const std::string& name, ov::ValueAccessor<T>& adapter) {
+        if (auto reader = find(name, ov::binary_ir::AttrTypeOf<T>::scalar()))
+            adapter.set(reader->template read<T>());
+    }
+
+    template <typename T>
+    void read_vector(const std::string& name, ov::ValueAccessor<std::vector<T>>& adapter) {
+        if (auto reader = find(name, ov::binary_ir::AttrTypeOf<T>::vector()))
+            adapter.set(reader->template read_vector<T>());
+    }
+
+    template <typename Container>
+    Container read_strings(Reader& reader) {
+        Container values;
+        const auto count = reader.read<uint64_t>();
+        for (uint64_t i = 0; i < count; ++i) {
+            values.insert(values.end(), m_deserializer.get_string(reader.read<uint32_t>()));
+        }
+        return values;
+    }
+
+    ov::BinaryDeserializer& m_deserializer;
+    std::vector<Record> m_records;
+};
+
+void BinaryAttributeReader::on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) {
+    using ov::op::util::MultiSubGraphOp;
+    using PortDescription = ov::binary_ir::PortDescription;
+
+    if (auto a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+        if (auto reader = find(name, AttrType::PARTIAL_SHAPE))
+            a->set(m_deserializer.read_partial_shape(*reader));
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+        if (auto reader = find(name, AttrType::DIMENSION)) {
+            const auto min = reader->read<int64_t>();
+            const auto max = reader->read<int64_t>();
+            a->set(ov::Dimension(min, max));
+        }
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+        if (auto reader = find(name, AttrType::TYPE_VECTOR)) {
+            ov::element::TypeVector types;
+            for (const auto& type : read_strings<std::vector<std::string>>(*reader)) {
+                types.emplace_back(type);
+            }
+            a->set(types);
+        }
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+        if (auto reader = find(name, AttrType::STRING_SET))
+            a->set(read_strings<std::set<std::string>>(*reader));
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+        if (auto reader = find(name, AttrType::VARIABLE)) {
+            ov::op::util::VariableInfo info;
+            info.variable_id = m_deserializer.get_string(reader->read<uint32_t>());
+            info.data_type = ov::element::Type(m_deserializer.get_string(reader->read<uint32_t>()));
+            info.data_shape = m_deserializer.read_partial_shape(*reader);
+            a->set(m_deserializer.get_variable(info));
+        }
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>>(&adapter)) {
+        if (auto reader = find(name, AttrType::BUFFER)) {
+            const auto offset = reader->read<uint64_t>();
+            const auto size = reader->read<uint64_t>();
+            a->set(m_deserializer.get_weights(offset, size));
+        }
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>>(&adapter)) {
+        if (auto reader = find(name, AttrType::STRING_BUFFER)) {
+            const auto offset = reader->read<uint64_t>();
+            const auto size = reader->read<uint64_t>();
+            const auto weights = m_deserializer.get_weights(offset, size);
+            a->set(ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>::unpack_string_tensor(
+                weights->get_ptr<char>(),
+                weights->size()));
+        }
+    } else if (auto a = ov::as_type<
+                   ov::AttributeAdapter<std::vector<std::shared_ptr<MultiSubGraphOp::InputDescription>>>>(&adapter)) {
+        if (auto reader = find(name, AttrType::INPUT_DESCRIPTIONS)) {
+            std::vector<std::shared_ptr<MultiSubGraphOp::InputDescription>> descriptions;
+            const auto count = reader->read<uint64_t>();
+            for (uint64_t i = 0; i < count; ++i) {
+                const auto kind = reader->read<PortDescription>();
+                const auto input_index = reader->read<uint64_t>();
+                const auto body_parameter_index = reader->read<uint64_t>();
+                if (kind == PortDescription::SLICE_INPUT) {
+                    const auto start = reader->read<int64_t>();
+                    const auto stride = reader->read<int64_t>();
+                    const auto part_size = reader->read<int64_t>();
+                    const auto end = reader->read<int64_t>();
+                    const auto axis = reader->read<int64_t>();
+                    descriptions.push_back(std::make_shared<MultiSubGraphOp::SliceInputDescription>(input_index,
+                                                                                                    body_parameter_index,
+                                                                                                    start,
+                                                                                                    stride,
+                                                                                                    part_size,
+                                                                                                    end,
+                                                                                                    axis));
+                } else if (kind == PortDescription::MERGED_INPUT) {
+                    const auto body_value_index = reader->read<uint64_t>();
+                    descriptions.push_back(std::make_shared<MultiSubGraphOp::MergedInputDescription>(input_index,
+                                                                                                     body_parameter_index,
+                                                                                                     body_value_index));
+                } else if (kind == PortDescription::INVARIANT_INPUT) {
+                    descriptions.push_back(
+                        std::make_shared<MultiSubGraphOp::InvariantInputDescription>(input_index, body_parameter_index));
+                } else {
+                    OPENVINO_THROW("Binary IR is corrupted: unknown input description of ", name);
+                }
+            }
+            a->set(descriptions);
+        }
+    } else if (auto a = ov::as_type<
+                   ov::AttributeAdapter<std::vector<std::shared_ptr<MultiSubGraphOp::OutputDescription>>>>(&adapter)) {
+        if (auto reader = find(name, AttrType::OUTPUT_DESCRIPTIONS)) {
+            std::vector<std::shared_ptr<MultiSubGraphOp::OutputDescription>> descriptions;
+            const auto count = reader->read<uint64_t>();
+            for (uint64_t i = 0; i < count; ++i) {
+                const auto kind = reader->read<PortDescription>();
+                const auto body_value_index = reader->read<uint64_t>();
+                const auto output_index = reader->read<uint64_t>();
+                if (kind == PortDescription::CONCAT_OUTPUT) {
+                    const auto start = reader->read<int64_t>();
+                    const auto stride = reader->read<int64_t>();
+                    const auto part_size = reader->read<int64_t>();
+                    const auto end = reader->read<int64_t>();
+                    const auto axis = reader->read<int64_t>();
+                    descriptions.push_back(std::make_shared<MultiSubGraphOp::ConcatOutputDescription>(body_value_index,
+                                                                                                      output_index,
+                                                                                                      start,
+                                                                                                      stride,
+                                                                                                      part_size,
+                                                                                                      end,
+                                                                                                      axis));
+                } else if (kind == PortDescription::BODY_OUTPUT) {
+                    const auto iteration = reader->read<int64_t>();
+                    descriptions.push_back(std::make_shared<MultiSubGraphOp::BodyOutputDescription>(body_value_index,
+                                                                                                    output_index,
+                                                                                                    iteration));
+                } else {
+                    OPENVINO_THROW("Binary IR is corrupted: unknown output description of ", name);
+                }
+            }
+            a->set(descriptions);
+        }
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+        if (auto reader = find(name, AttrType::SPECIAL_BODY_PORTS)) {
+            const auto current_iteration_input_idx = reader->read<int64_t>();
+            const auto body_condition_output_idx = reader->read<int64_t>();
+            a->set(ov::op::v5::Loop::SpecialBodyPorts(current_iteration_input_idx, body_condition_output_idx));
+        }
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+        if (auto reader = find(name, AttrType::FRAMEWORK_NODE_ATTRS)) {
+            ov::op::util::FrameworkNodeAttrs attrs;
+            attrs.set_type_name(m_deserializer.get_string(reader->read<uint32_t>()));
+            attrs.set_opset_name(m_deserializer.get_string(reader->read<uint32_t>()));
+            const auto count = reader->read<uint64_t>();
+            for (uint64_t i = 0; i < count; ++i) {
+                const auto& key = m_deserializer.get_string(reader->read<uint32_t>());
+                attrs[key] = m_deserializer.get_string(reader->read<uint32_t>());
+            }
+            a->set(attrs);
+        }
+    } else {
+        OPENVINO_THROW("Error binary IR reading. Attribute adapter can not be found for ", name, " parameter");
+    }
+}
+
+}  // namespace
+
+ov::BinaryDeserializer::BinaryDeserializer(
+    const std::shared_ptr<ov::AlignedBuffer>& model,
+    const std::unordered_map<std::string, ov::OpSet>& opsets,
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+    : m_model(model),
+      m_opsets(opsets),
+      m_extensions(extensions) {
+    OPENVINO_ASSERT(m_model && is_binary_ir(m_model->get_ptr<char>(), m_model->size()), "Binary IR has wrong signature");
+    Reader reader(m_model->get_ptr<char>(), m_model->size());
+    m_header = reader.read<binary_ir::Header>();
+    OPENVINO_ASSERT(m_header.endianness == binary_ir::endianness_marker,
+                    "Binary IR was written on the platform with the different byte order");
+    OPENVINO_ASSERT(m_header.version == binary_ir::format_version,
+                    "Binary IR version ",
+                    m_header.version,
+                    " is not supported, expected version is ",
+                    binary_ir::format_version);
+    // the sum of the corrupted offset and size may overflow, so the bounds are checked by the subtraction
+    const auto in_file = [&](uint64_t offset, uint64_t size) {
+        return size <= m_model->size() && offset <= m_model->size() - size;
+    };
+    OPENVINO_ASSERT(in_file(m_header.weights_offset, m_header.weights_size) &&
+                        in_file(m_header.graph_offset, m_header.graph_size) &&
+                        m_header.strings_offset <= m_model->size(),
+                    "Binary IR is corrupted: sections are out of the file");
+
+    Reader strings(m_model->get_ptr<char>() + m_header.strings_offset, m_model->size() - m_header.strings_offset);
+    m_strings.reserve(m_header.strings_count);
+    for (uint64_t i = 0; i < m_header.strings_count; ++i) {
+        const auto size = strings.read<uint32_t>();
+        m_strings.emplace_back(strings.advance(size), size);
+    }
+}
+
+bool ov::BinaryDeserializer::is_binary_ir(const char* data, size_t size) {
+    return size >= sizeof(binary_ir::Header) && std::equal(std::begin(binary_ir::magic), std::end(binary_ir::magic), data);
+}
+
+std::shared_ptr<ov::Model> ov::BinaryDeserializer::read() {
+    Reader reader(m_model->get_ptr<char>() + m_header.graph_offset, m_header.graph_size);
+    return read_model(reader);
+}
+
+const std::string& ov::BinaryDeserializer::get_string(uint32_t id) const {
+    OPENVINO_ASSERT(id < m_strings.size(), "Binary IR is corrupted: string index is out of bounds");
+    return m_strings[id];
+}
+
+std::shared_ptr<ov::op::util::Variable> ov::BinaryDeserializer::get_variable(
+    const ov::op::util::VariableInfo& info) {
+    auto& variable = m_variables[info.variable_id];
+    if (!variable)
+        variable = std::make_shared<ov::op::util::Variable>(info);
+    return variable;
+}
+
+std::shared_ptr<ov::AlignedBuffer> ov::BinaryDeserializer::get_weights(uint64_t offset, uint64_t size) const {
+    OPENVINO_ASSERT(size <= m_header.weights_size && offset <= m_header.weights_size - size,
+                    "Binary IR is corrupted: weights are out of bounds");
+    char* data = m_model->get_ptr<char>() + m_header.weights_offset + offset;
+    return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(data, size, m_model);
+}
+
+ov::PartialShape ov::BinaryDeserializer::read_partial_shape(Reader& reader) const {
+    const auto rank = reader.read<int64_t>();
+    if (rank < 0)
+        return ov::PartialShape::dynamic();
+    std::vector<ov::Dimension> dims;
+    dims.reserve(static_cast<size_t>(rank));
+    for (int64_t i = 0; i < rank; ++i) {
+        const auto min = reader.read<int64_t>();
+        const auto max = reader.read<int64_t>();
+        dims.emplace_back(min, max);
+    }
+    return ov::PartialShape(dims);
+}
+
+std::shared_ptr<ov::Model> ov::BinaryDeserializer::read_model(Reader& reader) {
+    const auto& name = get_string(reader.read<uint32_t>());
+    const auto nodes_count = reader.read<uint32_t>();
+    std::vector<std::shared_ptr<ov::Node>> nodes;
+    nodes.reserve(nodes_count);
+    for (uint32_t i = 0; i < nodes_count; ++i) {
+        nodes.push_back(read_node(reader, nodes));
+    }
+
+    const auto read_nodes = [&]() {
+        std::vector<std::shared_ptr<ov::Node>> result(reader.read<uint32_t>());
+        for (auto& node : result) {
+            const auto id = reader.read<uint32_t>();
+            OPENVINO_ASSERT(id < nodes.size(), "Binary IR is corrupted: node index is out of bounds");
+            node = nodes[id];
+        }
+        return result;
+    };
+    ov::ParameterVector parameters;
+    for (const auto& node : read_nodes()) {
+        parameters.push_back(ov::as_type_ptr<ov::op::v0::Parameter>(node));
+        OPENVINO_ASSERT(parameters.back(), "Binary IR is corrupted: ", node, " is not a Parameter");
+    }
+    ov::ResultVector results;
+    for (const auto& node : read_nodes()) {
+        results.push_back(ov::as_type_ptr<ov::op::v0::Result>(node));
+        OPENVINO_ASSERT(results.back(), "Binary IR is corrupted: ", node, " is not a Result");
+    }
+    ov::SinkVector sinks;
+    for (const auto& node : read_nodes()) {
+        sinks.push_back(std::dynamic_pointer_cast<ov::op::Sink>(node));
+        OPENVINO_ASSERT(sinks.back(), "Binary IR is corrupted: ", node, " is not a Sink");
+    }
+
+    auto model = std::make_shared<ov::Model>(results, sinks, parameters, name);
+
+    std::unordered_map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
+    for (const auto& node : nodes) {
+        if (const auto& read_value = std::dynamic_pointer_cast<ov::op::util::ReadValueBase>(node)) {
+            variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+        }
+    }
+    for (const auto& sink : sinks) {
+        if (const auto& assign = std::dynamic_pointer_cast<ov::op::util::AssignBase>(sink)) {
+            const auto read_value = variable_id_to_read_value.find(assign->get_variable_id());
+            if (read_value != variable_id_to_read_value.end())
+                assign->add_control_dependency(read_value->second);
+        }
+    }
+
+    read_meta(reader, model->get_rt_info());
+    return model;
+}
+
+std::shared_ptr<ov::Node> ov::BinaryDeserializer::read_node(Reader& reader,
+                                                            const std::vector<std::shared_ptr<ov::Node>>& nodes) {
+    const auto& type_name = get_string(reader.read<uint32_t>());
+    const auto& opset_name = get_string(reader.read<uint32_t>());
+    const auto& friendly_name = get_string(reader.read<uint32_t>());
+
+    ov::OutputVector inputs(reader.read<uint32_t>());
+    std::vector<ov::RTMap> inputs_rt_info(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const auto node_id = reader.read<uint32_t>();
+        const auto output_id = reader.read<uint32_t>();
+        OPENVINO_ASSERT(node_id < nodes.size() && output_id < nodes[node_id]->get_output_size(),
+                        "Binary IR is corrupted: input ",
+                        i,
+                        " of ",
+                        friendly_name,
+                        " refers to the missing node");
+        inputs[i] = nodes[node_id]->output(output_id);
+        read_rt_info(reader, inputs_rt_info[i]);
+    }
+
+    std::vector<OutputInfo> outputs(reader.read<uint32_t>());
+    for (auto& output : outputs) {
+        output.type = ov::element::Type(get_string(reader.read<uint32_t>()));
+        output.shape = read_partial_shape(reader);
+        const auto names_count = reader.read<uint32_t>();
+        for (uint32_t i = 0; i < names_count; ++i) {
+            output.names.insert(get_string(reader.read<uint32_t>()));
+        }
+        read_rt_info(reader, output.rt_info);
+    }
+
+    ov::RTMap rt_info;
+    read_rt_info(reader, rt_info);
+
+    BinaryAttributeReader visitor(*this, reader);
+
+    std::shared_ptr<ov::Node> node;
+    const ov::DiscreteTypeInfo type_info(type_name.c_str(), opset_name.c_str());
+    const auto extension_it = m_extensions.find(type_info);
+    const auto opset_it = m_opsets.find(opset_name);
+    if (extension_it != m_extensions.end()) {
+        node = extension_it->second->create(inputs, visitor).at(0).get_node_shared_ptr();
+    } else if (opset_it != m_opsets.end() && opset_it->second.contains_type_insensitive(type_name)) {
+        node = std::shared_ptr<ov::Node>(opset_it->second.create_insensitive(type_name));
+        // Share weights from the model buffer
+        if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node)) {
+            constant->alloc_buffer_on_visit_attributes(false);
+        }
+        node->set_arguments(inputs);
+        if (node->visit_attributes(visitor)) {
+            node->constructor_validate_and_infer_types();
+        }
+    } else if (m_extensions.count(ov::op::util::FrameworkNode::get_type_info_static())) {
+        node = std::make_shared<ov::op::util::FrameworkNode>(inputs);
+        node->visit_attributes(visitor);
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            node->set_output_type(i, outputs[i].type, outputs[i].shape);
+        }
+    } else {
+        OPENVINO_THROW("Cannot create ", type_name, " layer ", friendly_name, " from unsupported opset: ", opset_name);
+    }
+
+    node->set_friendly_name(friendly_name);
+    node->get_rt_info().insert(rt_info.begin(), rt_info.end());
+    for (size_t i = 0; i < outputs.size() && i < node->get_output_size(); ++i) {
+        if (!outputs[i].names.empty())
+            node->get_output_tensor(i).set_names(outputs[i].names);
+        node->output(i).get_rt_info().insert(outputs[i].rt_info.begin(), outputs[i].rt_info.end());
+    }
+    for (size_t i = 0; i < inputs_rt_info.size() && i < node->get_input_size(); ++i) {
+        node->input(i).get_rt_info().insert(inputs_rt_info[i].begin(), inputs_rt_info[i].end());
+    }
+    return node;
+}
+
+void ov::BinaryDeserializer::read_rt_info(Reader& reader, ov::RTMap& rt_info) {
+    const auto count = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto& name = get_string(reader.read<uint32_t>());
+        const auto& version = get_string(reader.read<uint32_t>());
+        // the attributes table has to be read even if the attribute is unknown to skip it
+        BinaryAttributeReader visitor(*this, reader);
+        const ov::DiscreteTypeInfo type_info(name.c_str(), version.c_str());
+        auto attr = m_attrs_factory.create_by_type_info(type_info);
+        // As runtime attributes are optional, the unknown ones are skipped to load the model written by the newer
+        // version of OpenVINO
+        if (attr.empty() || !attr.is<ov::RuntimeAttribute>())
+            continue;
+        OPENVINO_ASSERT(attr.as<ov::RuntimeAttribute>().visit_attributes(visitor),
+                        "VisitAttributes is not supported for: ",
+                        name,
+                        " attribute");
+        rt_info.emplace(type_info, attr);
+    }
+}
+
+void ov::BinaryDeserializer::read_meta(Reader& reader, ov::AnyMap& map) const {
+    const auto count = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto& key = get_string(reader.read<uint32_t>());
+        const auto kind = reader.read<binary_ir::RtInfoValue>();
+        if (kind == binary_ir::RtInfoValue::MAP) {
+            ov::AnyMap sub_map;
+            read_meta(reader, sub_map);
+            map[key] = sub_map;
+        } else {
+            map[key] = get_string(reader.read<uint32_t>());
+        }
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "openvino/core/binary_ir_format.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/op_extension.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/opsets/opset.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "transformations/rt_info/attributes.hpp"
+
+namespace ov {
+
+/// \brief Builds ov::Model from the compact binary graph format written by ov::pass::BinarySerialize.
+/// The attributes are read from the flat tables without any text parsing and the constants share the memory of
+/// the model buffer, so the buffer is kept alive by the constants.
+class BinaryDeserializer {
+public:
+    BinaryDeserializer(const std::shared_ptr<ov::AlignedBuffer>& model,
+                       const std::unordered_map<std::string, ov::OpSet>& opsets,
+                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
+
+    /// \brief Checks the signature of the binary graph format
+    static bool is_binary_ir(const char* data, size_t size);
+
+    std::shared_ptr<ov::Model> read();
+
+    const std::string& get_string(uint32_t id) const;
+
+    std::shared_ptr<ov::Model> read_model(binary_ir::Reader& reader);
+
+    std::shared_ptr<ov::op::util::Variable> get_variable(const ov::op::util::VariableInfo& info);
+
+    /// \brief Returns the buffer sharing the memory of the weights section
+    std::shared_ptr<ov::AlignedBuffer> get_weights(uint64_t offset, uint64_t size) const;
+
+    ov::PartialShape read_partial_shape(binary_ir::Reader& reader) const;
+
+private:
+    struct OutputInfo {
+        ov::element::Type type;
+        ov::PartialShape shape;
+        std::unordered_set<std::string> names;
+        ov::RTMap rt_info;
+    };
+
+    std::shared_ptr<ov::Node> read_node(binary_ir::Reader& reader, const std::vector<std::shared_ptr<ov::Node>>& nodes);
+
+    void read_rt_info(binary_ir::Reader& reader, ov::RTMap& rt_info);
+
+    void read_meta(binary_ir::Reader& reader, ov::AnyMap& map) const;
+
+    std::shared_ptr<ov::AlignedBuffer> m_model;
+    binary_ir::Header m_header;
+    std::vector<std::string> m_strings;
+    const std::unordered_map<std::string, ov::OpSet>& m_opsets;
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& m_extensions;
+    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> m_variables;
+    ov::pass::Attributes m_attrs_factory;
+};
+
+}  // namespace ov
@@ -8,6 +8,7 @@
 #include <pugixml.hpp>
 #include <vector>
 
+#include "binary_deserializer.hpp"
 #include "input_model.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/so_extension.hpp"
@@ -59,6 +60,23 @@ size_t get_ir_version(std::istream& model) {
     return 0;
 }
 
+/**
+ * @brief Checks the signature of the binary graph format written by ov::pass::BinarySerialize
+ * @param model Models stream
+ * @return true if the stream contains the binary graph format
+ */
+bool is_binary_ir(std::istream& model) {
+    std::array<char, sizeof(ov::binary_ir::Header)> header{};
+
+    model.seekg(0, model.beg);
+    model.read(header.data(), header.size());
+    const auto read_size = static_cast<size_t>(model.gcount());
+    model.clear();
+    model.seekg(0, model.beg);
+
+    return ov::BinaryDeserializer::is_binary_ir(header.data(), read_size);
+}
+
 }  // namespace
 
 bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
@@ -92,8 +110,12 @@ bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
 
     size_t version;
     if (provided_model_stream) {
+        if (is_binary_ir(*provided_model_stream))
+            return true;
         version = get_ir_version(*provided_model_stream);
     } else if (local_model_stream.is_open()) {
+        if (is_binary_ir(local_model_stream))
+            return true;
         version = get_ir_version(local_model_stream);
         local_model_stream.close();
     } else {
@@ -186,6 +208,29 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     }
     bool enable_mmap = variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>() : false;
 
+    // The binary graph format keeps the weights in the same file, so the whole file is the model buffer
+    std::istream* model_stream = provided_model_stream ? provided_model_stream : &local_model_stream;
+    if ((provided_model_stream || local_model_stream.is_open()) && is_binary_ir(*model_stream)) {
+        std::shared_ptr<ov::AlignedBuffer> model_buffer;
+        if (enable_mmap && local_model_stream.is_open()) {
+            local_model_stream.close();
+            auto mapped_memory = ov::load_mmap_object(model_path);
+            model_buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
+                                                                                             mapped_memory->size(),
+                                                                                             mapped_memory);
+        } else {
+            model_stream->seekg(0, std::ios::end);
+            const size_t model_size = model_stream->tellg();
+            model_stream->seekg(0, std::ios::beg);
+            model_buffer = std::make_shared<ov::AlignedBuffer>(model_size);
+            model_stream->read(model_buffer->get_ptr<char>(), model_size);
+            OPENVINO_ASSERT(static_cast<size_t>(model_stream->gcount()) == model_size, "Failed to read the model");
+            if (local_model_stream.is_open())
+                local_model_stream.close();
+        }
+        return std::make_shared<InputModel>(model_buffer, create_extensions_map());
+    }
+
     // Find weights if only path to xml was provided
     if (weights_path.empty()) {
         auto pos = model_path.rfind('.');
@@ -6,6 +6,7 @@
 
 #include <pugixml.hpp>
 
+#include "binary_deserializer.hpp"
 #include "ir_deserializer.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/validation_util.hpp"
@@ -201,6 +202,7 @@ namespace ir {
 
 class InputModel::InputModelIRImpl {
     std::shared_ptr<ov::AlignedBuffer> m_weights;
+    std::shared_ptr<ov::AlignedBuffer> m_binary_model;
     std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> m_extensions;
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
@@ -222,6 +224,15 @@ public:
         }
     }
 
+    InputModelIRImpl(const std::shared_ptr<ov::AlignedBuffer>& model,
+                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+        : m_binary_model(model),
+          m_extensions(extensions) {
+        for (const auto& it : ov::get_available_opsets()) {
+            m_opsets[it.first] = it.second();
+        }
+    }
+
     std::shared_ptr<ov::Model> convert();
 };
 
@@ -231,11 +242,24 @@ InputModel::InputModel(std::istream& stream,
     _impl = std::make_shared<InputModelIRImpl>(stream, weights, extensions);
 }
 
+InputModel::InputModel(const std::shared_ptr<ov::AlignedBuffer>& model,
+                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions) {
+    _impl = std::make_shared<InputModelIRImpl>(model, extensions);
+}
+
 std::shared_ptr<ov::Model> InputModel::convert() {
     return _impl->convert();
 }
 
 std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
+    if (m_binary_model) {
+        ov::BinaryDeserializer deserializer(m_binary_model, m_opsets, m_extensions);
+        auto model = deserializer.read();
+        // The binary graph format keeps the same operations set as the latest IR version
+        model->get_rt_info()["version"] = int64_t(11);
+        return model;
+    }
+
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
 
     // Load default opsets
@@ -24,6 +24,10 @@ public:
                const std::shared_ptr<ov::AlignedBuffer>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
 
+    /// \brief Creates the model from the buffer of the binary graph format, the constants share the buffer memory
+    InputModel(const std::shared_ptr<ov::AlignedBuffer>& model,
+               const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
+
     std::shared_ptr<Model> convert();
 };
 
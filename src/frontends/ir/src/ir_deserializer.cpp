@@ -4,11 +4,15 @@
 
 #include "ir_deserializer.hpp"
 
+#include <cerrno>
+#include <cstdlib>
+#include <exception>
 #include <pugixml.hpp>
 #include <regex>
 
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/loop.hpp"
@@ -25,6 +29,7 @@
 #include "openvino/util/xml_parse_utils.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
+#include "transformations/rt_info/weightless_caching_attributes.hpp"
 #include "utils.hpp"
 
 using namespace ov::util;
@@ -317,6 +322,7 @@ void ov::XmlDeserializer::on_adapter(const std::string& name, ov::ValueAccessor<
         std::string variable_id;
         if (!getStrAttribute(m_node.child("data"), name, variable_id))
             return;
+        std::lock_guard<std::mutex> lock(m_context->variables_mutex);
         if (!m_variables.count(variable_id)) {
             m_variables[variable_id] = std::make_shared<ov::op::util::Variable>(
                 ov::op::util::VariableInfo{ov::PartialShape::dynamic(), ov::element::dynamic, variable_id});
@@ -426,7 +432,13 @@ void ov::XmlDeserializer::on_adapter(const std::string& name, ov::ValueAccessor<
         if (body_node.empty()) {
             OPENVINO_THROW("TensorIterator has no body.");
         }
-        model = parse_function(m_node.child(name.c_str()), m_weights);
+        auto parsed = take_body(body_node);
+        if (parsed.model) {
+            model = std::move(parsed.model);
+            io_map = std::move(parsed.io_map);
+        } else {
+            model = parse_function(body_node, m_weights);
+        }
     } else if (!name.compare("net")) {
         model = parse_function(m_node, m_weights);
     } else {
@@ -461,19 +473,63 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
-    // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
-        params[node_param.layerId] = {node, node_param};
-        if (node_param.type == "Result" || node_param.type == "Assign") {
-            outputs.push_back(node_param.layerId);
+
+    std::vector<pugi::xml_node> layers;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layers.push_back(node); }
+
+    // Large sub-bodies are independent of the enclosing model, so they are parsed in parallel,
+    // the ones not taken by the layers are released on exit even if the parsing of the model fails
+    const auto parsed_bodies = parse_bodies(layers, weights);
+    struct BodiesGuard {
+        XmlDeserializer& deserializer;
+        const std::vector<pugi::xml_node>& bodies;
+        ~BodiesGuard() {
+            for (const auto& body : bodies) {
+                deserializer.take_body(body);
+            }
+        }
+    } bodies_guard{*this, parsed_bodies};
+
+    // Read all layers parameters, the layers of a large model are split into the chunks parsed in parallel
+    const size_t chunk_size = 512;
+    const size_t chunks_num = std::min<size_t>((layers.size() + chunk_size - 1) / chunk_size,
+                                               static_cast<size_t>(std::max(1, parallel_get_max_threads())));
+    std::vector<std::vector<NodeParams>> chunks(chunks_num);
+    std::vector<std::exception_ptr> chunk_errors(chunks_num);
+    ov::parallel_for(chunks_num, [&](size_t chunk_idx) {
+        const auto begin = layers.size() * chunk_idx / chunks_num;
+        const auto end = layers.size() * (chunk_idx + 1) / chunks_num;
+        // the exceptions must not leave the threads of the parallel runtime
+        try {
+            chunks[chunk_idx].reserve(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                chunks[chunk_idx].push_back({layers[i], parse_generic_params(layers[i])});
+            }
+        } catch (...) {
+            chunk_errors[chunk_idx] = std::current_exception();
         }
-        if (node_param.type == "Parameter") {
-            // Save Parameters order according to order in XML.
-            // To do so, handle nodes manually and ignore during DFS
-            dfs_used_nodes.insert(node_param.layerId);
-            order.push_back(node_param.layerId);
-            edges[node_param.layerId] = {};
+    });
+    for (const auto& error : chunk_errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    // Store the parameters in params map following the order of the layers in XML
+    for (auto& chunk : chunks) {
+        for (auto& node_param : chunk) {
+            const auto layer_id = node_param.params.layerId;
+            const auto& type = *node_param.params.type;
+            if (type == "Result" || type == "Assign") {
+                outputs.push_back(layer_id);
+            }
+            if (type == "Parameter") {
+                // Save Parameters order according to order in XML.
+                // To do so, handle nodes manually and ignore during DFS
+                dfs_used_nodes.insert(layer_id);
+                order.push_back(layer_id);
+                edges[layer_id] = {};
+            }
+            params[layer_id] = std::move(node_param);
         }
     }
 
@@ -504,20 +560,24 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
 
     //  Following topological order create OpenVINO operations
     for (auto& layer_id : order) {
-        auto& p = params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
             continue;
+        const auto paramsIt = params.find(layer_id);
+        if (paramsIt == params.end()) {
+            OPENVINO_THROW("Attempt to access node ", layer_id, " that not in graph.");
+        }
+        auto& p = paramsIt->second;
         ov::OutputVector inputs(edgeIt->second.size());
         for (auto& e : edgeIt->second) {
             auto input_node = id_to_node[e.fromLayerId];
             if (!input_node) {
                 OPENVINO_THROW("Attempt to access node ", e.fromLayerId, " that not in graph.");
             }
-            auto& p_output = params[e.fromLayerId].params;
+            auto& p_output = params.at(e.fromLayerId).params;
             size_t const realInputPortId = p.params.get_real_input_port_id(e.toPortId);
             if (realInputPortId >= inputs.size())
-                OPENVINO_THROW(p.params.type,
+                OPENVINO_THROW(*p.params.type,
                                " layer ",
                                p.params.name,
                                " with id: ",
@@ -584,6 +644,64 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     return function;
 }
 
+std::vector<pugi::xml_node> ov::XmlDeserializer::parse_bodies(const std::vector<pugi::xml_node>& layers,
+                                                               const std::shared_ptr<ov::AlignedBuffer>& weights) {
+    // Small bodies (e.g. RNN cells) are cheaper to parse in place with their layers
+    const size_t min_body_layers = 32;
+
+    std::vector<pugi::xml_node> body_layers;
+    std::vector<pugi::xml_node> bodies;
+    for (const auto& layer : layers) {
+        for (const auto& body_name : {"body", "then_body", "else_body"}) {
+            const auto body = layer.child(body_name);
+            if (body.empty())
+                continue;
+            size_t layers_num = 0;
+            FOREACH_CHILD (body_layer, body.child("layers"), "layer") { ++layers_num; }
+            if (layers_num < min_body_layers)
+                continue;
+            body_layers.push_back(layer);
+            bodies.push_back(body);
+        }
+    }
+    if (bodies.empty())
+        return {};
+
+    // the nested bodies are parsed by the same threads of the parallel runtime, so the threads are never
+    // oversubscribed, the exceptions must not leave these threads
+    std::vector<ParsedBody> parsed(bodies.size());
+    std::vector<std::exception_ptr> errors(bodies.size());
+    ov::parallel_for(bodies.size(), [&](size_t i) {
+        try {
+            XmlDeserializer visitor(body_layers[i], weights, m_opsets, m_extensions, m_variables, m_version, m_context);
+            parsed[i].model = visitor.parse_function(bodies[i], weights);
+            parsed[i].io_map = std::move(visitor.io_map);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    std::lock_guard<std::mutex> lock(m_context->bodies_mutex);
+    for (size_t i = 0; i < bodies.size(); i++) {
+        m_context->bodies[bodies[i].internal_object()] = std::move(parsed[i]);
+    }
+    return bodies;
+}
+
+ov::XmlDeserializer::ParsedBody ov::XmlDeserializer::take_body(const pugi::xml_node& body) {
+    std::lock_guard<std::mutex> lock(m_context->bodies_mutex);
+    auto it = m_context->bodies.find(body.internal_object());
+    if (it == m_context->bodies.end())
+        return {};
+    auto parsed = std::move(it->second);
+    m_context->bodies.erase(it);
+    return parsed;
+}
+
 class MetaDataParser : public ov::Meta {
 public:
     MetaDataParser(const std::string& name, const pugi::xml_node& meta) : m_name(name) {
@@ -699,18 +817,17 @@ void ov::XmlDeserializer::read_legacy_meta_data(const std::shared_ptr<ov::Model>
 }
 
 ov::GenericLayerParams ov::XmlDeserializer::parse_generic_params(const pugi::xml_node& node) {
-    const auto parsePort = [](const pugi::xml_node& parentNode,
-                              const GenericLayerParams& params,
-                              bool input) -> GenericLayerParams::LayerPortData {
+    const auto parsePort = [](const pugi::xml_node& parentNode, bool input) -> GenericLayerParams::LayerPortData {
         GenericLayerParams::LayerPortData port;
 
         port.portId = static_cast<size_t>(pugixml::get_uint64_attr(parentNode, "id"));
 
         FOREACH_CHILD (node, parentNode, "dim") {
-            int64_t dim = 0;
             const pugi::char_t* dimVal = node.child_value();
-            std::stringstream ss(dimVal);
-            if (!(ss >> dim) || dim < -1) {
+            char* dimEnd = nullptr;
+            errno = 0;
+            const int64_t dim = std::strtoll(dimVal, &dimEnd, 10);
+            if (dimEnd == dimVal || errno == ERANGE || dim < -1) {
                 OPENVINO_THROW("dimension (",
                                dimVal,
                                ") in node ",
@@ -749,19 +866,19 @@ ov::GenericLayerParams ov::XmlDeserializer::parse_generic_params(const pugi::xml
     GenericLayerParams params;
 
     params.layerId = static_cast<size_t>(pugixml::get_uint64_attr(node, "id"));
-    params.version = pugixml::get_str_attr(node, "version");
+    params.version = m_context->strings.intern(pugixml::get_str_attr(node, "version"));
 
-    params.type = pugixml::get_str_attr(node, "type");
+    params.type = m_context->strings.intern(pugixml::get_str_attr(node, "type"));
 
     params.name = pugixml::get_str_attr(node, "name");
 
     auto outNode = node.child("output");
     if (!outNode.empty()) {
-        FOREACH_CHILD (_cn, outNode, "port") { params.outputPorts.emplace_back(parsePort(_cn, params, false)); }
+        FOREACH_CHILD (_cn, outNode, "port") { params.outputPorts.emplace_back(parsePort(_cn, false)); }
     }
     auto inpNode = node.child("input");
     if (!inpNode.empty()) {
-        FOREACH_CHILD (_cn, inpNode, "port") { params.inputPorts.emplace_back(parsePort(_cn, params, true)); }
+        FOREACH_CHILD (_cn, inpNode, "port") { params.inputPorts.emplace_back(parsePort(_cn, true)); }
     }
     return params;
 }
@@ -787,7 +904,7 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
     // Check that inputs are correctly defined
     for (size_t i = 0; i < inputs.size(); i++) {
         if (!inputs[i].get_node())
-            OPENVINO_THROW(params.type,
+            OPENVINO_THROW(*params.type,
                            " layer ",
                            params.name,
                            " with id: ",
@@ -796,7 +913,7 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
                            i,
                            "!");
         if (ov::element::Type_t::undefined == inputs[i].get_element_type())
-            OPENVINO_THROW(params.type,
+            OPENVINO_THROW(*params.type,
                            " layer ",
                            params.name,
                            " with id: ",
@@ -806,19 +923,19 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
                            "!");
     }
 
-    const std::string& type_name = translate_type_name(params.type);
+    const std::string& type_name = translate_type_name(*params.type);
 
     std::shared_ptr<ov::Node> ovNode;
-    ov::DiscreteTypeInfo type(type_name.c_str(), params.version.c_str());
+    ov::DiscreteTypeInfo type(type_name.c_str(), params.version->c_str());
     auto extensionIt = m_extensions.find(type);
 
     if (extensionIt != m_extensions.end()) {
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version, m_context);
         ovNode = (*extensionIt->second).create(inputs, visitor).at(0).get_node_shared_ptr();
     }
 
     // Find registered opset
-    auto opsetIt = m_opsets.find(params.version);
+    auto opsetIt = m_opsets.find(*params.version);
 
     // Try to create operation from loaded opsets
     static const std::unordered_set<std::string> experimental_ops_added_to_opset = {
@@ -832,24 +949,24 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
         "Proposal"};
 
     if (experimental_ops_added_to_opset.count(type_name) &&
-        (params.version == "experimental" || params.version == "extension")) {
+        (*params.version == "experimental" || *params.version == "extension")) {
         opsetIt = m_opsets.find("opset6");
     }
 
     if (!ovNode && opsetIt != m_opsets.end()) {
-        if (params.version == "opset1") {
+        if (*params.version == "opset1") {
             // MVN, ROIPooling and ReorgYolo were missing in opset1
             if (type_name == "MVN" || type_name == "ROIPooling" || type_name == "ReorgYolo") {
                 opsetIt = m_opsets.find("opset2");
                 if (opsetIt == m_opsets.end()) {
                     OPENVINO_THROW("Cannot create ",
-                                   params.type,
+                                   *params.type,
                                    " layer ",
                                    params.name,
                                    " id:",
                                    params.layerId,
                                    " from unsupported opset: ",
-                                   params.version);
+                                   *params.version);
                 }
             }
         }
@@ -858,14 +975,14 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
 
         ovNode = std::shared_ptr<ov::Node>(opset.create_insensitive(type_name));
         if (!ovNode) {
-            OPENVINO_THROW("Opset ", params.version, " doesn't contain the operation with type: ", type_name);
+            OPENVINO_THROW("Opset ", *params.version, " doesn't contain the operation with type: ", type_name);
         }
         // Share Weights form constant blob
         if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(ovNode)) {
             constant->alloc_buffer_on_visit_attributes(false);
         }
         ovNode->set_arguments(inputs);
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version, m_context);
 
         if (ovNode->visit_attributes(visitor)) {
             ovNode->constructor_validate_and_infer_types();
@@ -876,7 +993,7 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
     }
     if (!ovNode && m_extensions.count(ov::op::util::FrameworkNode::get_type_info_static())) {
         ovNode = std::make_shared<ov::op::util::FrameworkNode>(inputs);
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version, m_context);
         ovNode->visit_attributes(visitor);
 
         size_t index{0};
@@ -888,13 +1005,13 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
 
     if (!ovNode) {
         OPENVINO_THROW("Cannot create ",
-                       params.type,
+                       *params.type,
                        " layer ",
                        params.name,
                        " id:",
                        params.layerId,
                        " from unsupported opset: ",
-                       params.version);
+                       *params.version);
     }
 
     // Save run time info
@@ -909,6 +1026,15 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
         if (aw_data) {
             rtInfo["alt_width"] = aw_data.value();
         }
+        // keep the location of the constant data in the weights, so the device may refer to it instead of a copy
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(ovNode);
+        if (constant && m_weights && constant->get_element_type() != ov::element::string && dn.attribute("offset") &&
+            dn.attribute("size")) {
+            rtInfo[ov::WeightlessCacheAttribute::get_type_info_static()] =
+                ov::WeightlessCacheAttribute(static_cast<size_t>(pugixml::get_uint64_attr(dn, "size")),
+                                             static_cast<size_t>(pugixml::get_uint64_attr(dn, "offset")),
+                                             constant->get_element_type());
+        }
     }
 
     ovNode->set_friendly_name(params.name);
@@ -7,7 +7,9 @@
 #include <cctype>
 #include <istream>
 #include <memory>
+#include <mutex>
 #include <pugixml.hpp>
+#include <unordered_set>
 
 #include "input_model.hpp"
 #include "openvino/core/attribute_visitor.hpp"
@@ -19,6 +21,20 @@
 
 namespace ov {
 
+/// \brief Thread safe storage of the single copies of the strings repeated across the layers,
+/// e.g. layer types and opset versions. The returned strings are valid while the pool exists.
+class StringPool {
+public:
+    const std::string* intern(const std::string& str) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return &*m_strings.emplace(str).first;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::unordered_set<std::string> m_strings;
+};
+
 struct GenericLayerParams {
     struct LayerPortData {
         size_t portId;
@@ -27,9 +43,10 @@ struct GenericLayerParams {
         std::unordered_set<std::string> names;
     };
     size_t layerId;
-    std::string version;
+    // version and type point to the strings interned in the pool shared by the model and its bodies
+    const std::string* version = nullptr;
     std::string name;
-    std::string type;
+    const std::string* type = nullptr;
     std::vector<LayerPortData> inputPorts;
     std::vector<LayerPortData> outputPorts;
 
@@ -64,12 +81,7 @@ public:
                              const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                              std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
                              size_t version)
-        : m_node(node),
-          m_weights(weights),
-          m_opsets(opsets),
-          m_extensions(extensions),
-          m_variables(variables),
-          m_version(version) {}
+        : XmlDeserializer(node, weights, opsets, extensions, variables, version, std::make_shared<Context>()) {}
 
     void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& value) override {
         std::string val;
@@ -146,6 +158,36 @@ private:
         NodeIdToIoIndex outputs;
     };
 
+    struct ParsedBody {
+        std::shared_ptr<ov::Model> model;
+        IoMap io_map;
+    };
+
+    /// \brief State shared by the deserializers of the model and all its sub-bodies.
+    /// The sub-bodies may be parsed concurrently, so the access to the members is synchronized.
+    struct Context {
+        std::mutex variables_mutex;
+        StringPool strings;
+        std::mutex bodies_mutex;
+        // sub-bodies parsed before the layers of the enclosing model, the key is the xml node of the body
+        std::unordered_map<const pugi::xml_node_struct*, ParsedBody> bodies;
+    };
+
+    XmlDeserializer(const pugi::xml_node& node,
+                    const std::shared_ptr<ov::AlignedBuffer>& weights,
+                    const std::unordered_map<std::string, ov::OpSet>& opsets,
+                    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+                    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
+                    size_t version,
+                    const std::shared_ptr<Context>& context)
+        : m_node(node),
+          m_weights(weights),
+          m_opsets(opsets),
+          m_extensions(extensions),
+          m_variables(variables),
+          m_version(version),
+          m_context(context) {}
+
     /// \brief Traverses port_map in order to create vector of InputDescription shared_ptrs.
     /// Shall be used only for ops which have port_map attribute.
     /// \param node xml op representation
@@ -175,6 +217,14 @@ private:
 
     GenericLayerParams parse_generic_params(const pugi::xml_node& node);
 
+    /// \brief Parses the large sub-bodies of the layers in parallel with each other, before the layers of
+    /// the enclosing model are created.
+    /// \return xml nodes of the parsed sub-bodies
+    std::vector<pugi::xml_node> parse_bodies(const std::vector<pugi::xml_node>& layers,
+                                             const std::shared_ptr<ov::AlignedBuffer>& weights);
+    /// \brief Returns the parsed sub-body, the result is empty if the body wasn't parsed by parse_bodies
+    ParsedBody take_body(const pugi::xml_node& body);
+
     std::shared_ptr<ov::Node> create_node(const ov::OutputVector& inputs,
                                           const pugi::xml_node& node,
                                           const std::shared_ptr<ov::AlignedBuffer>& weights,
@@ -200,5 +250,6 @@ private:
     IoMap io_map;
 
     int64_t m_version;
+    std::shared_ptr<Context> m_context;
 };
 }  // namespace ov
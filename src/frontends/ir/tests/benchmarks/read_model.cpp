@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Read time benchmark of the IR frontend. A large model with TensorIterator bodies is saved to XML and binary IR
+// and read back with the parallel runtime limited to a single thread and with all its threads, so the gain of
+// the parallel deserialization is measured on the same machine.
+//
+// Usage: ov_ir_frontend_read_benchmark [iterations]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+constexpr size_t blocks_num = 2000;
+constexpr size_t bodies_num = 8;
+constexpr size_t body_blocks_num = 64;
+
+// Chain of Add + Relu blocks, each Add has own constant to make the model weights and layers count realistic
+ov::Output<ov::Node> make_blocks(ov::Output<ov::Node> input, size_t count) {
+    const auto shape = input.get_shape();
+    for (size_t i = 0; i < count; ++i) {
+        auto constant =
+            ov::opset8::Constant::create(ov::element::f32, shape, std::vector<float>(ov::shape_size(shape), 0.1f * i));
+        auto add = std::make_shared<ov::opset8::Add>(input, constant);
+        input = std::make_shared<ov::opset8::Relu>(add);
+    }
+    return input;
+}
+
+std::shared_ptr<ov::Model> make_model() {
+    const ov::Shape shape{1, 64};
+    auto parameter = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    auto output = make_blocks(parameter, blocks_num);
+
+    for (size_t i = 0; i < bodies_num; ++i) {
+        auto body_parameter = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto body_result = std::make_shared<ov::opset8::Result>(make_blocks(body_parameter, body_blocks_num));
+        auto body = std::make_shared<ov::Model>(ov::ResultVector{body_result}, ov::ParameterVector{body_parameter});
+
+        auto tensor_iterator = std::make_shared<ov::opset8::TensorIterator>();
+        tensor_iterator->set_body(body);
+        tensor_iterator->set_merged_input(body_parameter, output, body_result);
+        output = tensor_iterator->get_iter_value(body_result, -1);
+    }
+
+    auto result = std::make_shared<ov::opset8::Result>(output);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{parameter});
+}
+
+// Runs the function with the parallel runtime limited to a single thread
+template <typename Func>
+void run_single_threaded(const Func& func) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    tbb::task_arena arena(1);
+    arena.execute(func);
+#elif OV_THREAD == OV_THREAD_OMP
+    const auto threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    func();
+    omp_set_num_threads(threads);
+#else
+    func();
+#endif
+}
+
+// Reads the model several times and returns the sorted read times in ms
+std::vector<double> measure(ov::Core& core,
+                            const std::string& path,
+                            size_t ops_num,
+                            size_t iterations,
+                            bool single_threaded) {
+    std::vector<double> times;
+    for (size_t i = 0; i < iterations; ++i) {
+        std::shared_ptr<ov::Model> model;
+        const auto read = [&] {
+            model = core.read_model(path);
+        };
+        const auto start = std::chrono::steady_clock::now();
+        if (single_threaded) {
+            run_single_threaded(read);
+        } else {
+            read();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+        // the content is checked by the unit tests, here only the model is sanity checked
+        if (!model || model->get_ops().size() != ops_num)
+            OPENVINO_THROW("Model read from ", path, " doesn't match the reference");
+    }
+    std::sort(times.begin(), times.end());
+    return times;
+}
+
+void report(const std::string& format, const std::string& threads, const std::vector<double>& times) {
+    std::cout << format << ", " << threads << ": min " << times.front() << " ms, median " << times[times.size() / 2]
+              << " ms" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 5;
+    const std::string xml_path = "ir_read_benchmark.xml";
+    const std::string bin_path = "ir_read_benchmark.bin";
+    const std::string binary_path = "ir_read_benchmark.ovbin";
+
+    int status = 0;
+    try {
+        const auto model = make_model();
+        const auto ops_num = model->get_ops().size();
+        ov::save_model(model, xml_path, false);
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::BinarySerialize>(binary_path);
+        manager.run_passes(model);
+
+        std::cout << "read_model of " << ops_num << " layers, " << iterations << " iterations" << std::endl;
+        ov::Core core;
+        const auto threads = std::to_string(parallel_get_max_threads()) + " threads";
+        report("xml", "1 thread", measure(core, xml_path, ops_num, iterations, true));
+        report("xml", threads, measure(core, xml_path, ops_num, iterations, false));
+        report("binary", "1 thread", measure(core, binary_path, ops_num, iterations, true));
+        report("binary", threads, measure(core, binary_path, ops_num, iterations, false));
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        status = 1;
+    }
+
+    std::remove(xml_path.c_str());
+    std::remove(bin_path.c_str());
+    std::remove(binary_path.c_str());
+    return status;
+}
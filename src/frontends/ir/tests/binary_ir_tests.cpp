@@ -0,0 +1,275 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "frontend_test.hpp"
+#include "openvino/core/binary_ir_format.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "transformations/rt_info/fused_names_attribute.hpp"
+
+class IRFrontendBinaryIRTests : public ::testing::Test, public IRFrontendTestsImpl {
+protected:
+    std::string binaryFileName{};
+
+    void SetUp() override {
+        auto filePrefix = ov::test::utils::generateTestFilePrefix();
+        binaryFileName = filePrefix + "_IrFrontendBinaryModel.ovbin";
+    }
+
+    void TearDown() override {
+        std::remove(binaryFileName.c_str());
+    }
+
+    void serialize(const std::shared_ptr<ov::Model>& model) {
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::BinarySerialize>(binaryFileName);
+        manager.run_passes(model);
+    }
+
+    static void compare(const std::shared_ptr<ov::Model>& model, const std::shared_ptr<ov::Model>& model_ref) {
+        const auto fc = FunctionsComparator::with_default()
+                            .enable(FunctionsComparator::ATTRIBUTES)
+                            .enable(FunctionsComparator::PRECISIONS)
+                            .enable(FunctionsComparator::CONST_VALUES)
+                            .enable(FunctionsComparator::NAMES)
+                            .enable(FunctionsComparator::TENSOR_NAMES);
+        const auto res = fc.compare(model, model_ref);
+        ASSERT_TRUE(res.valid) << res.message;
+    }
+
+    std::shared_ptr<ov::Model> read(bool enable_mmap) {
+        core.set_property(ov::enable_mmap(enable_mmap));
+        return core.read_model(binaryFileName);
+    }
+};
+
+TEST_F(IRFrontendBinaryIRTests, conv_add_with_tensor_names) {
+    std::shared_ptr<ov::Model> model_ref;
+    {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, 3, 16, 16});
+        data->set_friendly_name("data");
+        data->output(0).set_names({"data", "input"});
+        auto weights = ov::opset8::Constant::create(ov::element::f32, {8, 3, 3, 3}, std::vector<float>(216, 0.5f));
+        auto conv = std::make_shared<ov::opset8::Convolution>(data,
+                                                              weights,
+                                                              ov::Strides{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::CoordinateDiff{1, 1},
+                                                              ov::Strides{1, 1});
+        conv->set_friendly_name("conv");
+        auto bias = ov::opset8::Constant::create(ov::element::f32, {1, 8, 1, 1}, {1, 2, 3, 4, 5, 6, 7, 8});
+        auto add = std::make_shared<ov::opset8::Add>(conv, bias);
+        add->output(0).set_names({"output"});
+        auto result = std::make_shared<ov::opset8::Result>(add);
+        model_ref = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data}, "conv_add");
+    }
+    serialize(model_ref);
+
+    for (const auto enable_mmap : {true, false}) {
+        std::shared_ptr<ov::Model> model;
+        ASSERT_NO_THROW(model = read(enable_mmap));
+        ASSERT_TRUE(!!model);
+        compare(model, model_ref);
+        EXPECT_EQ(model->get_friendly_name(), "conv_add");
+    }
+}
+
+TEST_F(IRFrontendBinaryIRTests, stream_input) {
+    std::shared_ptr<ov::Model> model_ref;
+    {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::i64, ov::PartialShape{{1, 10}, 4});
+        auto constant = ov::opset8::Constant::create(ov::element::i64, {4}, {1, 2, 3, 4});
+        auto mul = std::make_shared<ov::opset8::Multiply>(data, constant);
+        auto result = std::make_shared<ov::opset8::Result>(mul);
+        model_ref = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data});
+    }
+    std::stringstream stream;
+    ov::pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::BinarySerialize>(stream);
+    pass_manager.run_passes(model_ref);
+
+    ov::frontend::FrontEnd::Ptr FE;
+    ov::frontend::InputModel::Ptr input_model;
+    std::istream& model_stream = stream;
+    ov::AnyVector params{&model_stream};
+    ASSERT_NO_THROW(FE = manager.load_by_model(params));
+    ASSERT_TRUE(!!FE);
+    ASSERT_NO_THROW(input_model = FE->load(params));
+    ASSERT_TRUE(!!input_model);
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = FE->convert(input_model));
+    compare(model, model_ref);
+}
+
+TEST_F(IRFrontendBinaryIRTests, sub_graphs) {
+    std::shared_ptr<ov::Model> model_ref;
+    {
+        auto X = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 1, 16});
+        auto Y = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 1, 16});
+
+        auto Xi = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 1, 16});
+        auto Yi = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 1, 16});
+        auto body_add = std::make_shared<ov::opset8::Add>(Xi, Yi);
+        auto body_result = std::make_shared<ov::opset8::Result>(body_add);
+        auto body =
+            std::make_shared<ov::Model>(ov::ResultVector{body_result}, ov::ParameterVector{Xi, Yi}, "ti_body");
+
+        auto tensor_iterator = std::make_shared<ov::opset8::TensorIterator>();
+        tensor_iterator->set_body(body);
+        tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+        tensor_iterator->set_merged_input(Yi, Y, body_result);
+        auto ti_last = tensor_iterator->get_iter_value(body_result, -1);
+        auto ti_concat = tensor_iterator->get_concatenated_slices(body_result, 0, 1, 1, -1, 0);
+
+        auto cond = std::make_shared<ov::opset8::Parameter>(ov::element::boolean, ov::Shape{});
+        auto then_param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 1, 16});
+        auto then_result = std::make_shared<ov::opset8::Result>(std::make_shared<ov::opset8::Relu>(then_param));
+        auto then_body = std::make_shared<ov::Model>(ov::ResultVector{then_result}, ov::ParameterVector{then_param});
+        auto else_param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 1, 16});
+        auto else_result = std::make_shared<ov::opset8::Result>(std::make_shared<ov::opset8::Abs>(else_param));
+        auto else_body = std::make_shared<ov::Model>(ov::ResultVector{else_result}, ov::ParameterVector{else_param});
+        auto if_op = std::make_shared<ov::opset8::If>(cond);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(ti_last, then_param, else_param);
+        auto if_out = if_op->set_output(then_result, else_result);
+
+        model_ref = std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::opset8::Result>(if_out),
+                             std::make_shared<ov::opset8::Result>(ti_concat)},
+            ov::ParameterVector{X, Y, cond});
+    }
+    serialize(model_ref);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = read(true));
+    ASSERT_TRUE(!!model);
+    compare(model, model_ref);
+}
+
+TEST_F(IRFrontendBinaryIRTests, read_value_assign) {
+    std::shared_ptr<ov::Model> model_ref;
+    {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 8});
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{ov::PartialShape{1, 8}, ov::element::f32, "state"});
+        auto read_value = std::make_shared<ov::opset8::ReadValue>(data, variable);
+        auto add = std::make_shared<ov::opset8::Add>(read_value, data);
+        auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+        auto result = std::make_shared<ov::opset8::Result>(add);
+        model_ref = std::make_shared<ov::Model>(ov::ResultVector{result},
+                                                ov::SinkVector{assign},
+                                                ov::ParameterVector{data});
+    }
+    serialize(model_ref);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = read(false));
+    ASSERT_TRUE(!!model);
+    compare(model, model_ref);
+    ASSERT_EQ(model->get_sinks().size(), 1);
+    ASSERT_EQ(model->get_variables().size(), 1);
+    EXPECT_EQ(model->get_variables()[0]->get_info().variable_id, "state");
+}
+
+TEST_F(IRFrontendBinaryIRTests, string_constant) {
+    std::shared_ptr<ov::Model> model_ref;
+    {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::string, ov::Shape{3});
+        auto constant = std::make_shared<ov::opset8::Constant>(ov::element::string,
+                                                               ov::Shape{3},
+                                                               std::vector<std::string>{"first", "", "third"});
+        auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{data, constant}, 0);
+        auto result = std::make_shared<ov::opset8::Result>(concat);
+        model_ref = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data});
+    }
+    serialize(model_ref);
+
+    for (const auto enable_mmap : {true, false}) {
+        std::shared_ptr<ov::Model> model;
+        ASSERT_NO_THROW(model = read(enable_mmap));
+        ASSERT_TRUE(!!model);
+        compare(model, model_ref);
+    }
+}
+
+TEST_F(IRFrontendBinaryIRTests, rt_info) {
+    std::shared_ptr<ov::Model> model_ref;
+    {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3});
+        auto relu = std::make_shared<ov::opset8::Relu>(data);
+        relu->get_rt_info()[ov::FusedNames::get_type_info_static()] = ov::FusedNames("relu");
+        auto result = std::make_shared<ov::opset8::Result>(relu);
+        model_ref = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data});
+        model_ref->set_rt_info("value", "framework", "name");
+        model_ref->set_rt_info("1", "optimization", "level");
+    }
+    serialize(model_ref);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = read(true));
+    ASSERT_TRUE(!!model);
+    compare(model, model_ref);
+
+    for (const auto& op : model->get_ops()) {
+        if (ov::is_type<ov::opset8::Relu>(op)) {
+            EXPECT_EQ(ov::getFusedNames(op), "relu");
+        }
+    }
+    EXPECT_EQ(model->get_rt_info<std::string>("framework", "name"), "value");
+    EXPECT_EQ(model->get_rt_info<std::string>("optimization", "level"), "1");
+}
+
+TEST_F(IRFrontendBinaryIRTests, corrupted_file) {
+    std::shared_ptr<ov::Model> model_ref;
+    {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3});
+        auto result = std::make_shared<ov::opset8::Result>(std::make_shared<ov::opset8::Relu>(data));
+        model_ref = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data});
+    }
+    std::stringstream stream;
+    ov::pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::BinarySerialize>(stream);
+    pass_manager.run_passes(model_ref);
+
+    // Keep the signature and the header, but cut the graph
+    const auto truncated = stream.str().substr(0, stream.str().size() / 2);
+    {
+        std::ofstream file(binaryFileName, std::ios::binary);
+        file.write(truncated.data(), truncated.size());
+    }
+    OV_EXPECT_THROW(read(false), ov::Exception, testing::HasSubstr("Binary IR is corrupted"));
+}
+
+TEST_F(IRFrontendBinaryIRTests, overflowed_section_offset) {
+    std::shared_ptr<ov::Model> model_ref;
+    {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3});
+        auto result = std::make_shared<ov::opset8::Result>(std::make_shared<ov::opset8::Relu>(data));
+        model_ref = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data});
+    }
+    std::stringstream stream;
+    ov::pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::BinarySerialize>(stream);
+    pass_manager.run_passes(model_ref);
+
+    // The offset wraps around with the size to a value within the file
+    auto content = stream.str();
+    ov::binary_ir::Header header;
+    std::memcpy(&header, content.data(), sizeof(header));
+    header.graph_offset = std::numeric_limits<uint64_t>::max() - header.graph_size + 2;
+    std::memcpy(&content[0], &header, sizeof(header));
+    {
+        std::ofstream file(binaryFileName, std::ios::binary);
+        file.write(content.data(), content.size());
+    }
+    OV_EXPECT_THROW(read(false), ov::Exception, testing::HasSubstr("sections are out of the file"));
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "frontend_test.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
+
+class IRFrontendParallelDeserialization : public ::testing::Test, public IRFrontendTestsImpl {
+protected:
+    // enough layers to split the model into several chunks and the bodies large enough to be parsed in parallel
+    static constexpr size_t blocks_num = 600;
+    static constexpr size_t bodies_num = 4;
+    static constexpr size_t body_blocks_num = 20;
+
+    void SetUp() override {
+        auto filePrefix = ov::test::utils::generateTestFilePrefix();
+        xmlFileName = filePrefix + "_IrFrontendParallelDeserialization.xml";
+        binFileName = filePrefix + "_IrFrontendParallelDeserialization.bin";
+        binaryFileName = filePrefix + "_IrFrontendParallelDeserialization.ovbin";
+    }
+
+    void TearDown() override {
+        RemoveTemporalFiles();
+        std::remove(binaryFileName.c_str());
+    }
+
+    std::string binaryFileName;
+
+    // Chain of Add + Relu blocks, each Add has own constant
+    static ov::Output<ov::Node> make_blocks(ov::Output<ov::Node> input, size_t count) {
+        const auto shape = input.get_shape();
+        for (size_t i = 0; i < count; ++i) {
+            auto constant = ov::opset8::Constant::create(ov::element::f32,
+                                                         shape,
+                                                         std::vector<float>(ov::shape_size(shape), 0.1f * i));
+            auto add = std::make_shared<ov::opset8::Add>(input, constant);
+            input = std::make_shared<ov::opset8::Relu>(add);
+        }
+        return input;
+    }
+
+    static ov::Output<ov::Node> make_tensor_iterator(ov::Output<ov::Node> input, bool nested) {
+        auto body_parameter = std::make_shared<ov::opset8::Parameter>(ov::element::f32, input.get_shape());
+        auto body_output = make_blocks(body_parameter, body_blocks_num);
+        if (nested) {
+            body_output = make_tensor_iterator(body_output, false);
+        }
+        auto body_result = std::make_shared<ov::opset8::Result>(body_output);
+        auto body = std::make_shared<ov::Model>(ov::ResultVector{body_result}, ov::ParameterVector{body_parameter});
+
+        auto tensor_iterator = std::make_shared<ov::opset8::TensorIterator>();
+        tensor_iterator->set_body(body);
+        tensor_iterator->set_merged_input(body_parameter, input, body_result);
+        return tensor_iterator->get_iter_value(body_result, -1);
+    }
+
+    static std::shared_ptr<ov::Model> make_model() {
+        const ov::Shape shape{1, 16};
+        auto parameter = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto output = make_blocks(parameter, blocks_num);
+        for (size_t i = 0; i < bodies_num; ++i) {
+            output = make_tensor_iterator(output, i % 2 == 0);
+        }
+        auto result = std::make_shared<ov::opset8::Result>(output);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{parameter});
+    }
+
+    void check(const std::string& path, const std::shared_ptr<ov::Model>& model_ref) {
+        std::shared_ptr<ov::Model> model;
+        ASSERT_NO_THROW(model = core.read_model(path));
+        ASSERT_TRUE(!!model);
+        const auto fc = FunctionsComparator::with_default()
+                            .enable(FunctionsComparator::ATTRIBUTES)
+                            .enable(FunctionsComparator::PRECISIONS)
+                            .enable(FunctionsComparator::CONST_VALUES);
+        const auto res = fc.compare(model, model_ref);
+        ASSERT_TRUE(res.valid) << res.message;
+    }
+};
+
+TEST_F(IRFrontendParallelDeserialization, large_model_with_bodies) {
+    const auto model_ref = make_model();
+    ov::save_model(model_ref, xmlFileName, false);
+    check(xmlFileName, model_ref);
+}
+
+TEST_F(IRFrontendParallelDeserialization, large_model_with_bodies_binary) {
+    const auto model_ref = make_model();
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::BinarySerialize>(binaryFileName);
+    manager.run_passes(model_ref);
+    check(binaryFileName, model_ref);
+}
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 
@@ -76,5 +77,21 @@ static constexpr Property<bool, PropertyMutability::RO> compiled_model_runtime_p
  */
 static constexpr Property<float, PropertyMutability::RW> query_model_ratio{"QUERY_MODEL_RATIO"};
 
+/**
+ * @brief Read-only property to check whether the plugin is able to import the model from the memory mapped cache blob
+ * passed via cached_model_buffer
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<bool, PropertyMutability::RO> caching_with_mmap{"CACHING_WITH_MMAP"};
+
+/**
+ * @brief Property to pass the buffer holding the whole cached blob to the import_model.
+ * The import stream is positioned inside the buffer, so the plugin may create views into the buffer
+ * instead of copying the data read from the stream. The buffer keeps the underlying memory (e.g. file mapping) alive.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<std::shared_ptr<ov::AlignedBuffer>, PropertyMutability::RW> cached_model_buffer{
+    "CACHED_MODEL_BUFFER"};
+
 }  // namespace internal
 }  // namespace ov
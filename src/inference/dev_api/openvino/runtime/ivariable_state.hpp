@@ -51,6 +51,14 @@ public:
      */
     virtual ov::SoPtr<ov::ITensor> get_state() const;
 
+    /**
+     * @brief Sets the state to the first @p length elements of the @p source state along the sequence axis
+     * @note The default implementation throws ov::NotImplemented
+     * @param source A variable state of another infer request of the same compiled model
+     * @param length The number of elements to take from the source state
+     */
+    virtual void fork(const std::shared_ptr<ov::IVariableState>& source, size_t length);
+
 protected:
     /**
      * @brief A default dtor
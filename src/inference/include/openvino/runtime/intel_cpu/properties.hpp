@@ -63,5 +63,193 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines the number of tokens stored in one page of the runtime managed KV cache
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When the value is greater than zero, KV cache variables of stateful LLM models are stored in pages allocated
+ * from a page pool shared by all the infer requests of the compiled model instead of a contiguous per request buffer.
+ * The pages are returned to the pool when the state is reset. Zero (default) disables the paged KV cache.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::kv_cache_page_size(32));
+ * @endcode
+ */
+static constexpr Property<uint64_t> kv_cache_page_size{"CPU_KV_CACHE_PAGE_SIZE"};
+
+/**
+ * @brief This property defines the number of channels sharing one scale and zero point in the quantized KV cache
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The property takes effect when ov::hint::kv_cache_precision is u8 or u4. Zero (default) quantizes each head of
+ * a token as a whole. The value must divide the head size, and be a multiple of 16 for u4, otherwise the whole head
+ * is used as one group.
+ *
+ * @code
+ * core.set_property(ov::hint::kv_cache_precision(ov::element::u4));
+ * core.set_property(ov::intel_cpu::kv_cache_group_size(32));
+ * @endcode
+ */
+static constexpr Property<uint64_t> kv_cache_group_size{"CPU_KV_CACHE_GROUP_SIZE"};
+
+/**
+ * @brief This property defines whether the nodes of the static graphs are executed in the dataflow order
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When the property is set to true, a node is started as soon as all the nodes it depends on are done, so the
+ * independent branches of the model are executed concurrently by the threads of the stream, which share the threads
+ * between the running nodes by work stealing. The intermediate tensors of the concurrent branches are not placed
+ * to the same memory and every node has its own scratch pad, so the memory consumption is higher than in the
+ * default sequential mode. The dynamic and the stateful models and the models with the nested bodies are always
+ * executed sequentially, the property of the compiled model is true only if its graph uses the dataflow execution.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::dataflow_execution(true));
+ * @endcode
+ */
+static constexpr Property<bool> dataflow_execution{"CPU_DATAFLOW_EXECUTION"};
+
+/**
+ * @brief This property defines whether the inferences of the static graphs replay the execution plan
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When the property is set to true, the first inference of a static graph builds the flat list of its nodes, where
+ * the nodes executing a single oneDNN primitive keep the primitive with the pre-bound arguments. The following
+ * inferences replay this list, which reduces the per inference overhead for the small models. The plan bypasses
+ * the per node debug hooks, so it is not used when the performance counters are collected or the plugin is built
+ * with the debug capabilities. The default value is false.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::execution_plan_replay(true));
+ * @endcode
+ */
+static constexpr Property<bool> execution_plan_replay{"CPU_EXECUTION_PLAN_REPLAY"};
+
+/**
+ * @brief This property defines the limit in bytes of the memory allocated for the intermediate tensors and the
+ * scratch pads of the primitives by each stream of the compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When the memory planned for the static shapes exceeds the budget, the independent branches executed concurrently
+ * in the ov::intel_cpu::dataflow_execution mode are serialized. If the plan still doesn't fit, the compilation fails
+ * with the planned size in the error message. For the dynamic shapes the inference fails instead of allocating the
+ * memory beyond the budget. Zero (default) means no limit.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::activation_memory_budget(512 * 1024 * 1024));
+ * @endcode
+ */
+static constexpr Property<uint64_t> activation_memory_budget{"CPU_ACTIVATION_MEMORY_BUDGET"};
+
+/**
+ * @brief This property defines whether the streams of the compiled models pinned to the same CPU cores share one
+ * scratch pad of the primitives
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The streams bound to the same set of cores of a NUMA node compete for these cores anyway, so in this mode their
+ * inferences are serialized and they use one process-wide scratch pad sized to the biggest one required. The property
+ * takes effect only for the streams pinned to the cores (see ov::hint::enable_cpu_pinning), and it is ignored in the
+ * ov::intel_cpu::dataflow_execution mode. The default value is false.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::shared_scratchpad(true));
+ * @endcode
+ */
+static constexpr Property<bool> shared_scratchpad{"CPU_SHARED_SCRATCHPAD"};
+
+/**
+ * @brief This property defines whether the repacked weights are shared with the other compiled models of the process
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When the property is set to true, the weights repacked for the primitives are kept in a process level store with
+ * a replica per socket, where they are addressed by the content of the original weights. So the models sharing the
+ * layers bit-for-bit (e.g. the fine-tuned variants of one model) share the repacked copies of these layers, and the
+ * memory is proportional to the unique weights. The copies are released with the last compiled model using them.
+ * Hashing the weights makes the compilation slower. The default value is false.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::cross_model_weights_sharing(true));
+ * @endcode
+ */
+static constexpr Property<bool> cross_model_weights_sharing{"CPU_CROSS_MODEL_WEIGHTS_SHARING"};
+
+/**
+ * @brief This property defines whether the blocking parameters of the snippets kernels are tuned on the machine
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When the property is set to true, the compilation of each static shape Subgraph with the matrix multiplications
+ * benchmarks a small set of the candidate block sizes of its loops and keeps the fastest one instead of the one
+ * selected by the heuristics. The results are stored in the cache blob of the model if ov::cache_dir is set, so the
+ * model loaded from the cache skips the search. The tuning makes the first compilation slower. The default value is
+ * false.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::snippets_autotuning(true));
+ * @endcode
+ */
+static constexpr Property<bool> snippets_autotuning{"CPU_SNIPPETS_AUTOTUNING"};
+
+/**
+ * @brief This property defines whether the input shapes of the dynamic models are used to warm up the next compilations
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When the property is set to true and ov::cache_dir is set, the input shapes of the inferences of a dynamic model are
+ * stored in the cache directory, and the next compilation or import of a model with the same topology runs a warm-up
+ * inference with the most recently used of these shapes, so the shape specific kernels are compiled before the first
+ * request. The warm-up is limited in time and the number of the stored shapes is limited, the least recently used
+ * ones are replaced. The warm-up makes the compilation slower. The default value is false.
+ *
+ * @code
+ * core.set_property(ov::cache_dir("cache"));
+ * core.set_property(ov::intel_cpu::shape_warm_up(true));
+ * @endcode
+ */
+static constexpr Property<bool> shape_warm_up{"CPU_SHAPE_WARM_UP"};
+
+/**
+ * @brief Read-only property to get the size in bytes of the KV cache pages currently used by the infer requests
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> kv_cache_pool_used_size{"CPU_KV_CACHE_POOL_USED_SIZE"};
+
+/**
+ * @brief Read-only property to get the size in bytes of the memory allocated by the KV cache page pool
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> kv_cache_pool_allocated_size{
+    "CPU_KV_CACHE_POOL_ALLOCATED_SIZE"};
+
+/**
+ * @brief Read-only property to get the peak size in bytes of the memory allocated for the intermediate tensors
+ * and the scratch pads of the primitives by all the streams of the compiled model. The planned value is available
+ * right after the compilation. For the dynamic shape models the value grows with the biggest shapes inferred so far.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> peak_activation_memory_size{
+    "CPU_PEAK_ACTIVATION_MEMORY_SIZE"};
+
+/**
+ * @brief Read-only property to get the size in bytes of the scratch pads shared in the current process by the streams
+ * of the compiled models with ov::intel_cpu::shared_scratchpad enabled
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> scratchpad_pool_size{"CPU_SCRATCHPAD_POOL_SIZE"};
+
+/**
+ * @brief Read-only property to get the size in bytes of the repacked weights shared in the current process by the
+ * compiled models with ov::intel_cpu::cross_model_weights_sharing enabled
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> shared_weights_size{"CPU_SHARED_WEIGHTS_SIZE"};
+
+/**
+ * @brief Read-only property to get the lookup counters of the runtime primitive cache of the compiled model.
+ * The map contains the number of "hits", "misses" and "evictions". In multi-stream mode the counters refer
+ * to the primitive cache shared by all the streams.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> primitive_cache_statistics{
+    "CPU_PRIMITIVE_CACHE_STATISTICS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -733,6 +733,15 @@ inline std::istream& operator>>(std::istream& is, CacheMode& mode) {
  */
 static constexpr Property<CacheMode, PropertyMutability::RW> cache_mode{"CACHE_MODE"};
 
+/**
+ * @brief Read-write property to set the path to the weights file (e.g. IR .bin) of the compiled model.
+ * If the device supports it, the cache blob created with ov::CacheMode::OPTIMIZE_SIZE may refer to the weights in this
+ * file instead of storing them, and the weights are read from the file when the model is imported from the cache.
+ * The property is set by the core automatically when the model is compiled from IR file with the cache enabled.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::string, PropertyMutability::RW> weights_path{"WEIGHTS_PATH"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  * @ingroup ov_runtime_cpp_prop_api
@@ -74,6 +74,16 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Sets the state to the first @p length elements of another variable state along the sequence axis.
+     * The plugin may share the common part with the source state instead of copying it, e.g. the CPU plugin shares
+     * the pages of the paged KV cache in the copy-on-write manner.
+     * @param source The variable state with the same name of another infer request created from the same compiled
+     * model.
+     * @param length The number of elements (tokens) along the sequence axis to take from the source state.
+     */
+    void fork(const VariableState& source, size_t length);
 };
 
 }  // namespace ov
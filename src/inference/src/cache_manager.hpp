@@ -9,12 +9,22 @@
  */
 #pragma once
 
+#include <atomic>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <memory>
 #include <string>
 
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 
@@ -46,20 +56,23 @@ public:
     virtual void write_cache_entry(const std::string& id, StreamWriter writer) = 0;
 
     /**
-     * @brief Function passing created input stream
+     * @brief Function passing created input stream and the buffer the stream reads from
+     *
+     * The buffer is nullptr if the stream is not backed by memory, e.g. the cache entry is not memory mapped
      */
-    using StreamReader = std::function<void(std::istream&)>;
+    using StreamReader = std::function<void(std::istream&, std::shared_ptr<ov::AlignedBuffer>)>;
 
     /**
      * @brief Callback when OpenVINO intends to read model from cache
      *
-     * Client needs to call create std::istream object and call reader(istream)
+     * Client needs to call create std::istream object and call reader(istream, buffer)
      * Otherwise, model will not be read from cache and will be loaded as usual
      *
      * @param id Id of cache (hash of the model)
+     * @param enable_mmap Use memory mapping of the cache entry instead of the regular reading if it is possible
      * @param reader Lambda function to be called when input stream is created
      */
-    virtual void read_cache_entry(const std::string& id, StreamReader reader) = 0;
+    virtual void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) = 0;
 
     /**
      * @brief Callback when OpenVINO intends to remove cache entry
@@ -84,6 +97,17 @@ class FileStorageCacheManager final : public ICacheManager {
         return ov::util::make_path(m_cachePath, blobHash + ".blob");
     }
 
+    // the name is unique for each write of all the processes sharing the cache directory
+    std::string getTmpFile(const std::string& blobHash) const {
+        static std::atomic<uint64_t> counter{0};
+#ifdef _WIN32
+        const auto pid = _getpid();
+#else
+        const auto pid = getpid();
+#endif
+        return getBlobFile(blobHash) + ".tmp" + std::to_string(pid) + "_" + std::to_string(counter++);
+    }
+
 public:
     /**
      * @brief Constructor
@@ -99,15 +123,46 @@ public:
 
 private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        // The blob is written to a temporary file, which replaces the cache entry only when it is complete. So the
+        // other processes never read a partially written blob, and the blob mapped by them is never truncated.
+        const auto blobFileName = getBlobFile(id);
+        const auto tmpFileName = getTmpFile(id);
+        try {
+            std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+            stream.close();
+            if (stream.fail()) {
+                std::remove(tmpFileName.c_str());
+                return;
+            }
+        } catch (...) {
+            std::remove(tmpFileName.c_str());
+            throw;
+        }
+        if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+            // rename doesn't replace the existing file on some platforms
+            std::remove(blobFileName.c_str());
+            if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0)
+                std::remove(tmpFileName.c_str());
+        }
     }
 
-    void read_cache_entry(const std::string& id, StreamReader reader) override {
+    void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (ov::util::file_exists(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            if (enable_mmap) {
+                // the pages of the blob are loaded lazily and shared with other processes mapping the same file
+                auto mmap = ov::load_mmap_object(blobFileName);
+                auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mmap->data(),
+                                                                                                      mmap->size(),
+                                                                                                      mmap);
+                ov::SharedStreamBuffer stream_buffer(buffer->get_ptr<char>(), buffer->size());
+                std::istream stream(&stream_buffer);
+                reader(stream, buffer);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream, nullptr);
+            }
         }
     }
 
@@ -49,4 +49,9 @@ void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->set_state(get_tensor_impl(state)));
 }
 
+void VariableState::fork(const VariableState& source, size_t length) {
+    OPENVINO_ASSERT(source._impl != nullptr, "Source VariableState was not initialized.");
+    OV_VARIABLE_CALL_STATEMENT(_impl->fork(source._impl, length));
+}
+
 }  // namespace ov
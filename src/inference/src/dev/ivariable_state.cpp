@@ -25,3 +25,7 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
 ov::SoPtr<ov::ITensor> ov::IVariableState::get_state() const {
     return m_state;
 }
+
+void ov::IVariableState::fork(const std::shared_ptr<ov::IVariableState>& source, size_t length) {
+    OPENVINO_NOT_IMPLEMENTED;
+}
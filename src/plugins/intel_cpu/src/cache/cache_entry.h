@@ -19,16 +19,19 @@ public:
     };
 public:
     virtual ~CacheEntryBase() = default;
+    virtual CacheStatistics getStatistics() const = 0;
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const KeyType&)
+ *         and getStatistics() interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The entry is thread safe as long as the ImplType is. Concurrent misses on the same key may build the value
+ *       several times, the last built value is kept in the storage.
  */
 
 template<typename KeyType,
@@ -66,6 +69,10 @@ public:
         return {retVal, retStatus};
     }
 
+    CacheStatistics getStatistics() const override {
+        return _impl.getStatistics();
+    }
+
 public:
     ImplType _impl;
 };
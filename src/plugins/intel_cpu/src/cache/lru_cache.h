@@ -19,6 +19,22 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Lookup counters of a cache
+ */
+struct CacheStatistics {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        return *this;
+    }
+};
+
 template<typename Key, typename Value>
 class LruCache {
 public:
@@ -59,9 +75,11 @@ public:
     Value get(const Key &key) {
         auto itr = _cacheMapper.find(key);
         if (itr == _cacheMapper.end()) {
+            ++_statistics.misses;
             return Value();
         }
 
+        ++_statistics.hits;
         touch(itr->second);
         return _lruList.front().second;
     }
@@ -75,6 +93,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            ++_statistics.evictions;
         }
     }
 
@@ -86,6 +105,20 @@ public:
          return _capacity;
      }
 
+    /**
+     * @brief Returns the number of records currently stored in the cache
+     */
+    size_t size() const noexcept {
+        return _cacheMapper.size();
+    }
+
+    /**
+     * @brief Returns the hit/miss counters of the get() calls and the number of evicted records
+     */
+    const CacheStatistics& getStatistics() const noexcept {
+        return _statistics;
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key &k) const {
@@ -103,6 +136,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    CacheStatistics _statistics;
 };
 
 }   // namespace intel_cpu
@@ -9,5 +9,17 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheStatistics MultiCache::getStatistics() const {
+    std::unique_lock<std::mutex> lock;
+    if (_storageMutex) {
+        lock = std::unique_lock<std::mutex>(*_storageMutex);
+    }
+    CacheStatistics result;
+    for (const auto& entry : _storage) {
+        result += entry.second->getStatistics();
+    }
+    return result;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -7,7 +7,9 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -15,7 +17,9 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is constructed as a thread safe one!
+ * The thread safe cache keeps the records in the lock-striped ShardedLruCache storages, so it can be shared
+ * by the graphs executed in different streams.
  */
 
 class MultiCache {
@@ -24,14 +28,19 @@ public:
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
+    using SharedEntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
+    template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
 
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param threadSafe enables concurrent access to the cache from several threads
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false)
+        : _capacity(capacity),
+          _storageMutex(threadSafe ? std::make_shared<std::mutex>() : nullptr) {}
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -49,19 +58,36 @@ public:
               typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
 #endif
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if (_storageMutex) {
+            auto entry = getEntry<SharedEntryTypeT<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    bool isThreadSafe() const {
+        return _storageMutex != nullptr;
+    }
+
+    /**
+    * @brief Sums up the lookup counters of all the entries
+    * @note the counters of a not thread safe cache may be read only from the thread using the cache
+    */
+    CacheStatistics getStatistics() const;
+
 private:
     template<typename T>
     size_t getTypeId();
-    template<typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template<typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    // guards the storage map of the thread safe cache, the entries are synchronized by themselves
+    // shared_ptr keeps the cache copyable
+    std::shared_ptr<std::mutex> _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -71,10 +97,13 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template<typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template<typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock;
+    if (_storageMutex) {
+        lock = std::unique_lock<std::mutex>(*_storageMutex);
+    }
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
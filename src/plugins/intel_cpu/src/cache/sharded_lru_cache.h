@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe cache with LRU eviction policy built on top of the LruCache.
+ * The records are distributed over several independent shards by the key hash, each shard is guarded by its own mutex,
+ * so concurrent lookups of different keys rarely contend for the same lock.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The LRU order is maintained per shard, so the eviction policy is approximate with respect to the whole cache.
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    static constexpr size_t defaultShardsNum = 16;
+
+public:
+    /**
+     * @param capacity maximum records limit of the whole cache, it is evenly split between the shards
+     * @param shardsNum number of the shards, reduced to the capacity if the capacity is smaller
+     */
+    explicit ShardedLruCache(size_t capacity, size_t shardsNum = defaultShardsNum) : _capacity(capacity) {
+        shardsNum = std::max<size_t>(1, std::min(shardsNum, capacity));
+        const size_t shardCapacity = (capacity + shardsNum - 1) / shardsNum;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key &key, const Value &val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard._mutex);
+        shard._cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard._mutex);
+        return shard._cache.get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->_mutex);
+            shard->_cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    size_t getShardsNum() const noexcept {
+        return _shards.size();
+    }
+
+    /**
+     * @brief Returns the number of records currently stored in all the shards
+     */
+    size_t size() const {
+        size_t result = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->_mutex);
+            result += shard->_cache.size();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the counters accumulated over all the shards
+     */
+    CacheStatistics getStatistics() const {
+        CacheStatistics result;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->_mutex);
+            result += shard->_cache.getStatistics();
+        }
+        return result;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : _cache(capacity) {}
+
+        mutable std::mutex _mutex;
+        LruCache<Key, Value> _cache;
+    };
+
+    Shard& getShard(const Key &key) {
+        // the low bits of the combined hashes are well mixed, so the modulo is enough to pick the shard
+        return *_shards[static_cast<size_t>(key.hash()) % _shards.size()];
+    }
+
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -11,6 +11,7 @@
 #include "nodes/memory.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "serialize.h"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "transformations/transformation_pipeline.h"
@@ -18,8 +19,10 @@
 #include "openvino/util/common_util.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "transformations/utils/utils.hpp"
+#include "utils/debug_capabilities.h"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include <chrono>
 #include <cstring>
 #include <utility>
 
@@ -32,6 +35,11 @@ using namespace ov::threading;
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+// the warm up delays the compilation, so the shapes which didn't fit into the limit are compiled on demand
+constexpr std::chrono::seconds maxWarmUpTime{10};
+}  // namespace
+
 struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     void run(ov::threading::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -43,7 +51,8 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const Config& cfg,
-                             const bool loaded_from_cache)
+                             const bool loaded_from_cache,
+                             SnippetsTuningCache::Ptr snippetsTuningCache)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
@@ -70,6 +79,22 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
         m_callback_executor = m_task_executor;
     }
 
+    if (m_cfg.kvCachePageSize > 0) {
+        m_kvCachePool = std::make_shared<KVCachePagePool>(m_cfg.kvCachePageSize);
+    }
+    // the streams reuse the primitives compiled by each other for the same shapes
+    if (m_cfg.streamExecutorConfig.get_streams() > 1) {
+        m_sharedParamsCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity, true);
+    }
+    if (m_cfg.shapeWarmUp && !m_cfg.cacheDir.empty() && m_model->is_dynamic()) {
+        m_shapeProfileCache = std::make_shared<ShapeProfileCache>(m_cfg.cacheDir, m_model);
+    }
+    // the model imported from the cache blob reuses the results of the tuning stored in the blob
+    if (m_cfg.snippetsAutotuning) {
+        m_snippetsTuningCache = snippetsTuningCache ? std::move(snippetsTuningCache)
+                                                    : std::make_shared<SnippetsTuningCache>();
+    }
+
     if (m_task_executor)
         set_task_executor(m_task_executor);
     if (m_callback_executor)
@@ -123,7 +148,8 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
         streamId = streamsExecutor->get_stream_id();
         socketId = streamsExecutor->get_socket_id();
     }
-    auto graphLock = GraphGuard::Lock(m_graphs[streamId % m_graphs.size()]);
+    const int graphId = streamId % static_cast<int>(m_graphs.size());
+    auto graphLock = GraphGuard::Lock(m_graphs[graphId]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
@@ -137,7 +163,23 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                         (m_cfg.lpTransformsMode == Config::On) &&
                         ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
 
-                    ctx = std::make_shared<GraphContext>(m_cfg, weightsCache, isQuantizedFlag, streamsExecutor);
+                    graphLock._graph._sharedScratchPad = get_shared_scratch_pad(graphId);
+                    const auto& sharedScratchPad = graphLock._graph._sharedScratchPad;
+                    auto sharedWeightsCache =
+                        m_cfg.crossModelWeightsSharing ? SocketsWeights::getProcessWeights()[socketId] : nullptr;
+                    ctx = std::make_shared<GraphContext>(m_cfg,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         streamsExecutor,
+                                                         m_kvCachePool,
+                                                         m_sharedParamsCache,
+                                                         sharedScratchPad ? sharedScratchPad->scratchPad : nullptr,
+                                                         sharedWeightsCache,
+                                                         m_snippetsTuningCache);
+                }
+                // the primitives created by the graph may reallocate the shared scratch pad
+                if (graphLock._graph._sharedScratchPad) {
+                    graphLock._scratchPadLock = std::unique_lock<std::mutex>(graphLock._graph._sharedScratchPad->mutex);
                 }
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.CreateGraph(model, ctx);
@@ -154,9 +196,83 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
             std::rethrow_exception(exception);
         }
     }
+    // the nodes of the dataflow graph have their own scratch pads
+    if (graphLock._graph._sharedScratchPad && !graphLock._graph.isDataflowExecution() &&
+        !graphLock._scratchPadLock.owns_lock()) {
+        graphLock._scratchPadLock = std::unique_lock<std::mutex>(graphLock._graph._sharedScratchPad->mutex);
+    }
     return graphLock;
 }
 
+ScratchPadPool::EntryPtr CompiledModel::get_shared_scratch_pad(int streamId) const {
+    // the sub-streams need their own scratch pads, the nodes executed concurrently in the dataflow mode don't use
+    // the shared one
+    if (!m_cfg.sharedScratchPad || m_cfg.exclusiveAsyncRequests ||
+        m_cfg.streamExecutorConfig.get_sub_streams() > 0)
+        return nullptr;
+    auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+    // the cores of the stream are known only when the streams are pinned
+    const auto streamProcessorIds = m_cfg.streamExecutorConfig.get_stream_processor_ids();
+    if (!streamsExecutor || streamId >= static_cast<int>(streamProcessorIds.size()) ||
+        streamProcessorIds[streamId].empty())
+        return nullptr;
+    return ScratchPadPool::getInstance().get(GraphContext::getEngine(),
+                                             streamsExecutor->get_numa_node_id(),
+                                             streamProcessorIds[streamId]);
+}
+
+void CompiledModel::warm_up() const {
+    if (!m_shapeProfileCache)
+        return;
+    const auto profiles = m_shapeProfileCache->getProfiles();
+    if (profiles.empty())
+        return;
+
+    const auto& model_inputs = inputs();
+    auto is_applicable = [&](const ShapeProfileCache::Profile& profile) {
+        if (profile.size() != model_inputs.size())
+            return false;
+        for (size_t i = 0; i < profile.size(); i++) {
+            if (model_inputs[i].get_element_type() == ov::element::string ||
+                !model_inputs[i].get_partial_shape().compatible(profile[i]))
+                return false;
+        }
+        return true;
+    };
+
+    // the profiles are ordered from the most recently used, so the time limit skips the least valuable ones
+    const auto deadline = std::chrono::steady_clock::now() + maxWarmUpTime;
+    auto warm_up_graph = [&] {
+        auto request = std::make_shared<SyncInferRequest>(std::static_pointer_cast<const CompiledModel>(shared_from_this()));
+        request->disable_shape_profile();
+        for (const auto& profile : profiles) {
+            if (std::chrono::steady_clock::now() > deadline)
+                break;
+            if (!is_applicable(profile))
+                continue;
+            for (size_t i = 0; i < profile.size(); i++) {
+                auto tensor = ov::make_tensor(model_inputs[i].get_element_type(), profile[i]);
+                if (tensor->get_byte_size() > 0)
+                    std::memset(tensor->data(), 0, tensor->get_byte_size());
+                request->set_tensor(model_inputs[i], ov::SoPtr<ov::ITensor>(tensor, nullptr));
+            }
+            // the warm up is an optimization only, so the failures must not prevent the model from being used
+            try {
+                request->infer();
+            } catch (const std::exception& e) {
+                DEBUG_LOG("Warm up of the model ", m_name, " failed: ", e.what());
+            }
+        }
+    };
+
+    if (m_cfg.streamExecutorConfig.get_streams() != 0) {
+        std::vector<Task> tasks(std::max(1, m_cfg.streamExecutorConfig.get_streams()), warm_up_graph);
+        m_task_executor->run_and_wait(tasks);
+    } else {
+        warm_up_graph();
+    }
+}
+
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
     m_numRequests++;
     return std::make_shared<SyncInferRequest>(std::static_pointer_cast<const CompiledModel>(shared_from_this()));
@@ -223,6 +339,19 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
             RO_property(ov::hint::dynamic_quantization_group_size.name()),
             RO_property(ov::hint::kv_cache_precision.name()),
+            RO_property(ov::intel_cpu::kv_cache_page_size.name()),
+            RO_property(ov::intel_cpu::kv_cache_group_size.name()),
+            RO_property(ov::intel_cpu::dataflow_execution.name()),
+            RO_property(ov::intel_cpu::execution_plan_replay.name()),
+            RO_property(ov::intel_cpu::activation_memory_budget.name()),
+            RO_property(ov::intel_cpu::shared_scratchpad.name()),
+            RO_property(ov::intel_cpu::cross_model_weights_sharing.name()),
+            RO_property(ov::intel_cpu::snippets_autotuning.name()),
+            RO_property(ov::intel_cpu::shape_warm_up.name()),
+            RO_property(ov::intel_cpu::kv_cache_pool_used_size.name()),
+            RO_property(ov::intel_cpu::kv_cache_pool_allocated_size.name()),
+            RO_property(ov::intel_cpu::peak_activation_memory_size.name()),
+            RO_property(ov::intel_cpu::primitive_cache_statistics.name()),
         };
 
         OPENVINO_SUPPRESS_DEPRECATED_START
@@ -300,12 +429,55 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             config.fcDynamicQuantizationGroupSize);
     } else if (name == ov::hint::kv_cache_precision) {
         return decltype(ov::hint::kv_cache_precision)::value_type(config.kvCachePrecision);
+    } else if (name == ov::intel_cpu::kv_cache_page_size) {
+        return decltype(ov::intel_cpu::kv_cache_page_size)::value_type(config.kvCachePageSize);
+    } else if (name == ov::intel_cpu::kv_cache_group_size) {
+        return decltype(ov::intel_cpu::kv_cache_group_size)::value_type(config.kvCacheGroupSize);
+    } else if (name == ov::intel_cpu::dataflow_execution) {
+        // the graphs which are not applicable for the dataflow execution fall back to the sequential one
+        return decltype(ov::intel_cpu::dataflow_execution)::value_type(graph.isDataflowExecution());
+    } else if (name == ov::intel_cpu::execution_plan_replay) {
+        return decltype(ov::intel_cpu::execution_plan_replay)::value_type(config.executionPlanReplay);
+    } else if (name == ov::intel_cpu::activation_memory_budget) {
+        return decltype(ov::intel_cpu::activation_memory_budget)::value_type(config.activationMemoryBudget);
+    } else if (name == ov::intel_cpu::shared_scratchpad) {
+        return decltype(ov::intel_cpu::shared_scratchpad)::value_type(config.sharedScratchPad);
+    } else if (name == ov::intel_cpu::cross_model_weights_sharing) {
+        return decltype(ov::intel_cpu::cross_model_weights_sharing)::value_type(config.crossModelWeightsSharing);
+    } else if (name == ov::intel_cpu::snippets_autotuning) {
+        return decltype(ov::intel_cpu::snippets_autotuning)::value_type(config.snippetsAutotuning);
+    } else if (name == ov::intel_cpu::shape_warm_up) {
+        return decltype(ov::intel_cpu::shape_warm_up)::value_type(config.shapeWarmUp);
+    } else if (name == ov::intel_cpu::kv_cache_pool_used_size) {
+        return decltype(ov::intel_cpu::kv_cache_pool_used_size)::value_type(
+            m_kvCachePool ? m_kvCachePool->getUsedSize() : 0);
+    } else if (name == ov::intel_cpu::kv_cache_pool_allocated_size) {
+        return decltype(ov::intel_cpu::kv_cache_pool_allocated_size)::value_type(
+            m_kvCachePool ? m_kvCachePool->getAllocatedSize() : 0);
+    } else if (name == ov::intel_cpu::peak_activation_memory_size) {
+        // every stream has its own graph, the counters of the graphs are safe to read without the graph locks
+        uint64_t peakSize = 0;
+        for (const auto& streamGraph : m_graphs) {
+            peakSize += streamGraph.getPeakActivationMemorySize();
+        }
+        return decltype(ov::intel_cpu::peak_activation_memory_size)::value_type(peakSize);
+    } else if (name == ov::intel_cpu::primitive_cache_statistics) {
+        // the cache of a single graph is safe to read under the graph lock
+        const auto cache = m_sharedParamsCache ? m_sharedParamsCache : graph.getGraphContext()->getParamsCache();
+        const auto statistics = cache->getStatistics();
+        return decltype(ov::intel_cpu::primitive_cache_statistics)::value_type{
+            {"hits", statistics.hits},
+            {"misses", statistics.misses},
+            {"evictions", statistics.evictions}};
     }
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream);
+    // the weights are not exported if they can be read back from the original weights file
+    ModelSerializer serializer(modelStream,
+                               m_cfg.cacheMode == ov::CacheMode::OPTIMIZE_SIZE ? m_cfg.weightsPath : std::string{},
+                               m_snippetsTuningCache);
     serializer << m_model;
 }
 
@@ -9,6 +9,10 @@
 
 #include "graph.h"
 #include "graph_context.h"
+#include "kv_cache_pool.h"
+#include "scratch_pad_pool.h"
+#include "shape_profile_cache.h"
+#include "snippets_tuning_cache.h"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/iplugin.hpp"
@@ -25,7 +29,8 @@ public:
     CompiledModel(const std::shared_ptr<ov::Model>& model,
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   const Config& cfg,
-                  const bool loaded_from_cache);
+                  const bool loaded_from_cache,
+                  SnippetsTuningCache::Ptr snippetsTuningCache = nullptr);
 
     std::shared_ptr<ov::IAsyncInferRequest> create_infer_request() const override;
 
@@ -40,6 +45,12 @@ public:
                                        "Set property to Core::compile_model during compilation");
     };
 
+    /**
+     * @brief Executes the graphs of all the streams with the input shapes stored in the shape profile cache,
+     * so the shape specific kernels and primitives are compiled before the first user request
+     */
+    void warm_up() const;
+
 private:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     friend class SyncInferRequest;
@@ -57,9 +68,13 @@ private:
     std::string m_name;
     struct GraphGuard : public Graph {
         std::mutex _mutex;
+        // the scratch pad shared with the streams of the other compiled models bound to the same cores
+        ScratchPadPool::EntryPtr _sharedScratchPad;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             GraphGuard& _graph;
+            // keeps the other graphs from reallocating the shared scratch pad while this graph is used
+            std::unique_lock<std::mutex> _scratchPadLock;
         };
     };
 
@@ -67,12 +82,26 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // KV cache pages shared by the states of all the infer requests
+    KVCachePagePool::Ptr m_kvCachePool = nullptr;
+    // thread safe primitive cache shared by the graphs of all the streams
+    MultiCachePtr m_sharedParamsCache = nullptr;
+    // input shapes seen at runtime, persisted in the cache directory for the dynamic models
+    ShapeProfileCache::Ptr m_shapeProfileCache = nullptr;
+    // blocking parameters of the snippets kernels tuned by the streams, exported with the model
+    SnippetsTuningCache::Ptr m_snippetsTuningCache = nullptr;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
     GraphGuard::Lock get_graph() const;
+
+    /**
+     * @brief Returns the pooled scratch pad for the graph of the stream if the stream is pinned to the known cores
+     * and the graph may share it, nullptr otherwise. Must be called from the stream.
+     */
+    ScratchPadPool::EntryPtr get_shared_scratch_pad(int streamId) const;
 };
 
 }   // namespace intel_cpu
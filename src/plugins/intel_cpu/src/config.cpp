@@ -272,6 +272,26 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                key,
                                ". Expected value only ov::intel_cpu::Config::LPTransformsMode::On/Off");
             }
+        } else if (key == ov::intel_cpu::snippets_fc_tokenization.name()) {
+            try {
+                snippetsFCTokenization = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               key,
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::snippets_arm64_tokenization.name()) {
+            try {
+                snippetsArm64Tokenization = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               key,
+                               ". Expected only true/false");
+            }
         } else if (key == ov::device::id.name()) {
             device_id = val.as<std::string>();
             if (!device_id.empty()) {
@@ -358,7 +378,7 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
         } else if (key == ov::hint::kv_cache_precision.name()) {
             try {
                 auto const prec = val.as<ov::element::Type>();
-                if (one_of(prec, ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::u8)) {
+                if (one_of(prec, ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::u8, ov::element::u4)) {
                     kvCachePrecision = prec;
                 } else {
                      OPENVINO_THROW("invalid value");
@@ -368,7 +388,119 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                val.as<std::string>(),
                                " for property key ",
                                ov::hint::kv_cache_precision.name(),
-                               ". Supported values: u8, bf16, f16, f32");
+                               ". Supported values: u4, u8, bf16, f16, f32");
+            }
+        } else if (key == ov::intel_cpu::kv_cache_page_size.name()) {
+            try {
+                kvCachePageSize = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_page_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::kv_cache_group_size.name()) {
+            try {
+                kvCacheGroupSize = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_group_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::dataflow_execution.name()) {
+            try {
+                dataflowExecution = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::dataflow_execution.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::execution_plan_replay.name()) {
+            try {
+                executionPlanReplay = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::execution_plan_replay.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::activation_memory_budget.name()) {
+            try {
+                activationMemoryBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::activation_memory_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::shared_scratchpad.name()) {
+            try {
+                sharedScratchPad = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shared_scratchpad.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::cross_model_weights_sharing.name()) {
+            try {
+                crossModelWeightsSharing = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cross_model_weights_sharing.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::snippets_autotuning.name()) {
+            try {
+                snippetsAutotuning = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::snippets_autotuning.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::shape_warm_up.name()) {
+            try {
+                shapeWarmUp = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shape_warm_up.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::cache_dir.name()) {
+            try {
+                cacheDir = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::cache_dir.name(), ". Expected string path");
+            }
+        } else if (key == ov::cache_mode.name()) {
+            try {
+                cacheMode = val.as<ov::CacheMode>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::cache_mode.name(),
+                               ". Supported values: ov::CacheMode::OPTIMIZE_SIZE/OPTIMIZE_SPEED");
+            }
+        } else if (key == ov::weights_path.name()) {
+            try {
+                weightsPath = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::weights_path.name(), ". Expected string path");
             }
         } else {
             OPENVINO_THROW("NotFound: Unsupported property ", key, " by CPU plugin.");
@@ -46,11 +46,37 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
+    // tokenize the gated FullyConnected with their elementwise chains to Snippets
+    bool snippetsFCTokenization = false;
+    // tokenize the eltwise subgraphs to Snippets on ARM64
+    bool snippetsArm64Tokenization = false;
     std::string dumpToDot = {};
     std::string device_id = {};
     float fcSparseWeiDecompressionRate = 1.0f;
     uint64_t fcDynamicQuantizationGroupSize = 0;
     ov::element::Type kvCachePrecision = ov::element::f16;
+    // tokens per page of the paged KV cache for stateful models, 0 means the contiguous KV cache
+    size_t kvCachePageSize = 0;
+    // channels sharing a scale and zero point of the quantized KV cache, 0 means the whole head
+    size_t kvCacheGroupSize = 0;
+    // execute the independent nodes of the static graphs concurrently
+    bool dataflowExecution = false;
+    // replay the flat list of the nodes with the pre-bound arguments after the first inference of the static graphs
+    bool executionPlanReplay = false;
+    // limit of the memory for the intermediate tensors and the scratch pads of a graph, 0 means no limit
+    uint64_t activationMemoryBudget = 0;
+    // share one scratch pad between the streams of all the compiled models pinned to the same cores
+    bool sharedScratchPad = false;
+    // keep the repacked weights in the process level store shared with the other compiled models
+    bool crossModelWeightsSharing = false;
+    // benchmark the candidate blocking parameters of the snippets kernels instead of using the heuristics
+    bool snippetsAutotuning = false;
+    // store the input shapes seen at runtime in cacheDir to warm up the dynamic graphs on the next start
+    bool shapeWarmUp = false;
+    std::string cacheDir = {};
+    // OPTIMIZE_SIZE exports the references to the weights file instead of the original constants if weightsPath is set
+    ov::CacheMode cacheMode = ov::CacheMode::OPTIMIZE_SPEED;
+    std::string weightsPath = {};
 #if defined(OPENVINO_ARCH_X86_64)
     size_t rtCacheCapacity = 5000ul;
 #else
@@ -0,0 +1,223 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dataflow_scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "edge.h"
+#include "openvino/core/parallel.hpp"
+#include "utils/general_utils.h"
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+#    include <tbb/task_arena.h>
+#    include <tbb/task_group.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+struct MemoryAccess {
+    uintptr_t begin;
+    uintptr_t end;
+    bool write;
+};
+
+void addMemoryAccess(std::vector<MemoryAccess>& accesses, const EdgePtr& edge, bool write) {
+    if (!edge)
+        return;
+    const auto memory = edge->getMemoryPtr();
+    if (!memory || memory->getSize() == 0)
+        return;
+    const auto begin = reinterpret_cast<uintptr_t>(memory->getData());
+    accesses.push_back({begin, begin + memory->getSize(), write});
+}
+
+bool isConflicting(const std::vector<MemoryAccess>& lhs, const std::vector<MemoryAccess>& rhs) {
+    for (const auto& a : lhs) {
+        for (const auto& b : rhs) {
+            if ((a.write || b.write) && a.begin < b.end && b.begin < a.end)
+                return true;
+        }
+    }
+    return false;
+}
+
+// the executors of these nodes are shared by all the nodes of the graph via the params cache and keep the
+// intermediate buffers between the calls, so such nodes are never executed concurrently
+bool hasSharedExecutor(const NodePtr& node) {
+    return one_of(node->getType(), Type::ScaledDotProductAttention, Type::MHA);
+}
+
+}  // namespace
+
+DataflowScheduler::DataflowScheduler(const std::vector<NodePtr>& executableNodes) {
+    const size_t numNodes = executableNodes.size();
+    m_successors.resize(numNodes);
+    m_numPredecessors.resize(numNodes, 0);
+
+    std::unordered_map<const Node*, size_t> indices;
+    for (size_t i = 0; i < numNodes; i++) {
+        indices[executableNodes[i].get()] = i;
+    }
+
+    std::vector<std::vector<MemoryAccess>> accesses(numNodes);
+    std::vector<std::unordered_set<size_t>> producers(numNodes);
+    for (size_t i = 0; i < numNodes; i++) {
+        const auto& node = executableNodes[i];
+        for (size_t k = 0; k < node->getParentEdges().size(); k++) {
+            addMemoryAccess(accesses[i], node->getParentEdgeAt(k), false);
+        }
+        for (size_t k = 0; k < node->getChildEdges().size(); k++) {
+            addMemoryAccess(accesses[i], node->getChildEdgeAt(k), true);
+        }
+
+        // the data may come through the optimized out nodes (e.g. in-place Reshape), which are not executed
+        std::unordered_set<const Node*> visited;
+        std::vector<Node*> toVisit = {node.get()};
+        while (!toVisit.empty()) {
+            const auto current = toVisit.back();
+            toVisit.pop_back();
+            for (size_t k = 0; k < current->getParentEdges().size(); k++) {
+                const auto parent = current->getParentEdgeAt(k)->getParent();
+                const auto itr = indices.find(parent.get());
+                if (itr != indices.end()) {
+                    producers[i].insert(itr->second);
+                } else if (!parent->isConstant() && visited.insert(parent.get()).second) {
+                    toVisit.push_back(parent.get());
+                }
+            }
+        }
+    }
+
+    // The closest dependencies are checked first, so the nodes which are already the ancestors through them are
+    // skipped, which keeps the number of the dependency edges close to the transitive reduction.
+    const size_t numWords = (numNodes + 63) / 64;
+    std::vector<std::vector<uint64_t>> ancestors(numNodes, std::vector<uint64_t>(numWords, 0));
+    for (size_t j = 0; j < numNodes; j++) {
+        auto& ancestorsOfJ = ancestors[j];
+        for (size_t i = j; i-- > 0;) {
+            const uint64_t bit = uint64_t(1) << (i % 64);
+            if (ancestorsOfJ[i / 64] & bit)
+                continue;
+
+            const bool dependent = producers[j].count(i) ||
+                                   (hasSharedExecutor(executableNodes[i]) && hasSharedExecutor(executableNodes[j])) ||
+                                   isConflicting(accesses[i], accesses[j]);
+            if (!dependent)
+                continue;
+
+            m_successors[i].push_back(j);
+            m_numPredecessors[j]++;
+            for (size_t w = 0; w < numWords; w++) {
+                ancestorsOfJ[w] |= ancestors[i][w];
+            }
+            ancestorsOfJ[i / 64] |= bit;
+        }
+
+        if (m_numPredecessors[j] == 0)
+            m_roots.push_back(j);
+    }
+}
+
+void DataflowScheduler::run(const std::function<void(size_t)>& func) const {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    const size_t numNodes = m_numPredecessors.size();
+    std::unique_ptr<std::atomic<size_t>[]> numPending(new std::atomic<size_t>[numNodes]);
+    for (size_t i = 0; i < numNodes; i++) {
+        numPending[i].store(m_numPredecessors[i], std::memory_order_relaxed);
+    }
+
+    tbb::task_group group;
+    // The ready successors are spawned to the local queue of the current thread, which the idle threads of the
+    // arena steal them from, and the last one is executed by the current thread without spawning a task.
+    std::function<void(size_t)> process = [&](size_t index) {
+        while (true) {
+            // the threads waiting for the parallel loops of the node must not pick up the other nodes
+            tbb::this_task_arena::isolate([&] {
+                func(index);
+            });
+
+            size_t next = numNodes;
+            for (const auto successor : m_successors[index]) {
+                if (numPending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    if (next != numNodes) {
+                        group.run([&process, next] {
+                            process(next);
+                        });
+                    }
+                    next = successor;
+                }
+            }
+            if (next == numNodes)
+                return;
+            index = next;
+        }
+    };
+
+    for (const auto root : m_roots) {
+        group.run([&process, root] {
+            process(root);
+        });
+    }
+    group.wait();
+#else
+    for (size_t i = 0; i < m_numPredecessors.size(); i++) {
+        func(i);
+    }
+#endif
+}
+
+bool DataflowScheduler::isApplicable(const std::vector<NodePtr>& graphNodes) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    // the memory nodes pass the state between the iterations out of the graph edges, the nodes of the bodies
+    // prepare their primitives before the outer graph chooses the execution mode, so they share the scratch pad
+    return std::none_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput, Type::TensorIterator, Type::If);
+    });
+#else
+    return false;
+#endif
+}
+
+void DataflowScheduler::getExecIndexBounds(const std::vector<NodePtr>& graphNodes,
+                                           std::vector<int>& earliest,
+                                           std::vector<int>& latest) {
+    const auto numNodes = static_cast<int>(graphNodes.size());
+    std::unordered_map<const Node*, int> positions;
+    for (int i = 0; i < numNodes; i++) {
+        positions[graphNodes[i].get()] = i;
+    }
+
+    // the node cannot be executed before the longest path of its producers nor after the longest path of its
+    // consumers, these bounds are not tight but do not require the transitive closure of the graph
+    earliest.assign(numNodes, 0);
+    for (int i = 0; i < numNodes; i++) {
+        const auto& node = graphNodes[i];
+        for (size_t k = 0; k < node->getParentEdges().size(); k++) {
+            const auto parent = positions.find(node->getParentEdgeAt(k)->getParent().get());
+            if (parent != positions.end())
+                earliest[i] = std::max(earliest[i], earliest[parent->second] + 1);
+        }
+    }
+
+    latest.assign(numNodes, numNodes - 1);
+    for (int i = numNodes - 1; i >= 0; i--) {
+        const auto& node = graphNodes[i];
+        for (size_t k = 0; k < node->getChildEdges().size(); k++) {
+            const auto child = positions.find(node->getChildEdgeAt(k)->getChild().get());
+            if (child != positions.end())
+                latest[i] = std::min(latest[i], latest[child->second] - 1);
+        }
+    }
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "node.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Executes the nodes of a static graph in the dataflow order: a node is started as soon as all the nodes it
+ *        depends on are done, so the independent branches are executed concurrently in the task arena of the stream.
+ *
+ * A node depends on the preceding (in the topological order) nodes producing its inputs and on the preceding nodes
+ * accessing the same memory, when one of the accesses is a write. The latter keeps the in-place and the reused
+ * memory of the static graph valid in any execution order allowed by the dependencies.
+ */
+class DataflowScheduler {
+public:
+    using Ptr = std::shared_ptr<const DataflowScheduler>;
+
+    /**
+     * @param executableNodes the executable nodes of the allocated static graph in the topological order
+     */
+    explicit DataflowScheduler(const std::vector<NodePtr>& executableNodes);
+
+    /**
+     * @brief Calls func(index) for all the executable nodes respecting the dependencies and returns when all of them
+     *        are done. The exception thrown by a node cancels the nodes not started yet and is rethrown.
+     */
+    void run(const std::function<void(size_t)>& func) const;
+
+    /**
+     * @brief Checks whether the nodes of the graph may be executed in the dataflow order: the threading runtime
+     *        supports the nested parallelism and no nodes share the state out of the graph edges
+     */
+    static bool isApplicable(const std::vector<NodePtr>& graphNodes);
+
+    /**
+     * @brief Computes the range of the positions each node of the topologically sorted graph may take in the orders
+     *        respecting the data dependencies. The tensor lifetime spanning these ranges of its producer and
+     *        consumers is safe to use for the memory reuse in the dataflow mode.
+     */
+    static void getExecIndexBounds(const std::vector<NodePtr>& graphNodes,
+                                   std::vector<int>& earliest,
+                                   std::vector<int>& latest);
+
+private:
+    std::vector<std::vector<size_t>> m_successors;
+    std::vector<size_t> m_numPredecessors;
+    std::vector<size_t> m_roots;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "cpu_memory.h"
@@ -13,17 +14,45 @@ namespace ov {
 namespace intel_cpu {
 
 class DnnlScratchPad {
+    // the size is read by the other threads while the scratch pad is used for the inference
+    class SizeTrackingMemoryMngr : public MemoryMngrWithReuse {
+    public:
+        explicit SizeTrackingMemoryMngr(int numa_node) : MemoryMngrWithReuse(numa_node) {}
+
+        bool resize(size_t size) override {
+            const bool sizeChanged = MemoryMngrWithReuse::resize(size);
+            if (sizeChanged)
+                m_size.store(size, std::memory_order_relaxed);
+            return sizeChanged;
+        }
+
+        size_t getSize() const noexcept {
+            return m_size.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<size_t> m_size{0};
+    };
+
     MemoryMngrPtr mgrPtr;
+    SizeTrackingMemoryMngr* sizeTracker;  // owned by mgrPtr
     dnnl::engine eng;
 
 public:
     DnnlScratchPad(const dnnl::engine& eng, int numa_node = -1) : eng(eng) {
-        mgrPtr = std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>(numa_node));
+        auto mngr = make_unique<SizeTrackingMemoryMngr>(numa_node);
+        sizeTracker = mngr.get();
+        mgrPtr = std::make_shared<DnnlMemoryMngr>(std::move(mngr));
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
         return std::make_shared<Memory>(eng, md, mgrPtr);
     }
+
+    // the size in bytes of the buffer, which is the biggest scratch pad requested so far
+    size_t getSize() const noexcept {
+        return sizeTracker->getSize();
+    }
 };
 
 using DnnlScratchPadPtr = std::shared_ptr<DnnlScratchPad>;
@@ -0,0 +1,280 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_memory_planner.h"
+
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
+
+#include <common/utils.hpp>
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr size_t cacheLineSize = 64;
+
+void releaseArena(void* ptr) {
+    dnnl::impl::free(ptr);
+}
+}  // namespace
+
+/**
+ * The memory of the tensors which don't fit into their slots. Until the first solve the slots are empty, so the tensors
+ * with non-overlapping lifetimes share the buffer as the memory managers of the graph without the arena do, and the
+ * first inference doesn't take more memory than without the arena.
+ */
+class DynamicMemoryPlanner::OverflowBuffer {
+public:
+    explicit OverflowBuffer(std::shared_ptr<Allocations> allocations) : m_allocations(std::move(allocations)) {}
+
+    ~OverflowBuffer() {
+        m_allocations->overflowSize -= m_size;
+    }
+
+    void* getRawPtr() const noexcept {
+        return m_mngr.getRawPtr();
+    }
+
+    bool hasExtBuffer() const noexcept {
+        return m_mngr.hasExtBuffer();
+    }
+
+    void setExtBuff(void* ptr, size_t size) {
+        // the own buffer is released
+        m_allocations->overflowSize -= m_size;
+        m_size = 0;
+        m_capacity = size;
+        m_mngr.setExtBuff(ptr, size);
+    }
+
+    // returns true if the buffer is reallocated
+    bool resize(size_t size) {
+        if (size <= m_capacity)
+            return false;
+        const auto allocatedSize = m_allocations->arenaSize + m_allocations->overflowSize - m_size + size;
+        if (allocatedSize > m_allocations->budget) {
+            m_allocations->budgetExceeded = true;
+            OPENVINO_THROW("[CPU] Failed to allocate ",
+                           size,
+                           " bytes for the intermediate tensor: the dynamic shapes require more memory than the",
+                           " activation memory budget allows");
+        }
+        m_mngr.resize(size);
+        m_allocations->overflowSize += size - m_size;
+        m_size = m_capacity = size;
+        return true;
+    }
+
+    void addUser(ArenaMemoryMngr* user) {
+        m_users.insert(user);
+    }
+
+    void removeUser(ArenaMemoryMngr* user) {
+        m_users.erase(user);
+    }
+
+    const std::unordered_set<ArenaMemoryMngr*>& getUsers() const {
+        return m_users;
+    }
+
+private:
+    std::shared_ptr<Allocations> m_allocations;
+    MemoryMngrWithReuse m_mngr;
+    size_t m_size = 0;      // the size of the own allocation
+    size_t m_capacity = 0;  // the size of the own allocation or the external buffer
+    std::unordered_set<ArenaMemoryMngr*> m_users;
+};
+
+/**
+ * A view on the slot of the tensor in the arena. The reallocation semantics are the same as for MemoryMngrWithReuse:
+ * the data pointer is changed only when a bigger buffer is requested or an external buffer is set.
+ */
+class DynamicMemoryPlanner::ArenaMemoryMngr : public IMemoryMngrObserver {
+public:
+    explicit ArenaMemoryMngr(std::shared_ptr<Allocations> allocations) : m_allocations(std::move(allocations)) {}
+
+    ~ArenaMemoryMngr() override {
+        detachOverflow();
+    }
+
+    void* getRawPtr() const noexcept override {
+        return m_overflow ? m_overflow->getRawPtr() : m_slotPtr;
+    }
+
+    void setExtBuff(void* ptr, size_t size) override {
+        // the external buffer belongs to this tensor only
+        attachOverflow(std::make_shared<OverflowBuffer>(m_allocations));
+        m_overflow->setExtBuff(ptr, size);
+        notifyUpdate();
+    }
+
+    bool resize(size_t size) override {
+        if (size > m_maxSize) {
+            m_maxSize = size;
+            m_allocations->version++;
+        }
+        if (!m_overflow) {
+            if (size <= m_slotSize)
+                return false;
+            attachOverflow(std::make_shared<OverflowBuffer>(m_allocations));
+        }
+        if (!m_overflow->resize(size))
+            return false;
+        // the tensors sharing the buffer are not alive now, but their memory objects must follow it
+        for (auto* user : m_overflow->getUsers()) {
+            user->notifyUpdate();
+        }
+        return true;
+    }
+
+    bool hasExtBuffer() const noexcept override {
+        return m_overflow && m_overflow->hasExtBuffer();
+    }
+
+    void registerMemory(Memory* memPtr) override {
+        if (memPtr) {
+            m_setMemPtrs.insert(memPtr);
+        }
+    }
+
+    void unregisterMemory(Memory* memPtr) override {
+        if (memPtr) {
+            m_setMemPtrs.erase(memPtr);
+        }
+    }
+
+    // moves the tensor to the new slot and releases the overflow buffer
+    void rebind(void* slotPtr, size_t slotSize) {
+        m_slotPtr = slotPtr;
+        m_slotSize = slotSize;
+        detachOverflow();
+        notifyUpdate();
+    }
+
+    void attachOverflow(std::shared_ptr<OverflowBuffer> overflow) {
+        detachOverflow();
+        m_overflow = std::move(overflow);
+        m_overflow->addUser(this);
+    }
+
+    bool overflowed() const noexcept {
+        return m_overflow != nullptr;
+    }
+
+    size_t getMaxSize() const noexcept {
+        return m_maxSize;
+    }
+
+    void notifyUpdate() {
+        for (auto& item : m_setMemPtrs) {
+            if (item) {
+                item->update();
+            }
+        }
+    }
+
+private:
+    void detachOverflow() {
+        if (m_overflow) {
+            m_overflow->removeUser(this);
+            m_overflow.reset();
+        }
+    }
+
+    std::shared_ptr<Allocations> m_allocations;
+    void* m_slotPtr = nullptr;
+    size_t m_slotSize = 0;
+    size_t m_maxSize = 0;  // the biggest size requested so far
+    std::shared_ptr<OverflowBuffer> m_overflow;  // nullptr if the tensor is in its slot
+    std::unordered_set<Memory*> m_setMemPtrs;
+};
+
+DynamicMemoryPlanner::DynamicMemoryPlanner(std::vector<ov::MemorySolver::Box> boxes, size_t budget)
+    : m_boxes(std::move(boxes)),
+      m_allocations(std::make_shared<Allocations>()),
+      m_arena(nullptr, releaseArena) {
+    m_allocations->budget = budget;
+    m_mngrs.reserve(m_boxes.size());
+    for (size_t i = 0; i < m_boxes.size(); i++) {
+        m_boxes[i].id = static_cast<int64_t>(i);
+        m_mngrs.push_back(std::make_shared<ArenaMemoryMngr>(m_allocations));
+    }
+
+    // the sizes are unknown before the first inference, so the tensors are grouped by the non-overlapping lifetimes
+    // the same way as the graph groups the tensors without the arena
+    std::vector<std::pair<const ov::MemorySolver::Box*, std::shared_ptr<OverflowBuffer>>> groups;
+    for (const auto& box : m_boxes) {
+        auto group = std::find_if(groups.begin(), groups.end(), [&](const decltype(groups)::value_type& group) {
+            const auto& lastBox = *group.first;
+            return lastBox.start > box.finish || lastBox.finish < box.start;
+        });
+        if (group == groups.end()) {
+            groups.emplace_back(&box, std::make_shared<OverflowBuffer>(m_allocations));
+            group = std::prev(groups.end());
+        } else {
+            group->first = &box;
+        }
+        m_mngrs[box.id]->attachOverflow(group->second);
+    }
+}
+
+DynamicMemoryPlanner::~DynamicMemoryPlanner() {
+    // the edge memory objects may outlive the planner, so they must not refer to the arena anymore
+    for (auto& mngr : m_mngrs) {
+        mngr->rebind(nullptr, 0);
+    }
+    m_allocations->arenaSize = 0;
+}
+
+bool DynamicMemoryPlanner::update() {
+    m_allocations->budgetExceeded = false;
+    const bool overflowed =
+        std::any_of(m_mngrs.begin(), m_mngrs.end(), [](const std::shared_ptr<ArenaMemoryMngr>& mngr) {
+            return mngr->overflowed();
+        });
+    if (!overflowed || m_allocations->version == m_unfitVersion)
+        return false;
+    // the overflow buffers are never released during the inference, so their sum is the peak
+    m_peakSize.store(std::max(getPeakSize(), m_allocations->arenaSize + m_allocations->overflowSize),
+                     std::memory_order_relaxed);
+
+    for (auto& box : m_boxes) {
+        box.size = static_cast<int64_t>(div_up(m_mngrs[box.id]->getMaxSize(), cacheLineSize));
+    }
+    ov::MemorySolver solver(m_boxes);
+    const size_t arenaSize = static_cast<size_t>(solver.solve()) * cacheLineSize;
+    if (arenaSize > m_allocations->budget) {
+        // keep the current layout, the tensors which don't fit into it stay in the overflow buffers
+        m_unfitVersion = m_allocations->version;
+        return false;
+    }
+
+    // no intermediate data is alive between the inferences, so the old buffers are released before the allocation
+    for (auto& mngr : m_mngrs) {
+        mngr->rebind(nullptr, 0);
+    }
+    if (arenaSize > m_allocations->arenaSize) {
+        m_arena.reset();
+        m_allocations->arenaSize = 0;
+        void* ptr = dnnl::impl::malloc(arenaSize, cacheLineSize);
+        if (!ptr) {
+            OPENVINO_THROW("Failed to allocate ", arenaSize, " bytes of memory");
+        }
+        m_arena.reset(ptr);
+        m_allocations->arenaSize = arenaSize;
+    }
+
+    auto* arenaPtr = static_cast<uint8_t*>(m_arena.get());
+    for (const auto& box : m_boxes) {
+        m_mngrs[box.id]->rebind(arenaPtr + solver.get_offset(box.id) * cacheLineSize, box.size * cacheLineSize);
+    }
+    m_peakSize.store(std::max(getPeakSize(), m_allocations->arenaSize), std::memory_order_relaxed);
+    return true;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Places the dynamic shape intermediate tensors of a graph into one shared arena.
+ *
+ * Each tensor (a cluster of the in-place edges) gets a memory manager which is a view on its slot in the arena.
+ * The slots are computed by ov::MemorySolver from the lifetimes of the tensors and the biggest sizes they have
+ * taken so far, so the tensors with non-overlapping lifetimes share the memory. When a tensor doesn't fit into
+ * its slot, it is moved to its own overflow buffer until the end of the inference, and update() re-solves the
+ * offsets (and grows the arena if needed) once no intermediate data is alive anymore. Before the first update the
+ * arena is empty and the tensors with non-overlapping lifetimes share the overflow buffers.
+ *
+ * The arena and the overflow buffers together never exceed the budget: the allocation beyond it throws, and the arena
+ * is not grown beyond it, so the tensors which don't fit stay in the overflow buffers. The sizes requested by the
+ * failed allocation are taken into account by the next update, so the inference may be repeated with the new layout.
+ */
+class DynamicMemoryPlanner {
+public:
+    using Ptr = std::shared_ptr<DynamicMemoryPlanner>;
+
+    /**
+     * @param boxes normalized lifetimes of the tensors in the execution indices, the size and id fields are ignored
+     * @param budget the limit in bytes of the memory allocated by the planner
+     */
+    explicit DynamicMemoryPlanner(std::vector<ov::MemorySolver::Box> boxes,
+                                  size_t budget = std::numeric_limits<size_t>::max());
+    ~DynamicMemoryPlanner();
+
+    MemoryMngrPtr getMemoryMngr(size_t tensorIdx) const {
+        return m_mngrs[tensorIdx];
+    }
+
+    /**
+     * @brief Re-solves the offsets if any tensor didn't fit into its slot. Must be called between the inferences,
+     *        including the failed ones.
+     * @return true if the tensors are moved to the new layout
+     */
+    bool update();
+
+    /**
+     * @return true if an allocation has failed because of the budget since the last update
+     */
+    bool isBudgetExceeded() const noexcept {
+        return m_allocations->budgetExceeded;
+    }
+
+    /**
+     * @return the size in bytes of the arena
+     */
+    size_t getArenaSize() const noexcept {
+        return m_allocations->arenaSize;
+    }
+
+    /**
+     * @return the biggest size in bytes of the arena and the overflow buffers allocated at the same time
+     */
+    size_t getPeakSize() const noexcept {
+        return m_peakSize.load(std::memory_order_relaxed);
+    }
+
+private:
+    class ArenaMemoryMngr;
+    class OverflowBuffer;
+
+    // shared with the memory managers, which may outlive the planner
+    struct Allocations {
+        size_t budget;
+        size_t arenaSize = 0;
+        size_t overflowSize = 0;  // the sum of the overflow buffers
+        size_t version = 0;       // incremented when a tensor takes a bigger size than ever before
+        bool budgetExceeded = false;
+    };
+
+    std::vector<ov::MemorySolver::Box> m_boxes;
+    std::vector<std::shared_ptr<ArenaMemoryMngr>> m_mngrs;
+    std::shared_ptr<Allocations> m_allocations;
+    std::unique_ptr<void, void (*)(void*)> m_arena;
+    // the version of the sizes which didn't fit into the budget, so there is no point to re-solve them again
+    size_t m_unfitVersion = std::numeric_limits<size_t>::max();
+    std::atomic<size_t> m_peakSize{0};
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
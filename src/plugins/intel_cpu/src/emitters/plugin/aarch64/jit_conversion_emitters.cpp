@@ -0,0 +1,61 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_conversion_emitters.hpp"
+
+#include "emitters/utils.hpp"
+
+using namespace dnnl::impl::cpu::aarch64;
+using namespace Xbyak_aarch64;
+
+namespace ov {
+namespace intel_cpu {
+namespace aarch64 {
+
+jit_convert_emitter::jit_convert_emitter(dnnl::impl::cpu::aarch64::jit_generator *host,
+                                         dnnl::impl::cpu::aarch64::cpu_isa_t host_isa,
+                                         const std::shared_ptr<ov::Node>& node,
+                                         ov::element::Type exec_prc)
+                                         : jit_emitter(host, host_isa, node, exec_prc) {
+    input_type = node->get_input_element_type(0);
+    output_type = node->get_output_element_type(0);
+
+    auto is_supported_type = [](const ov::element::Type& type) {
+        return type == ov::element::f32 || type == ov::element::f16;
+    };
+    if (!is_supported_type(input_type))
+        OV_CPU_JIT_EMITTER_THROW("Unsupported input type: ", input_type.get_type_name());
+    if (!is_supported_type(output_type))
+        OV_CPU_JIT_EMITTER_THROW("Unsupported output type: ", output_type.get_type_name());
+}
+
+size_t jit_convert_emitter::get_inputs_count() const { return 1; }
+
+void jit_convert_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    if (host_isa_ == dnnl::impl::cpu::aarch64::asimd) {
+        emit_isa<dnnl::impl::cpu::aarch64::asimd>(in_vec_idxs, out_vec_idxs);
+    } else {
+        OV_CPU_JIT_EMITTER_THROW("Unsupported ISA ", host_isa_);
+    }
+}
+
+template <dnnl::impl::cpu::aarch64::cpu_isa_t isa>
+void jit_convert_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    TReg src = TReg(in_vec_idxs[0]);
+    TReg dst = TReg(out_vec_idxs[0]);
+
+    if (input_type == output_type) {
+        if (in_vec_idxs[0] != out_vec_idxs[0])
+            h->mov(dst.b16, src.b16);
+    } else if (input_type == ov::element::f16) {
+        h->fcvtl(dst.s4, src.h4);
+    } else {
+        h->fcvtn(dst.h4, src.s4);
+    }
+}
+
+}   // namespace aarch64
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,38 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "jit_emitter.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace aarch64 {
+
+// Converts the floating-point vectors between f32 and f16. The f16 vector occupies the lower half of the register,
+// as it is loaded and stored by the memory emitters. The conversions between floating-point types have the same
+// results for the truncation and saturation modes: out of range values become infinity in both cases,
+// so the emitter covers both "ConvertTruncation" and "ConvertSaturation" operations.
+class jit_convert_emitter : public jit_emitter {
+public:
+    jit_convert_emitter(dnnl::impl::cpu::aarch64::jit_generator *host,
+                        dnnl::impl::cpu::aarch64::cpu_isa_t host_isa,
+                        const std::shared_ptr<ov::Node>& node,
+                        ov::element::Type exec_prc = ov::element::f32);
+
+    size_t get_inputs_count() const override;
+
+private:
+    void emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const override;
+
+    template <dnnl::impl::cpu::aarch64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const;
+
+    ov::element::Type input_type;
+    ov::element::Type output_type;
+};
+
+}   // namespace aarch64
+}   // namespace intel_cpu
+}   // namespace ov
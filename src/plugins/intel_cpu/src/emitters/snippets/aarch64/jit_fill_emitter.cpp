@@ -0,0 +1,106 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_fill_emitter.hpp"
+
+#include "emitters/utils.hpp"
+
+using namespace Xbyak_aarch64;
+using namespace dnnl::impl::cpu::aarch64;
+
+namespace ov {
+namespace intel_cpu {
+namespace aarch64 {
+
+using jit_generator = dnnl::impl::cpu::aarch64::jit_generator;
+using cpu_isa_t = dnnl::impl::cpu::aarch64::cpu_isa_t;
+using ExpressionPtr = ov::snippets::lowered::ExpressionPtr;
+
+jit_fill_emitter::jit_fill_emitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr)
+    : jit_emitter(h, isa, ov::element::f32, emitter_in_out_map::vec_to_vec) {
+    const auto fill = ov::as_type_ptr<snippets::op::Fill>(expr->get_node());
+    OV_CPU_JIT_EMITTER_ASSERT(fill != nullptr, "expects Fill expression");
+    if (fill->get_element_type().size() != 4) {
+        OV_CPU_JIT_EMITTER_THROW("supports only 4 Byte element types but gets: ", fill->get_element_type());
+    }
+
+    offset = fill->get_offset();
+    fill_value = fill->get_fill_value();
+    prepare_table();
+}
+
+size_t jit_fill_emitter::get_aux_gprs_count() const {
+    // Optimized version (fill full vector by zero) doesn't need the table
+    return is_optimized() ? 0 : 1;
+}
+
+size_t jit_fill_emitter::get_aux_vecs_count() const {
+    // + 1 vec for the broadcasted value which is blended into the tail lanes
+    return is_full_reg() ? 0 : 1;
+}
+
+void jit_fill_emitter::register_table_entries() {
+    if (!is_optimized())
+        push_arg_entry_of("value", fill_value, true);
+}
+
+void jit_fill_emitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    if (host_isa_ == dnnl::impl::cpu::aarch64::asimd) {
+        emit_isa<dnnl::impl::cpu::aarch64::asimd>(in, out);
+    } else {
+        OV_CPU_JIT_EMITTER_THROW("Unsupported ISA ", host_isa_);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_fill_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    const size_t supported_et_size = 4;
+    const auto register_capacity = dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::vlen / supported_et_size;
+    if (offset == register_capacity) {
+        // WA: since AssignRegisters doesn't support inplace logic, Fill ops with offset = register_capacity can't be removed from the LIR
+        // TODO: when inplace is supported, remove such Fill ops from the LIR and remove this logic.
+        // Ticket: 126270
+        if (in[0] != out[0])
+            h->mov(TReg(static_cast<uint32_t>(out[0])).b16, TReg(static_cast<uint32_t>(in[0])).b16);
+    } else if (is_full_reg()) {
+        fill_full<isa>(out);
+    } else {
+        fill_tail<isa>(in, out);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_fill_emitter::fill_full(const std::vector<size_t> &out) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    TReg dst = TReg(static_cast<uint32_t>(out[0]));
+
+    // Optimized impl for zero
+    if (is_optimized()) {
+        h->eor(dst.b16, dst.b16, dst.b16);
+        return;
+    }
+
+    h->ld1r(dst.s, table_val2("value"));
+}
+
+template <cpu_isa_t isa>
+void jit_fill_emitter::fill_tail(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    TReg src = TReg(static_cast<uint32_t>(in[0]));
+    TReg dst = TReg(static_cast<uint32_t>(out[0]));
+    TReg aux = TReg(static_cast<uint32_t>(aux_vec_idxs[0]));
+
+    // the first `offset` lanes are kept, the rest are replaced by the value
+    h->ld1r(aux.s, table_val2("value"));
+    if (in[0] != out[0])
+        h->mov(dst.b16, src.b16);
+    const auto register_capacity = dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::vlen / sizeof(float);
+    for (size_t i = offset; i < register_capacity; ++i)
+        h->ins(dst.s[i], aux.s[i]);
+}
+
+}   // namespace aarch64
+}   // namespace intel_cpu
+}   // namespace ov
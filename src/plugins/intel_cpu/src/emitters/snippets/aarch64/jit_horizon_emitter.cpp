@@ -0,0 +1,63 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_horizon_emitter.hpp"
+
+#include "emitters/utils.hpp"
+
+using namespace Xbyak_aarch64;
+using namespace dnnl::impl::cpu::aarch64;
+
+namespace ov {
+namespace intel_cpu {
+namespace aarch64 {
+
+using jit_generator = dnnl::impl::cpu::aarch64::jit_generator;
+using cpu_isa_t = dnnl::impl::cpu::aarch64::cpu_isa_t;
+using ExpressionPtr = ov::snippets::lowered::ExpressionPtr;
+
+jit_horizon_emitter::jit_horizon_emitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr)
+    : jit_emitter(h, isa, ov::element::f32, emitter_in_out_map::vec_to_vec) {
+    if (ov::is_type<const snippets::op::HorizonMax>(expr->get_node())) {
+        m_op_type = OpType::max;
+    } else if (ov::is_type<const snippets::op::HorizonSum>(expr->get_node())) {
+        m_op_type = OpType::sum;
+    } else {
+        OV_CPU_JIT_EMITTER_THROW("exprects HorizonMax or HorizonSum ops");
+    }
+}
+
+void jit_horizon_emitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    if (host_isa_ == dnnl::impl::cpu::aarch64::asimd) {
+        emit_isa<dnnl::impl::cpu::aarch64::asimd>(in, out);
+    } else {
+        OV_CPU_JIT_EMITTER_THROW("Unsupported ISA ", host_isa_);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_horizon_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    TReg src = TReg(static_cast<uint32_t>(in[0]));
+    TReg dst = TReg(static_cast<uint32_t>(out[0]));
+
+    // The pairwise instructions of the register with itself reduce 4 lanes to 2 and then to 1,
+    // so the result is broadcasted to all the lanes as the x64 implementation does
+    switch (m_op_type) {
+        case OpType::max:
+            h->fmaxp(dst.s, src.s, src.s);
+            h->fmaxp(dst.s, dst.s, dst.s);
+            break;
+        case OpType::sum:
+            h->faddp(dst.s, src.s, src.s);
+            h->faddp(dst.s, dst.s, dst.s);
+            break;
+        default:
+            OV_CPU_JIT_EMITTER_THROW("Unsupported horizontal operation.");
+    }
+}
+
+}   // namespace aarch64
+}   // namespace intel_cpu
+}   // namespace ov
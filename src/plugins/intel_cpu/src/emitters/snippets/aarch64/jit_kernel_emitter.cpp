@@ -0,0 +1,255 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_kernel_emitter.hpp"
+
+#include "emitters/utils.hpp"
+#include "snippets/utils.hpp"
+
+using namespace Xbyak_aarch64;
+using namespace dnnl::impl::cpu::aarch64;
+
+namespace ov {
+namespace intel_cpu {
+namespace aarch64 {
+
+inline static std::vector<XReg> transform_idxs_to_regs(const std::vector<size_t>& idxs) {
+    std::vector<XReg> regs;
+    regs.reserve(idxs.size());
+    std::transform(idxs.begin(), idxs.end(), std::back_inserter(regs), [](size_t idx){return XReg(static_cast<uint32_t>(idx));});
+    return regs;
+}
+
+inline static std::vector<size_t> transform_snippets_regs_to_idxs(const std::vector<snippets::Reg>& regs) {
+    std::vector<size_t> idxs(regs.size());
+    std::transform(regs.cbegin(), regs.cend(), idxs.begin(), [](const snippets::Reg& reg) { return reg.idx; });
+    return idxs;
+}
+
+jit_kernel_emitter::jit_kernel_emitter(jit_generator* h, cpu_isa_t isa, const ov::snippets::lowered::ExpressionPtr& expr)
+    : jit_container_emitter(h, isa), reg_runtime_params_idx(abi_param1.getIdx()) {
+    const auto kernel = ov::as_type_ptr<snippets::op::Kernel>(expr->get_node());
+    OV_CPU_JIT_EMITTER_ASSERT(kernel != nullptr, "invoked with invalid op argument");
+    OV_CPU_JIT_EMITTER_ASSERT(!kernel->region.empty(), "invoked with empty body");
+    body = kernel->region;
+    jcp = *reinterpret_cast<const jit_snippets_compile_args*>(kernel->compile_params);
+    const auto& io_exprs = body.get_IO_ops();
+    for (const auto& expr : io_exprs) {
+        switch (expr->get_type()) {
+            case snippets::lowered::IOExpression::io_type::INPUT: {
+                num_inputs++;
+                break;
+            }
+            case snippets::lowered::IOExpression::io_type::OUTPUT: {
+                num_outputs++;
+                break;
+            } default : {
+                OV_CPU_JIT_EMITTER_THROW("detected unsupported io_type");
+            }
+        }
+        mem_access_exprs.push_back(expr);
+    }
+    std::set<size_t> unique_buffers;
+    for (const auto& expr : body) {
+        if (const auto buffer = ov::as_type_ptr<snippets::op::Buffer>(expr->get_node())) {
+            const auto buffer_id = buffer->get_id();
+            if (unique_buffers.count(buffer_id) == 0) {
+                mem_access_exprs.push_back(expr);
+                unique_buffers.insert(buffer_id);
+            }
+        } else {
+            if (std::find(io_exprs.cbegin(), io_exprs.cend(), expr) == io_exprs.cend())
+                general_exprs.emplace_back(expr);
+        }
+    }
+    num_unique_buffers = unique_buffers.size();
+}
+
+void jit_kernel_emitter::init_reg_pools(const std::set<size_t>& gpr_blacklist, const std::set<size_t>& vec_blacklist) {
+    // - x16-x30 are not used: x16-x17 are the intra-procedure-call registers, x18 is the platform register,
+    //   x19-x28 are callee-saved and partially reserved by jit_generator as the scratch registers (X_TMP_*, X_DEFAULT_ADDR),
+    //   x29-x30 are the frame pointer and the link register
+    // - v8-v15 are not used since their lower halves are callee-saved
+    const size_t gpr_count = 16;
+    const size_t vec_count = 32;
+    // It's easier to remove the last item during mapping, so fill descending to map ascending
+    for (size_t i = 0; i < gpr_count; i++)
+        gp_regs_pool.push_back(gpr_count - 1 - i);
+    for (size_t i = 0; i < vec_count; i++) {
+        const auto idx = vec_count - 1 - i;
+        if (idx < 8 || idx > 15)
+            vec_regs_pool.push_back(idx);
+    }
+    auto remove_regs_from_pool = [](std::vector<size_t>& pool, const std::set<size_t>& to_remove) {
+        // It's important to keep the order of other elements
+        pool.erase(std::remove_if(pool.begin(), pool.end(),
+                                  [&](size_t x) {return to_remove.count(x) != 0;}), pool.end());
+    };
+    remove_regs_from_pool(gp_regs_pool, gpr_blacklist);
+    remove_regs_from_pool(vec_regs_pool, vec_blacklist);
+}
+
+void jit_kernel_emitter::emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs) const {
+    validate_arguments(in, out);
+    emit_impl(in, out);
+}
+
+void jit_kernel_emitter::validate_arguments(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    OV_CPU_JIT_EMITTER_ASSERT(in.empty() && out.empty(), ": expects 0 registers on input and output");
+    const auto num_params = num_inputs + num_outputs + num_unique_buffers;
+    // The number of used gpr may be >= num_params since LoopBegin+LoopEnd could also use gpr to store work_amount
+    OV_CPU_JIT_EMITTER_ASSERT(data_ptr_regs_idx.size() == num_params,
+                              "number of inputs and outputs is inconsistent with the number of allocated registers ", num_params,
+                              " data_ptr_regs_idx.size() = ", data_ptr_regs_idx.size());
+}
+
+void jit_kernel_emitter::init_body_regs(const std::set<size_t>& kernel_regs,
+                                        const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs) {
+    // Initialize pools of gp and vec registers
+    // Reserve kernel regs (abi_param1 and, if there is, abi_param2), since they'll be used to pass runtime call args to kernel
+    init_reg_pools(kernel_regs, {});
+
+    mapping_info gpr_map_pool({}, gp_regs_pool);
+    mapping_info vec_map_pool({}, vec_regs_pool);
+
+    // Note that we can't use kernel_regs to store data pointers because
+    // these regs are used to calculate offsets for the data pointers
+    map_abstract_registers(gpr_map_pool, vec_map_pool, mem_access_exprs);
+    for (const auto& abstract_to_physical : gpr_map_pool.first)
+        data_ptr_regs_idx.push_back(abstract_to_physical.second);
+
+    gpr_map_pool.second.insert(gpr_map_pool.second.end(), pool_gpr_idxs.cbegin(), pool_gpr_idxs.cend());
+    vec_map_pool.second.insert(vec_map_pool.second.end(), pool_vec_idxs.cbegin(), pool_vec_idxs.cend());
+    map_abstract_registers(gpr_map_pool, vec_map_pool, general_exprs);
+}
+
+void jit_kernel_emitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    h->preamble();
+
+    auto data_ptr_regs = transform_idxs_to_regs(data_ptr_regs_idx);
+
+    init_data_pointers(data_ptr_regs);
+    for (const auto& expression : body) {
+        const auto reg_info = expression->get_reg_info();
+        auto in_regs = transform_snippets_regs_to_idxs(reg_info.first);
+        auto out_regs = transform_snippets_regs_to_idxs(reg_info.second);
+        const auto& emitter = expression->get_emitter();
+        emitter->emit_code(in_regs, out_regs, vec_regs_pool, gp_regs_pool);
+    }
+
+    h->postamble();
+}
+
+jit_kernel_static_emitter::jit_kernel_static_emitter(jit_generator* h, cpu_isa_t isa, const ov::snippets::lowered::ExpressionPtr& expr)
+    : jit_kernel_emitter(h, isa, expr), reg_indexes_idx(abi_param2.getIdx()) {
+    const auto kernel = ov::as_type_ptr<snippets::op::KernelStatic>(expr->get_node());
+    OV_CPU_JIT_EMITTER_ASSERT(kernel != nullptr, "expectes KernelStatic expression");
+    master_shape = body.get_master_shape();
+    io_shapes.reserve(num_inputs + num_outputs);
+    io_data_layouts.reserve(num_inputs + num_outputs);
+    io_data_sizes.reserve(num_inputs + num_outputs);
+    for (const auto& expr : body.get_IO_ops()) {
+        snippets::lowered::PortDescriptorPtr desc = nullptr;
+        element::Type etype;
+        switch (expr->get_type()) {
+            case snippets::lowered::IOExpression::io_type::INPUT: {
+                // input->shape changing ops->load
+                const auto& shape_infer_seq = ov::snippets::utils::get_first_child_shape_infer_expr_seq(expr);
+                const auto& mem_desc_expr = shape_infer_seq.empty() ? expr : shape_infer_seq.back();
+                for (const auto& child_input : mem_desc_expr->get_output_port_connector(0)->get_consumers()) {
+                    const auto ma = std::dynamic_pointer_cast<snippets::modifier::MemoryAccess>(child_input.get_expr()->get_node());
+                    if (ma && ma->is_memory_access_input_port(child_input.get_index())) {
+                        desc = child_input.get_descriptor_ptr();
+                        break;
+                    }
+                }
+                etype = mem_desc_expr->get_node()->get_output_element_type(0);
+                break;
+            }
+            case snippets::lowered::IOExpression::io_type::OUTPUT: {
+                // store->shape changing ops->result
+                const auto& shape_infer_seq = ov::snippets::utils::get_first_parent_shape_infer_expr_seq(expr);
+                const auto& mem_desc_expr = shape_infer_seq.empty() ? expr : shape_infer_seq.back();
+                desc = mem_desc_expr->get_input_port_connector(0)->get_source().get_descriptor_ptr();
+                etype = mem_desc_expr->get_node()->get_input_element_type(0);
+                break;
+            } default : {
+                OV_CPU_JIT_EMITTER_THROW("detected unsupported io_type");
+            }
+        }
+        OV_CPU_JIT_EMITTER_ASSERT(desc, "failed to find the memory access port of the I/O expression");
+        io_shapes.push_back(desc->get_shape());
+        io_data_layouts.push_back(desc->get_layout());
+        io_data_sizes.push_back(etype.size());
+    }
+    // Note: plugin can prepend master shape with 1 to facilitate parallel execution (usually up to 6D tensor)
+    //       so we have to reproduce this behavior here
+    master_shape.insert(master_shape.begin(), jcp.parallel_executor_ndims - master_shape.size(), 1);
+
+    // - Reserve abi_param1 and abi_param2, since they'll be used to pass runtime call args to kernel
+    // - However we can use reg_indexes_idx for non memory access operations
+    //   since we won't need them after offsets calculation
+    init_body_regs({reg_indexes_idx, reg_runtime_params_idx}, {}, {reg_indexes_idx});
+}
+
+void jit_kernel_static_emitter::init_data_pointers(const std::vector<XReg>& data_ptr_regs) const {
+    XReg reg_indexes = XReg(static_cast<uint32_t>(reg_indexes_idx));
+    XReg reg_runtime_params = XReg(static_cast<uint32_t>(reg_runtime_params_idx));
+    // jit_generator scratch registers aren't in the pools, so they can be used for the offsets calculation
+    XReg reg_offset = h->X_TMP_0;
+    XReg reg_index = h->X_TMP_1;
+
+    const auto num_params = num_inputs + num_outputs;
+    // Note that we don't need offset for the last dim, since it's handled directly by Loop emitters
+    const size_t offset_rank = master_shape.size() - 1;
+    auto offset_calculation = [=](const std::vector<size_t>& shape, const std::vector<size_t>& layout, const size_t data_size, bool is_input) {
+        // If a dim size == 1, then the next dim starts immediately and the stride is 0
+        std::vector<size_t> strides(shape.size());
+        size_t dim_step = 1;
+        strides[shape.size() - 1] = 1;
+        for (int k = static_cast<int>(shape.size()) - 2; k >= 0; k--) {
+            dim_step *= shape[k+1];
+            strides[k] = shape[k] != 1 ? dim_step * data_size : 0;
+        }
+        if (!layout.empty()) {
+            std::vector<size_t> reordered_strides(strides.size());
+            for (size_t i = 0; i < layout.size(); i++) {
+                const auto& src_idx = is_input ? layout[i] : i;
+                const auto& dst_idx = is_input ? i : layout[i];
+                reordered_strides[dst_idx] = strides[src_idx];
+            }
+            strides = std::move(reordered_strides);
+        }
+        // the last stride is ignored, since the entire last dim is processed by kernel
+        strides.pop_back();
+        // actual offset size might be larger that the shape size due to 6D scheduling
+        strides.insert(strides.begin(), offset_rank - strides.size(), 0);
+        return strides;
+    };
+    auto init_ptr_with_offset = [&](const XReg& pointer, const std::vector<size_t>& offsets) {
+        for (size_t j = 0; j < offset_rank; j++) {
+            if (master_shape[j] != 1 && offsets[j] != 0) {
+                h->mov(reg_offset, offsets[j]);
+                h->ldr(reg_index, ptr(reg_indexes, static_cast<int32_t>(j * sizeof(size_t))));
+                h->madd(pointer, reg_offset, reg_index, pointer);
+            }
+        }
+    };
+    // NOTE: Snippets Buffer Scratchpad has the common data pointer for all Buffers (even with different ID).
+    //       The accessing memory is covered by correct offsets in each Buffer and the corresponding MemoryAccess ops
+    for (size_t i = 0; i < num_unique_buffers; ++i) {
+        h->ldr(data_ptr_regs[num_params + i], ptr(reg_runtime_params, static_cast<int32_t>(GET_OFF(buffer_scratchpad_ptr))));
+    }
+    for (size_t i = 0; i < num_params; i++) {
+        const auto ptr_offset = i < num_inputs ? GET_OFF(src_ptrs) + i * sizeof(void*)
+                                               : GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*);
+        h->ldr(data_ptr_regs[i], ptr(reg_runtime_params, static_cast<int32_t>(ptr_offset)));
+        init_ptr_with_offset(data_ptr_regs[i], offset_calculation(io_shapes[i], io_data_layouts[i], io_data_sizes[i], i < num_inputs));
+    }
+}
+
+}   // namespace aarch64
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,80 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "emitters/snippets/jit_snippets_call_args.hpp"
+#include "jit_container_emitter.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace aarch64 {
+
+///
+/// \brief    Kernel is the only entry point to Codogen Jit compilation. Kernel perform abstract-to-physical register
+/// mapping and creates a pools of available gpr and vec registers. The structure of the enclosed emitters is the same
+/// as on x64: the loops over the outer dimensions contain the vector loop and the scalar loop for the tail processing.
+/// Note that Kernel doesn't accept any input arguments.
+///
+class jit_kernel_emitter : public jit_container_emitter {
+public:
+    jit_kernel_emitter(dnnl::impl::cpu::aarch64::jit_generator* h, dnnl::impl::cpu::aarch64::cpu_isa_t isa,
+                       const ov::snippets::lowered::ExpressionPtr& expr);
+
+    size_t get_inputs_count() const override {return 0;}
+    void emit_code(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs = {}, const std::vector<size_t> &pool_gpr_idxs = {}) const override;
+
+protected:
+    void validate_arguments(const std::vector<size_t>& in, const std::vector<size_t>& out) const;
+    void init_body_regs(const std::set<size_t>& kernel_regs, const std::vector<size_t> &pool_vec_idxs = {}, const std::vector<size_t> &pool_gpr_idxs = {});
+    /**
+     * @brief populates physical registers pools for aarch64 (both vec and gp).
+     * Skips the platform and the jit_generator scratch gprs and the callee-saved vector registers.
+     * @arg gpr_blacklist - set of gp registers that should not be added to register pool
+     * @arg vec_blacklist - set of vec registers should not be added to register pool
+     */
+    void init_reg_pools(const std::set<size_t>& gpr_blacklist, const std::set<size_t>& vec_blacklist);
+
+    virtual void init_data_pointers(const std::vector<Xbyak_aarch64::XReg>& data_ptr_regs) const = 0;
+
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const override;
+
+    jit_snippets_compile_args jcp;
+    // gpr's used to store data pointers, track them to apply offsets in Kernel
+    std::vector<size_t> data_ptr_regs_idx;
+    std::vector<size_t> vec_regs_pool;
+    std::vector<size_t> gp_regs_pool;
+    size_t num_inputs = 0;
+    size_t num_outputs = 0;
+    size_t num_unique_buffers = 0;
+
+    snippets::lowered::LinearIR::container mem_access_exprs;
+    snippets::lowered::LinearIR::container general_exprs;
+
+    const size_t reg_runtime_params_idx{0};
+};
+
+class jit_kernel_static_emitter : public jit_kernel_emitter {
+public:
+    jit_kernel_static_emitter(dnnl::impl::cpu::aarch64::jit_generator* h, dnnl::impl::cpu::aarch64::cpu_isa_t isa,
+                              const ov::snippets::lowered::ExpressionPtr& expr);
+
+private:
+    void init_data_pointers(const std::vector<Xbyak_aarch64::XReg>& data_ptr_regs) const override;
+
+    const size_t reg_indexes_idx{1};
+    std::vector<size_t> master_shape;
+
+    // Vector of indices (lenght = input tensor rank) per every input and output that describes in which order
+    // corresponding tensor dimensions are accessed (default: consecutive dense, e.g. 0,1,2,3 for 4D tensor).
+    // Needed to calc i/o offsets.
+    std::vector<std::vector<size_t>> io_data_layouts = {};
+    std::vector<std::vector<size_t>> io_shapes = {};
+    std::vector<size_t> io_data_sizes {};
+};
+
+}   // namespace aarch64
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,159 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_memory_emitters.hpp"
+
+#include "emitters/utils.hpp"
+
+using namespace Xbyak_aarch64;
+using namespace dnnl::impl::cpu::aarch64;
+
+namespace ov {
+namespace intel_cpu {
+namespace aarch64 {
+
+using jit_generator = dnnl::impl::cpu::aarch64::jit_generator;
+using cpu_isa_t = dnnl::impl::cpu::aarch64::cpu_isa_t;
+using ExpressionPtr = ov::snippets::lowered::ExpressionPtr;
+
+jit_memory_emitter::jit_memory_emitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr) : jit_emitter(h, isa) {
+    const auto n = expr->get_node();
+    src_prc = n->get_input_element_type(0);
+    dst_prc = n->get_output_element_type(0);
+    if (src_prc != dst_prc)
+        OV_CPU_JIT_EMITTER_THROW("supports only equal input and output types but gets: ",
+                                 src_prc.get_type_name(),
+                                 " and ",
+                                 dst_prc.get_type_name());
+    // Note: the conversions are performed by the separate Convert emitters in registers,
+    //       so the f16 data is loaded and stored as is to the lower half of the vector register
+    if (src_prc.size() != 4 && src_prc.size() != 2)
+        OV_CPU_JIT_EMITTER_THROW("supports only 32-bit and 16-bit data types but gets: ", src_prc.get_type_name());
+}
+
+XReg jit_memory_emitter::get_data_addr(const XReg& data_ptr, size_t offset) const {
+    if (offset == 0)
+        return data_ptr;
+    h->add_imm(h->X_DEFAULT_ADDR, data_ptr, static_cast<int64_t>(offset), h->X_TMP_0);
+    return h->X_DEFAULT_ADDR;
+}
+
+jit_load_memory_emitter::jit_load_memory_emitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr)
+    : jit_memory_emitter(h, isa, expr) {
+    const auto load = std::dynamic_pointer_cast<snippets::op::Load>(expr->get_node());
+    OV_CPU_JIT_EMITTER_ASSERT(load != nullptr, "expects Load expression");
+    count = load->get_count();
+    byte_offset = load->get_offset();
+    in_out_type_ = emitter_in_out_map::gpr_to_vec;
+}
+
+void jit_load_memory_emitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    if (host_isa_ == dnnl::impl::cpu::aarch64::asimd) {
+        emit_isa<dnnl::impl::cpu::aarch64::asimd>(in, out);
+    } else {
+        OV_CPU_JIT_EMITTER_THROW("Unsupported ISA ", host_isa_);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_load_memory_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    const auto addr = get_data_addr(XReg(static_cast<uint32_t>(in[0])), byte_offset);
+    const auto dst_idx = static_cast<uint32_t>(out[0]);
+
+    // Note: the scalar loads zero the upper lanes of the destination register
+    switch (count * src_prc.size()) {
+        case 16: h->ldr(QReg(dst_idx), ptr(addr)); break;
+        case 12: {
+            h->ldr(DReg(dst_idx), ptr(addr));
+            h->add_imm(h->X_DEFAULT_ADDR, addr, 8, h->X_TMP_0);
+            h->ld1(TReg(dst_idx).s[2], ptr(h->X_DEFAULT_ADDR));
+            break;
+        }
+        case 8: h->ldr(DReg(dst_idx), ptr(addr)); break;
+        case 6: {
+            h->ldr(SReg(dst_idx), ptr(addr));
+            h->add_imm(h->X_DEFAULT_ADDR, addr, 4, h->X_TMP_0);
+            h->ld1(TReg(dst_idx).h[2], ptr(h->X_DEFAULT_ADDR));
+            break;
+        }
+        case 4: h->ldr(SReg(dst_idx), ptr(addr)); break;
+        case 2: h->ldr(HReg(dst_idx), ptr(addr)); break;
+        default: OV_CPU_JIT_EMITTER_THROW("Unsupported count: ", count);
+    }
+}
+
+jit_load_broadcast_emitter::jit_load_broadcast_emitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr)
+    : jit_memory_emitter(h, isa, expr) {
+    const auto broadcast_load = std::dynamic_pointer_cast<snippets::op::BroadcastLoad>(expr->get_node());
+    OV_CPU_JIT_EMITTER_ASSERT(broadcast_load != nullptr, "expects BroadcastLoad expression");
+    byte_offset = broadcast_load->get_offset();
+    in_out_type_ = emitter_in_out_map::gpr_to_vec;
+}
+
+void jit_load_broadcast_emitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    if (host_isa_ == dnnl::impl::cpu::aarch64::asimd) {
+        emit_isa<dnnl::impl::cpu::aarch64::asimd>(in, out);
+    } else {
+        OV_CPU_JIT_EMITTER_THROW("Unsupported ISA ", host_isa_);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_load_broadcast_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    const auto addr = get_data_addr(XReg(static_cast<uint32_t>(in[0])), byte_offset);
+    if (src_prc.size() == 2)
+        h->ld1r(TReg(static_cast<uint32_t>(out[0])).h, ptr(addr));
+    else
+        h->ld1r(TReg(static_cast<uint32_t>(out[0])).s, ptr(addr));
+}
+
+jit_store_memory_emitter::jit_store_memory_emitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr)
+    : jit_memory_emitter(h, isa, expr) {
+    const auto store = std::dynamic_pointer_cast<snippets::op::Store>(expr->get_node());
+    OV_CPU_JIT_EMITTER_ASSERT(store != nullptr, "expects Store expression");
+    count = store->get_count();
+    byte_offset = store->get_offset();
+    in_out_type_ = emitter_in_out_map::vec_to_gpr;
+}
+
+void jit_store_memory_emitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    if (host_isa_ == dnnl::impl::cpu::aarch64::asimd) {
+        emit_isa<dnnl::impl::cpu::aarch64::asimd>(in, out);
+    } else {
+        OV_CPU_JIT_EMITTER_THROW("Unsupported ISA ", host_isa_);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_store_memory_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    const auto src_idx = static_cast<uint32_t>(in[0]);
+    const auto addr = get_data_addr(XReg(static_cast<uint32_t>(out[0])), byte_offset);
+
+    switch (count * dst_prc.size()) {
+        case 16: h->str(QReg(src_idx), ptr(addr)); break;
+        case 12: {
+            h->str(DReg(src_idx), ptr(addr));
+            h->add_imm(h->X_DEFAULT_ADDR, addr, 8, h->X_TMP_0);
+            h->st1(TReg(src_idx).s[2], ptr(h->X_DEFAULT_ADDR));
+            break;
+        }
+        case 8: h->str(DReg(src_idx), ptr(addr)); break;
+        case 6: {
+            h->str(SReg(src_idx), ptr(addr));
+            h->add_imm(h->X_DEFAULT_ADDR, addr, 4, h->X_TMP_0);
+            h->st1(TReg(src_idx).h[2], ptr(h->X_DEFAULT_ADDR));
+            break;
+        }
+        case 4: h->str(SReg(src_idx), ptr(addr)); break;
+        case 2: h->str(HReg(src_idx), ptr(addr)); break;
+        default: OV_CPU_JIT_EMITTER_THROW("Unsupported count: ", count);
+    }
+}
+
+}   // namespace aarch64
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,99 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include "emitters/utils.hpp"
+#include "openvino/core/type/float16.hpp"
+
+using namespace Xbyak_aarch64;
+using namespace dnnl::impl::cpu::aarch64;
+
+namespace ov {
+namespace intel_cpu {
+namespace aarch64 {
+
+using jit_generator = dnnl::impl::cpu::aarch64::jit_generator;
+using cpu_isa_t = dnnl::impl::cpu::aarch64::cpu_isa_t;
+using ExpressionPtr = ov::snippets::lowered::ExpressionPtr;
+
+jit_nop_emitter::jit_nop_emitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr)
+    : jit_emitter(h, isa) {
+    in_out_type_ = emitter_in_out_map::gpr_to_gpr;
+}
+
+jit_broadcast_move_emitter::jit_broadcast_move_emitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr)
+    : jit_emitter(h, isa) {
+    const auto n = expr->get_node();
+    if (n->get_input_element_type(0) != n->get_output_element_type(0))
+        OV_CPU_JIT_EMITTER_THROW("supports only equal input and output types but gets: ",
+                                 n->get_input_element_type(0),
+                                 " and ",
+                                 n->get_output_element_type(0));
+    byte_size = n->get_input_element_type(0).size();
+}
+
+void jit_broadcast_move_emitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    if (host_isa_ == dnnl::impl::cpu::aarch64::asimd) {
+        emit_isa<dnnl::impl::cpu::aarch64::asimd>(in, out);
+    } else {
+        OV_CPU_JIT_EMITTER_THROW("Unsupported ISA ", host_isa_);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_broadcast_move_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    TReg src = TReg(static_cast<uint32_t>(in[0]));
+    TReg dst = TReg(static_cast<uint32_t>(out[0]));
+
+    switch (byte_size) {
+        case 4: h->dup(dst.s, src.s[0]); break;
+        case 2: h->dup(dst.h, src.h[0]); break;
+        case 1: h->dup(dst.b, src.b[0]); break;
+        default: OV_CPU_JIT_EMITTER_THROW("unsupported data type");
+    }
+}
+
+jit_scalar_emitter::jit_scalar_emitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr) : jit_emitter(h, isa) {
+    const auto n = ov::as_type_ptr<ov::op::v0::Constant>(expr->get_node());
+    OV_CPU_JIT_EMITTER_ASSERT(n, "Invalid node, expected op::v0::Constant");
+    const auto& precision = n->get_output_element_type(0);
+    switch (precision) {
+        case element::i32: value = static_cast<uint32_t>(n->cast_vector<int32_t>(1)[0]); break;
+        case element::f32: value = dnnl::impl::float2int(n->cast_vector<float>(1)[0]); break;
+        case element::f16: {
+            // the 16-bit value is duplicated in both halves, so the 32-bit broadcast fills all the f16 lanes
+            const auto bits = static_cast<uint32_t>(ov::float16(n->cast_vector<float>(1)[0]).to_bits());
+            value = bits | (bits << 16);
+            break;
+        }
+        default: OV_CPU_JIT_EMITTER_THROW("doesn't support ", precision);
+    }
+    in_out_type_ = emitter_in_out_map::gpr_to_vec;
+    prepare_table();
+}
+
+void jit_scalar_emitter::register_table_entries() {
+    push_arg_entry_of("scalar", value, true);
+}
+
+void jit_scalar_emitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    if (host_isa_ == dnnl::impl::cpu::aarch64::asimd) {
+        emit_isa<dnnl::impl::cpu::aarch64::asimd>(in, out);
+    } else {
+        OV_CPU_JIT_EMITTER_THROW("Unsupported ISA ", host_isa_);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_scalar_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using TReg = typename dnnl::impl::cpu::aarch64::cpu_isa_traits<isa>::TReg;
+    TReg dst = TReg(static_cast<uint32_t>(out[0]));
+    h->ld1r(dst.s, table_val2("scalar"));
+}
+
+}   // namespace aarch64
+}   // namespace intel_cpu
+}   // namespace ov
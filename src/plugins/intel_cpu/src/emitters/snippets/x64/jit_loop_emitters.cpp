@@ -97,7 +97,8 @@ void jit_loop_begin_dynamic_emitter::emit_impl(const std::vector<size_t>& in, co
     h->mov(reg_loop_args_ptr, h->ptr[reg_runtime_params + GET_OFF(loop_args)]);
     h->mov(reg_work_amount, h->ptr[reg_loop_args_ptr + id_offset + GET_OFF_LOOP_ARGS(m_work_amount)]);
 
-    // if wa < increment, skip the loop
+    // if wa < increment, skip the loop body: the finalization offsets are still applied,
+    // since the data pointers may be shifted by the tail loop executed before the main body
     h->cmp(reg_work_amount, wa_increment);
     h->jl(*loop_end_label, Xbyak::CodeGenerator::T_NEAR);
 
@@ -237,14 +238,14 @@ void jit_loop_end_dynamic_emitter::emit_impl(const std::vector<size_t>& in, cons
     h->cmp(reg_work_amount, wa_increment);
     h->jge(*loop_begin_label, Xbyak::CodeGenerator::T_NEAR);
 
+    h->L(*loop_end_label);
+
     h->mov(reg_increments, h->ptr[reg_runtime_params + GET_OFF(loop_args)]);
     h->mov(reg_increments, h->ptr[reg_increments + id_offset + GET_OFF_LOOP_ARGS(m_finalization_offsets)]);
     for (size_t idx = 0; idx < data_ptr_regs.size(); idx++) {
         if (is_incremented[idx])
             h->add(data_ptr_regs[idx], h->ptr[reg_increments + idx * sizeof(int64_t)]);
     }
-
-    h->L(*loop_end_label);
 }
 
 /* ============================================================== */
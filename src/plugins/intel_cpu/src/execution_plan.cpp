@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "execution_plan.h"
+
+#include "infer_request.h"
+#include "itt.h"
+
+namespace ov {
+namespace intel_cpu {
+
+ExecutionPlan::ExecutionPlan(const std::vector<NodePtr>& executableNodes, const dnnl::engine& engine)
+    : m_stream(engine) {
+    m_records.reserve(executableNodes.size());
+    for (const auto& node : executableNodes) {
+        Record record{node.get(), nullptr, m_args.size(), 0};
+        auto primitive = node->getReplayablePrimitive();
+        if (primitive) {
+            record.primitive = primitive.get();
+            m_primitives.push_back(primitive);
+            for (const auto& arg : node->primArgs) {
+                m_args.push_back({arg.first, arg.second.get()});
+                m_memories.push_back(arg.second);
+            }
+            record.numArgs = static_cast<int>(node->primArgs.size());
+        }
+        m_records.push_back(record);
+    }
+}
+
+void ExecutionPlan::run(SyncInferRequest* request) {
+    for (const auto& record : m_records) {
+        OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, record.node->profiling.execute);
+        if (request)
+            request->throw_if_canceled();
+
+        if (record.primitive) {
+            const auto args = m_args.data() + record.argsOffset;
+            dnnl::error::wrap_c_api(dnnl_primitive_execute(record.primitive, m_stream.get(), record.numArgs, args),
+                                    "could not execute a primitive");
+        } else {
+            record.node->execute(m_stream);
+        }
+    }
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include "node.h"
+
+namespace ov {
+namespace intel_cpu {
+
+class SyncInferRequest;
+
+/**
+ * @brief Flat list of the executable nodes of a static graph, which is built after the first inference and
+ *        replayed by the following ones.
+ *
+ * The nodes executing a single oneDNN primitive (see Node::getReplayablePrimitive) are stored as the primitive
+ * with the pre-bound arguments and executed via the oneDNN C API without the virtual dispatch and the conversion
+ * of the argument map. Other nodes are executed via Node::execute. The replay doesn't allocate anything: the
+ * arguments are the oneDNN memory objects of the edges, whose data handles are updated in place when the input or
+ * output tensors are rebound to the user memory.
+ */
+class ExecutionPlan {
+public:
+    using Ptr = std::shared_ptr<ExecutionPlan>;
+
+    ExecutionPlan(const std::vector<NodePtr>& executableNodes, const dnnl::engine& engine);
+
+    void run(SyncInferRequest* request);
+
+private:
+    struct Record {
+        Node* node;
+        dnnl_primitive_t primitive;  // nullptr if the node is executed via Node::execute
+        size_t argsOffset;
+        int numArgs;
+    };
+
+    std::vector<Record> m_records;
+    std::vector<dnnl_exec_arg_t> m_args;
+    // keep the primitives and the memory objects referred by the records alive
+    std::vector<dnnl::primitive> m_primitives;
+    std::vector<dnnl::memory> m_memories;
+    dnnl::stream m_stream;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -286,10 +286,34 @@ void Graph::InitGraph(bool optimize) {
 
     const auto hasDynNodes = ProcessDynNodes();
 
+    dataflowExecution = getConfig().dataflowExecution && !hasDynNodes &&
+                        DataflowScheduler::isApplicable(graphNodes) &&
+                        std::all_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+                            return node->parallelWith.empty();
+                        });
+
     Allocate();
 
+    // the final decision is made by the memory planner, the nodes of the sequential graph share the scratch pad
+    if (dataflowExecution)
+        context->enableConcurrentNodes();
+
     CreatePrimitivesAndExecConstants();
 
+    // the nodes sharing the scratch pad have the same memory manager
+    std::unordered_map<IMemoryMngr*, size_t> scratchPads;
+    for (const auto& node : graphNodes) {
+        if (node->scratchpadMem && node->scratchpadMem->getDesc().isDefined()) {
+            auto& size = scratchPads[node->scratchpadMem->getMemoryMngr().get()];
+            size = std::max(size, node->scratchpadMem->getSize());
+        }
+    }
+    scratchPadsSize = 0;
+    for (const auto& scratchPad : scratchPads) {
+        scratchPadsSize += scratchPad.second;
+    }
+    checkActivationMemoryBudget(memWorkspace->getSize() + scratchPadsSize);
+
 #ifndef CPU_DEBUG_CAPS
     for (auto &graphNode : graphNodes) {
         graphNode->cleanup();
@@ -299,6 +323,9 @@ void Graph::InitGraph(bool optimize) {
     ExtractExecutableNodes();
     SearchInternalStateNodes();
 
+    if (dataflowExecution)
+        dataflowScheduler = std::make_shared<DataflowScheduler>(executableGraphNodes);
+
     status = hasDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 
     CPU_DEBUG_CAP_ENABLE(serialize(*this));
@@ -716,60 +743,86 @@ void Graph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // In the dataflow mode the nodes may be executed in any order respecting the dependencies, so the tensor lives
+    // through all the positions its producer and consumers may take in such orders
+    std::vector<int> earliestExecIndex, latestExecIndex;
+    if (dataflowExecution)
+        DataflowScheduler::getExecIndexBounds(graphNodes, earliestExecIndex, latestExecIndex);
+
     // Markup the boxes
     std::vector<ov::MemorySolver::Box> definedBoxes;
     std::vector<ov::MemorySolver::Box> undefinedBoxes;
-    for (size_t i = 0; i < remaining_edge_clusters_count; i++) {
-        ov::MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, static_cast<int64_t>(i) };
-        int64_t boxSize = 0;
-        for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
-
-            if (boxSize != -1 && edge->getDesc().isDefined()) {
-                int64_t e_size = edge->getDesc().getCurrentMemSize();  // size in bytes (from the beginning of data to the last element)
-                boxSize = std::max(e_size, boxSize);
-            } else {
-                boxSize = -1;
-            }
+    auto markupBoxes = [&]() {
+        definedBoxes.clear();
+        undefinedBoxes.clear();
+        for (size_t i = 0; i < remaining_edge_clusters_count; i++) {
+            ov::MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, static_cast<int64_t>(i) };
+            int64_t boxSize = 0;
+            for (auto &edge : edge_clusters[i]) {
+                int e_start = edge->getParent()->execIndex;
+                int e_finish = edge->getChild()->execIndex;
+                if (dataflowExecution) {
+                    e_start = earliestExecIndex[e_start];
+                    e_finish = latestExecIndex[e_finish];
+                }
 
-            box.start = std::min(e_start, box.start);
-            box.finish = std::max(e_finish, box.finish);
-        }
+                if (boxSize != -1 && edge->getDesc().isDefined()) {
+                    int64_t e_size = edge->getDesc().getCurrentMemSize();  // size in bytes (from the beginning of data to the last element)
+                    boxSize = std::max(e_size, boxSize);
+                } else {
+                    boxSize = -1;
+                }
 
-        // Constant data are filled once on load.
-        // So we need it untouchable during all execution time
-        // -1 is a place holder for a max timestamp.
-        bool isConst = false, isOutput = false, isInput = false;
-        for (auto &edge : edge_clusters[i]) {
-            isConst  |= isConstOutput(edge);
-            isOutput |= edge->getChild()->getType() == Type::Output;
-            isInput  |= edge->getParent()->getType() == Type::Input;
-        }
+                box.start = std::min(e_start, box.start);
+                box.finish = std::max(e_finish, box.finish);
+            }
 
-        if (reuse_io_tensors) {
-            if (isInput | isConst) box.start = 0;
-            if (isOutput | isConst) box.finish = -1;
-        } else {
-            if (isInput  | isOutput | isConst) {
-                box.start = 0;
-                box.finish = -1;
+            // Constant data are filled once on load.
+            // So we need it untouchable during all execution time
+            // -1 is a place holder for a max timestamp.
+            bool isConst = false, isOutput = false, isInput = false;
+            for (auto &edge : edge_clusters[i]) {
+                isConst  |= isConstOutput(edge);
+                isOutput |= edge->getChild()->getType() == Type::Output;
+                isInput  |= edge->getParent()->getType() == Type::Input;
             }
-        }
 
-        if (boxSize != -1) {
-            box.size = div_up(boxSize, alignment);
-            definedBoxes.push_back(box);
-        } else {
-            box.size = boxSize;
-            undefinedBoxes.push_back(box);
+            if (reuse_io_tensors) {
+                if (isInput | isConst) box.start = 0;
+                if (isOutput | isConst) box.finish = -1;
+            } else {
+                if (isInput  | isOutput | isConst) {
+                    box.start = 0;
+                    box.finish = -1;
+                }
+            }
+
+            if (boxSize != -1) {
+                box.size = div_up(boxSize, alignment);
+                definedBoxes.push_back(box);
+            } else {
+                box.size = boxSize;
+                undefinedBoxes.push_back(box);
+            }
         }
-    }
+    };
+    markupBoxes();
 
     // Process defined boxes (static shapes)
     ov::MemorySolver staticMemSolver(definedBoxes);
     size_t total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
+    // The concurrent execution of the independent branches makes the tensors live longer, so the branches are
+    // serialized if the plan doesn't fit into the budget. The scratch pads are checked after the primitives creation.
+    const auto budget = getConfig().activationMemoryBudget;
+    if (budget && total_size > budget && dataflowExecution) {
+        dataflowExecution = false;
+        markupBoxes();
+        staticMemSolver = ov::MemorySolver(definedBoxes);
+        total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+    }
+    checkActivationMemoryBudget(total_size);
+
     memWorkspace = std::make_shared<Memory>(getEngine(), DnnlBlockedMemoryDesc(ov::element::i8, Shape(VectorDims{total_size})));
 
     if (edge_clusters.empty())
@@ -852,9 +905,31 @@ void Graph::AllocateWithReuse() {
 
         ov::MemorySolver::normalize_boxes(undefinedBoxes);
 
-        std::vector<std::vector<ov::MemorySolver::Box>> groups; //groups of nonoverlapping boxes
         constexpr bool enableMemReuse = true; // set false to disable mem reuse for debug purposes
+
+        // The intermediate tensors are placed to the arena of the dynamic memory planner. The input, output and state
+        // tensors keep their own memory managers, since they may be rebound to the external memory or be accessed
+        // between the inferences.
+        std::vector<ov::MemorySolver::Box> arenaBoxes;
         if (enableMemReuse) {
+            auto isIntermediate = [&](const ov::MemorySolver::Box& box) {
+                for (const auto& edge : edge_clusters[box.id]) {
+                    if (one_of(edge->getParent()->getType(), Type::Input, Type::MemoryInput) ||
+                        one_of(edge->getChild()->getType(), Type::Output, Type::MemoryOutput))
+                        return false;
+                }
+                return true;
+            };
+            auto arenaBegin = std::stable_partition(undefinedBoxes.begin(), undefinedBoxes.end(),
+                                                    [&](const ov::MemorySolver::Box& box) {
+                                                        return !isIntermediate(box);
+                                                    });
+            arenaBoxes.assign(arenaBegin, undefinedBoxes.end());
+            undefinedBoxes.erase(arenaBegin, undefinedBoxes.end());
+        }
+
+        std::vector<std::vector<ov::MemorySolver::Box>> groups; //groups of nonoverlapping boxes
+        if (enableMemReuse && !undefinedBoxes.empty()) {
             groups.push_back({undefinedBoxes.front()});
             for (size_t i = 1; i < undefinedBoxes.size(); ++i) {
                 const auto& box = undefinedBoxes[i];
@@ -888,6 +963,19 @@ void Graph::AllocateWithReuse() {
                 }
             }
         }
+
+        if (!arenaBoxes.empty()) {
+            // the static workspace is already within the budget
+            const size_t dynamicBudget = budget ? budget - total_size : std::numeric_limits<size_t>::max();
+            dynamicMemoryPlanner = std::make_shared<DynamicMemoryPlanner>(arenaBoxes, dynamicBudget);
+            for (size_t i = 0; i < arenaBoxes.size(); i++) {
+                for (auto& edge : edge_clusters[arenaBoxes[i].id]) {
+                    if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                        edge->allocate(dynamicMemoryPlanner->getMemoryMngr(i));
+                    }
+                }
+            }
+        }
     }
 
     // Resolve all other edges with status NotAllocated and in-place
@@ -951,6 +1039,20 @@ void Graph::Allocate() {
     for (auto& edge : graphEdges) edge->validate();
 }
 
+void Graph::checkActivationMemoryBudget(size_t plannedSize) const {
+    const auto budget = getConfig().activationMemoryBudget;
+    if (budget && plannedSize > budget) {
+        OPENVINO_THROW("[CPU] The memory planned for the intermediate tensors of the model '",
+                       GetName(),
+                       "' is ",
+                       plannedSize,
+                       " bytes, which exceeds the activation memory budget of ",
+                       budget,
+                       " bytes",
+                       dataflowExecution ? ". The dataflow execution mode allocates a scratch pad per node" : "");
+    }
+}
+
 bool Graph::ProcessDynNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ProcessDynNodes");
 
@@ -1092,6 +1194,11 @@ void Graph::PullOutputData(std::unordered_map<std::size_t, ov::SoPtr<ITensor>>&
 }
 
 void Graph::InferStatic(SyncInferRequest* request) {
+    if (executionPlan) {
+        executionPlan->run(request);
+        return;
+    }
+
     dnnl::stream stream(getEngine());
 
     for (const auto& node : executableGraphNodes) {
@@ -1102,6 +1209,32 @@ void Graph::InferStatic(SyncInferRequest* request) {
             request->throw_if_canceled();
         ExecuteNode(node, stream);
     }
+
+    // The nodes are completely set up by the first inference (e.g. moved to the NUMA node of the stream), so the
+    // following ones may replay the plan. The plan bypasses the per node profiling and debug hooks.
+#ifndef CPU_DEBUG_CAPS
+    const bool hasParallelNodes = std::any_of(executableGraphNodes.begin(), executableGraphNodes.end(),
+                                              [](const NodePtr& node) {
+                                                  return !node->parallelWith.empty();
+                                              });
+    if (getConfig().executionPlanReplay && !getConfig().collectPerfCounters && !hasParallelNodes)
+        executionPlan = std::make_shared<ExecutionPlan>(executableGraphNodes, getEngine());
+#endif
+}
+
+void Graph::InferDataflow(SyncInferRequest* request) {
+    dataflowScheduler->run([&](size_t i) {
+        const auto& node = executableGraphNodes[i];
+        // the stream is not shared by the nodes executed concurrently
+        dnnl::stream stream(getEngine());
+
+        VERBOSE(node, getConfig().debugCaps.verbose);
+        PERF(node, getConfig().collectPerfCounters);
+
+        if (request)
+            request->throw_if_canceled();
+        ExecuteNode(node, stream);
+    });
 }
 
 namespace {
@@ -1322,26 +1455,46 @@ void Graph::InferDynamic(SyncInferRequest* request) {
     }
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
-    std::unique_ptr<IUpdateNodes> updateNodes{};
-    if (parallel_get_max_threads() > 1) {
-        updateNodes.reset(new UpdateNodes(executableGraphNodes));
-    } else {
-        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
-    }
-    size_t inferCounter = 0;
+    auto inferNodes = [&]() {
+        std::unique_ptr<IUpdateNodes> updateNodes{};
+        if (parallel_get_max_threads() > 1) {
+            updateNodes.reset(new UpdateNodes(executableGraphNodes));
+        } else {
+            updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
+        }
+        size_t inferCounter = 0;
 
-    for (auto stopIndx : syncIndsWorkSet) {
-        updateNodes->run(stopIndx);
-        for (; inferCounter < stopIndx; ++inferCounter) {
-            auto& node = executableGraphNodes[inferCounter];
-            VERBOSE(node, getConfig().debugCaps.verbose);
-            PERF(node, getConfig().collectPerfCounters);
+        for (auto stopIndx : syncIndsWorkSet) {
+            updateNodes->run(stopIndx);
+            for (; inferCounter < stopIndx; ++inferCounter) {
+                auto& node = executableGraphNodes[inferCounter];
+                VERBOSE(node, getConfig().debugCaps.verbose);
+                PERF(node, getConfig().collectPerfCounters);
 
-            if (request)
-                request->throw_if_canceled();
-            ExecuteNode(node, stream);
+                if (request)
+                    request->throw_if_canceled();
+                ExecuteNode(node, stream);
+            }
         }
+    };
+
+    if (!dynamicMemoryPlanner) {
+        inferNodes();
+        return;
+    }
+
+    try {
+        inferNodes();
+    } catch (...) {
+        // No intermediate data is alive anymore, so the offsets are re-solved with the sizes requested by the failed
+        // inference. The inference which has exceeded the budget is repeated if the new layout fits into it, unless
+        // the nodes executed before the failure have changed the state of the graph.
+        const bool budgetExceeded = dynamicMemoryPlanner->isBudgetExceeded();
+        if (!dynamicMemoryPlanner->update() || !budgetExceeded || !internalStateNodes.empty())
+            throw;
+        inferNodes();
     }
+    dynamicMemoryPlanner->update();
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -1349,9 +1502,9 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
         // run nodes in parallel
         auto& parallelNodes = node->parallelWith;
         if (node == parallelNodes[0]) {
-            if (const auto& cpuExecutor = context->getCPUStreamExecutor()) {
+            if (context->getCPUStreamExecutor()) {
                 auto num_parallel_nodes = parallelNodes.size();
-                ParalleMtNuma(num_parallel_nodes, cpuExecutor, [&](int subStreamID, size_t i) {
+                context->parallelOnNumaNodes(num_parallel_nodes, [&](int subStreamID, size_t i) {
                     auto& n = parallelNodes[i];
 
                     n->toNumaNode(subStreamID);
@@ -1390,44 +1543,6 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     }
 }
 
-void Graph::ParalleMtNuma(size_t num_nodes,
-                          ov::threading::CPUStreamsExecutor::Ptr executor,
-                          const std::function<void(size_t, size_t)>& func) const {
-    OPENVINO_ASSERT(num_nodes > 1, "Parallel Nodes must be more than 1. But now got ",
-                                   num_nodes,
-                                   " Nodes, which shouldn't invoke multi nodes parallel.");
-    std::atomic<int> nodes_remain(num_nodes);
-    int cur_numa_id = executor->get_numa_node_id();
-    // enqueue (nsockets-1) sub stream tasks
-    int sub_stream_id = 0;
-    for (size_t socket_id = 0; socket_id < num_nodes; socket_id++) {
-        if (socket_id != static_cast<size_t>(cur_numa_id)) {
-            size_t i0{0}, i1{0};
-            splitter(num_nodes, num_nodes, socket_id, i0, i1);
-            executor->run_sub_stream(
-                [socket_id, i0, i1, &func, &nodes_remain]() {
-                    for (size_t i = i0; i < i1; i++) {
-                        func(socket_id, i);
-                        nodes_remain--;
-                    }
-                },
-                sub_stream_id);
-            sub_stream_id++;
-        }
-    }
-    // run in main stream (current socket)
-    {
-        size_t i0{0}, i1{0};
-        splitter(num_nodes, num_nodes, static_cast<size_t>(cur_numa_id), i0, i1);
-        for (size_t i = i0; i < i1; i++) {
-            func(cur_numa_id, i);
-            nodes_remain--;
-        }
-    }
-    // wait and sync
-    while (nodes_remain.load() > 0) {}
-}
-
 void Graph::Infer(SyncInferRequest* request) {
     DEBUG_LOG("Starting inference of the graph: ", GetName(), ". Status: ", static_cast<int>(status));
     if (!IsReady()) {
@@ -1437,7 +1552,11 @@ void Graph::Infer(SyncInferRequest* request) {
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        if (dataflowScheduler) {
+            InferDataflow(request);
+        } else {
+            InferStatic(request);
+        }
     } else {
         OPENVINO_THROW("Unknown ov::intel_cpu::Graph state: " , static_cast<size_t>(status));
     }
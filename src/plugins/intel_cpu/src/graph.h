@@ -6,6 +6,9 @@
 
 #include "config.h"
 #include "cpu_memory.h"
+#include "dataflow_scheduler.h"
+#include "dynamic_memory_planner.h"
+#include "execution_plan.h"
 #include "openvino/runtime/profiling_info.hpp"
 #include "node.h"
 #include "edge.h"
@@ -103,6 +106,22 @@ public:
 
     void GetPerfData(std::vector<ov::ProfilingInfo> &perfMap) const;
 
+    // the static graph is executed by the dataflow scheduler, see ov::intel_cpu::dataflow_execution
+    bool isDataflowExecution() const {
+        return dataflowScheduler != nullptr;
+    }
+
+    /**
+     * @brief Returns the biggest size in bytes of the memory allocated for the intermediate tensors: the static
+     * workspace, the scratch pads and the arena of the dynamic shape tensors, including the tensors which didn't fit
+     * into the arena. The value is available right after the graph creation and may be called concurrently with
+     * the inference.
+     */
+    size_t getPeakActivationMemorySize() const {
+        return (memWorkspace ? memWorkspace->getSize() : 0) + scratchPadsSize +
+               (dynamicMemoryPlanner ? dynamicMemoryPlanner->getPeakSize() : 0);
+    }
+
     void CreateEdge(const NodePtr& parent,
                  const NodePtr& child,
                  int parentPort = 0,
@@ -199,6 +218,8 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         syncNodesInds.clear();
+        dataflowScheduler.reset();
+        executionPlan.reset();
     }
     Status status { Status::NotReady };
 
@@ -209,6 +230,10 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    // the arena of the dynamic shape intermediate tensors
+    DynamicMemoryPlanner::Ptr dynamicMemoryPlanner;
+    // the size of the scratch pads allocated for the primitives on the graph creation
+    size_t scratchPadsSize = 0;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -228,15 +253,14 @@ protected:
     void GroupParallelNodes();
     void Allocate();
     void AllocateWithReuse();
+    void checkActivationMemoryBudget(size_t plannedSize) const;
     void ExtractExecutableNodes();
     void SearchInternalStateNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
     void InferStatic(SyncInferRequest* request);
     void InferDynamic(SyncInferRequest* request);
-    void ParalleMtNuma(size_t num_nodes,
-                       ov::threading::CPUStreamsExecutor::Ptr executor,
-                       const std::function<void(size_t, size_t)>& func) const;
+    void InferDataflow(SyncInferRequest* request);
 
     friend class intel_cpu::SyncInferRequest;
     friend std::shared_ptr<ov::Model> dump_graph_as_ie_ngraph_net(const Graph &graph);
@@ -256,6 +280,12 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // the static graph is executed by the dataflow scheduler, see ov::intel_cpu::dataflow_execution
+    bool dataflowExecution = false;
+    DataflowScheduler::Ptr dataflowScheduler;
+    // built by the first inference of the static graph, see ov::intel_cpu::execution_plan_replay
+    ExecutionPlan::Ptr executionPlan;
+
     GraphContext::CPtr context;
 
     void EnforceInferencePrecision();
@@ -4,6 +4,10 @@
 #include "dnnl_types.h"
 #include "graph_context.h"
 
+#include <atomic>
+
+#include "openvino/core/parallel.hpp"
+
 namespace ov {
 namespace intel_cpu {
 
@@ -12,5 +16,42 @@ const dnnl::engine& GraphContext::getEngine() {
     return eng;
 }
 
+void GraphContext::parallelOnNumaNodes(size_t num_parts, const std::function<void(int, size_t)>& func) const {
+    OPENVINO_ASSERT(num_parts > 1, "Parallel parts must be more than 1. But now got ",
+                                   num_parts,
+                                   " parts, which shouldn't invoke multi sockets parallel.");
+    OPENVINO_ASSERT(cpuStreamExecutor, "Multi sockets parallel requires cpu stream executor");
+    std::atomic<int> parts_remain(static_cast<int>(num_parts));
+    int cur_numa_id = cpuStreamExecutor->get_numa_node_id();
+    // enqueue (nsockets-1) sub stream tasks
+    int sub_stream_id = 0;
+    for (size_t socket_id = 0; socket_id < num_parts; socket_id++) {
+        if (socket_id != static_cast<size_t>(cur_numa_id)) {
+            size_t i0{0}, i1{0};
+            splitter(num_parts, num_parts, socket_id, i0, i1);
+            cpuStreamExecutor->run_sub_stream(
+                [socket_id, i0, i1, &func, &parts_remain]() {
+                    for (size_t i = i0; i < i1; i++) {
+                        func(static_cast<int>(socket_id), i);
+                        parts_remain--;
+                    }
+                },
+                sub_stream_id);
+            sub_stream_id++;
+        }
+    }
+    // run in main stream (current socket)
+    {
+        size_t i0{0}, i1{0};
+        splitter(num_parts, num_parts, static_cast<size_t>(cur_numa_id), i0, i1);
+        for (size_t i = i0; i < i1; i++) {
+            func(cur_numa_id, i);
+            parts_remain--;
+        }
+    }
+    // wait and sync
+    while (parts_remain.load() > 0) {}
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -4,10 +4,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
+
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "kv_cache_pool.h"
+#include "snippets_tuning_cache.h"
 #include "weights_cache.hpp"
 
 namespace ov {
@@ -21,12 +26,23 @@ public:
     GraphContext(const Config& config,
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
-                 ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr)
+                 ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
+                 KVCachePagePool::Ptr kvCachePool = nullptr,
+                 MultiCachePtr sharedParamsCache = nullptr,
+                 DnnlScratchPadPtr sharedScratchPad = nullptr,
+                 WeightsSharing::Ptr sharedWeightsCache = nullptr,
+                 SnippetsTuningCache::Ptr snippetsTuningCache = nullptr)
         : config(config),
           weightsCache(std::move(w_cache)),
+          sharedWeightsCache(std::move(sharedWeightsCache)),
+          snippetsTuningCache(std::move(snippetsTuningCache)),
+          rtSharedParamsCache(std::move(sharedParamsCache)),
           isGraphQuantizedFlag(isGraphQuantized),
-          streamExecutor(streamExecutor) {
+          streamExecutor(streamExecutor),
+          kvCachePagePool(std::move(kvCachePool)) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        if (!rtSharedParamsCache)
+            rtSharedParamsCache = rtParamsCache;
         // primitive/executors can be shared across sub-stream
         // but scratch pad cannot be shared.
         numNumaNodes = 1;
@@ -37,7 +53,10 @@ public:
                 numNumaNodes = nNumaNodes;
         }
         for (int i = 0; i < numNumaNodes; i++) {
-            rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
+            // all the nodes of the graph without the sub-streams are executed on the NUMA node of the stream,
+            // so the scratch pad shared with the other streams bound to the same cores serves all the nodes
+            rtScratchPads.push_back(sharedScratchPad ? sharedScratchPad
+                                                     : std::make_shared<DnnlScratchPad>(getEngine(), i));
         }
     }
 
@@ -49,21 +68,47 @@ public:
         return weightsCache;
     }
 
+    // process level cache of the repacked weights shared with the other compiled models, the keys must be built
+    // with WeightsSharing::descKey() and WeightsSharing::dataKey() and the weights taken with
+    // WeightsSharing::findOrCreateByContent()
+    WeightsSharing::Ptr getSharedWeightsCache() const {
+        return sharedWeightsCache;
+    }
+
+    // the autotuned blocking parameters of the snippets kernels, nullptr if the autotuning is disabled
+    SnippetsTuningCache::Ptr getSnippetsTuningCache() const {
+        return snippetsTuningCache;
+    }
+
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
     }
 
+    // thread safe cache shared by the graphs of all the streams of the compiled model,
+    // it may hold only the stateless objects (e.g. oneDNN primitives) which can be executed concurrently
+    MultiCachePtr getSharedParamsCache() const {
+        return rtSharedParamsCache;
+    }
+
     DnnlScratchPadPtr getScratchPad(int subStreamID = 0) const {
         if (subStreamID < 0)
             subStreamID = 0;
         if (subStreamID >= numNumaNodes - 1)
             subStreamID = numNumaNodes - 1;
+        // the nodes executed concurrently in the dataflow mode cannot share the scratch pad, so each call
+        // returns a new one, the callers keep it for the node
+        if (concurrentNodes)
+            return std::make_shared<DnnlScratchPad>(getEngine(), subStreamID);
         return rtScratchPads[subStreamID];
     }
 
-    const std::vector<DnnlScratchPadPtr>& getScratchPads() const {
-        return rtScratchPads;
+    /**
+     * @brief Called by the graph which has chosen the dataflow execution before its primitives are created,
+     *        so the nodes get their own scratch pads
+     */
+    void enableConcurrentNodes() const {
+        concurrentNodes = true;
     }
 
     static const dnnl::engine& getEngine();
@@ -80,12 +125,33 @@ public:
         return numNumaNodes;
     }
 
+    // number of the sockets the tensor parallel nodes are split across, 1 if the model is not distributed
+    int getNumSubStreamSockets() const {
+        if (!cpuStreamExecutor)
+            return 1;
+        return config.streamExecutorConfig.get_sub_streams() + 1;
+    }
+
+    /**
+     * @brief Runs func(numa_id, part) for the parts [0, num_parts) distributed over the sockets: the parts of the
+     *        current socket are executed by the calling thread, the others are enqueued to the sub-streams bound to
+     *        the sockets. Returns when all the parts are done.
+     */
+    void parallelOnNumaNodes(size_t num_parts, const std::function<void(int, size_t)>& func) const;
+
+    KVCachePagePool::Ptr getKVCachePagePool() const {
+        return kvCachePagePool;
+    }
+
 private:
     Config config;  // network-level config
 
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    WeightsSharing::Ptr sharedWeightsCache;   // repacked weights shared across the compiled models
+    SnippetsTuningCache::Ptr snippetsTuningCache;  // snippets autotuning results shared across the streams
 
     MultiCachePtr rtParamsCache;     // primitive cache
+    MultiCachePtr rtSharedParamsCache;  // primitive cache shared across streams
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
 
     bool isGraphQuantizedFlag = false;
@@ -97,6 +163,11 @@ private:
     ov::threading::CPUStreamsExecutor::Ptr cpuStreamExecutor;   // cpu stream executor for current graph
 
     int numNumaNodes = 1;
+
+    // the nodes of a graph sharing the context are executed concurrently, see enableConcurrentNodes()
+    mutable std::atomic<bool> concurrentNodes{false};
+
+    KVCachePagePool::Ptr kvCachePagePool;   // paged KV cache storage shared by all the graphs of the compiled model
 };
 
 }  // namespace intel_cpu
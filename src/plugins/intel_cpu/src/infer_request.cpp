@@ -93,6 +93,24 @@ void SyncInferRequest::redefine_memory_for_input_nodes() {
     }
 }
 
+void SyncInferRequest::record_shape_profile() {
+    const auto& cache = m_compiled_model->m_shapeProfileCache;
+    if (!cache || !m_record_shape_profile)
+        return;
+
+    bool changed = m_shape_profile.size() != m_input_ports_map.size();
+    m_shape_profile.resize(m_input_ports_map.size());
+    for (const auto& input_port : m_input_ports_map) {
+        const auto& shape = get_tensor(input_port.second)->get_shape();
+        if (m_shape_profile[input_port.first] != shape) {
+            m_shape_profile[input_port.first] = shape;
+            changed = true;
+        }
+    }
+    if (changed)
+        cache->record(m_shape_profile);
+}
+
 void SyncInferRequest::update_external_tensor_ptrs() {
     // Update it due to batched_tensors case will update input tensor
     for (auto input : m_input_ports_map) {
@@ -133,6 +151,11 @@ void SyncInferRequest::infer() {
 
     m_graph->Infer(this);
 
+    // only the shapes the graph was successfully executed with are worth the warm up on the next start
+    if (m_graph->hasDynamicInput()) {
+        record_shape_profile();
+    }
+
     throw_if_canceled();
 
     // update output control blocks, if any, in order to refresh internal buffers
@@ -9,6 +9,7 @@
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "memory_state.h"
+#include "shape_profile_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -47,6 +48,14 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Stops reporting the input shapes to the shape profile cache, e.g. for the inferences of the warm up,
+     * which would otherwise change the order of the recently used shapes
+     */
+    void disable_shape_profile() {
+        m_record_shape_profile = false;
+    }
+
 private:
     class OutputControlBlock {
     public:
@@ -98,6 +107,7 @@ private:
 
     void push_input_data();
     void redefine_memory_for_input_nodes();
+    void record_shape_profile();
     void assign_states();
     void commit_states();
     void update_external_tensor_ptrs();
@@ -120,6 +130,10 @@ private:
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_input_ports_map;
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_output_ports_map;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_outputs;
+
+    // input shapes of the last inference, to report only the changed shapes to the shape profile cache
+    ShapeProfileCache::Profile m_shape_profile;
+    bool m_record_shape_profile = true;
 };
 
 }  // namespace intel_cpu
@@ -21,6 +21,18 @@ static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_cap
  */
 static constexpr Property<bool, PropertyMutability::RW> lp_transforms_mode{"LP_TRANSFORMS_MODE"};
 
+/**
+ * @brief Allow Snippets to tokenize the gated FullyConnected (e.g. gate and up projections of MLP) with their
+ * elementwise prologue and epilogue, disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> snippets_fc_tokenization{"SNIPPETS_FC_TOKENIZATION"};
+
+/**
+ * @brief Allow Snippets to tokenize the eltwise and reduction subgraphs on ARM64 and compile them with the aarch64
+ * generator, disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> snippets_arm64_tokenization{"SNIPPETS_ARM64_TOKENIZATION"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -0,0 +1,238 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_pool.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// virtual address space reserved by an arena, only the used chunks consume memory
+constexpr size_t reservedArenaBytes = sizeof(void*) == 8 ? (size_t(1) << 38) : (size_t(1) << 28);
+// chunks are not smaller than a huge page to keep the number of commits low, unless the pages are tiny
+constexpr size_t minChunkBytes = size_t(2) << 20;
+constexpr size_t minChunkPages = 16;
+constexpr size_t maxChunkPages = 4096;
+
+size_t systemPageSize() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+void* reserveAddressSpace(size_t size) {
+#ifdef _WIN32
+    return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    auto ptr = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+#endif
+}
+
+void releaseAddressSpace(void* ptr, size_t size) {
+#ifdef _WIN32
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, size);
+#endif
+}
+
+bool commitMemory(uint8_t* ptr, size_t size) {
+#ifdef _WIN32
+    return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void decommitMemory(uint8_t* ptr, size_t size) {
+#ifdef _WIN32
+    VirtualFree(ptr, size, MEM_DECOMMIT);
+#else
+    madvise(ptr, size, MADV_DONTNEED);
+    mprotect(ptr, size, PROT_NONE);
+#endif
+}
+}  // namespace
+
+KVCachePagePool::Arena::Arena(size_t pageBytes)
+    : m_pageBytes(pageBytes),
+      m_chunkPages(std::min(maxChunkPages, std::max(minChunkPages, (minChunkBytes + pageBytes - 1) / pageBytes))) {
+    OPENVINO_ASSERT(pageBytes > 0, "KV cache page size must be positive");
+    const auto chunkBytes = m_chunkPages * m_pageBytes;
+    // the restricted environments may not allow to reserve the whole range, a smaller one limits the arena capacity
+    for (m_maxChunks = std::max<size_t>(1, reservedArenaBytes / chunkBytes); m_maxChunks > 0; m_maxChunks /= 2) {
+        m_reservedBytes = m_maxChunks * chunkBytes;
+        m_data = static_cast<uint8_t*>(reserveAddressSpace(m_reservedBytes));
+        if (m_data)
+            break;
+    }
+    OPENVINO_ASSERT(m_data, "Failed to reserve the address space for the KV cache pages of ", pageBytes, " bytes");
+    m_refCounters.resize(m_maxChunks);
+    m_chunkUsedPages.reserve(m_maxChunks);
+}
+
+KVCachePagePool::Arena::~Arena() {
+    releaseAddressSpace(m_data, m_reservedBytes);
+}
+
+void KVCachePagePool::Arena::grow() {
+    const auto chunk = m_chunkUsedPages.size();
+    OPENVINO_ASSERT(chunk < m_maxChunks,
+                    "KV cache arena of ", m_pageBytes, " bytes pages exceeded ", m_maxChunks * m_chunkPages, " pages");
+    const auto chunkBytes = m_chunkPages * m_pageBytes;
+    const auto osPage = systemPageSize();
+    // the chunks may share a system page at the boundary, committing it twice is harmless
+    const auto begin = chunk * chunkBytes / osPage * osPage;
+    const auto end = std::min(m_reservedBytes, ((chunk + 1) * chunkBytes + osPage - 1) / osPage * osPage);
+    OPENVINO_ASSERT(commitMemory(m_data + begin, end - begin),
+                    "Failed to allocate ", chunkBytes, " bytes for the KV cache pages");
+
+    if (!m_refCounters[chunk]) {
+        m_refCounters[chunk].reset(new std::atomic<int32_t>[m_chunkPages]);
+    }
+    for (size_t i = 0; i < m_chunkPages; i++) {
+        m_refCounters[chunk][i].store(0, std::memory_order_relaxed);
+        m_freePages.insert(static_cast<int32_t>(chunk * m_chunkPages + i));
+    }
+    m_chunkUsedPages.push_back(0);
+    m_totalPages.store(m_chunkUsedPages.size() * m_chunkPages, std::memory_order_release);
+}
+
+void KVCachePagePool::Arena::shrink() {
+    auto chunks = m_chunkUsedPages.size();
+    // one free chunk is kept for the next allocations
+    while (chunks > 1 && m_chunkUsedPages[chunks - 1] == 0 && m_chunkUsedPages[chunks - 2] == 0) {
+        const auto chunk = chunks - 1;
+        const auto chunkBytes = m_chunkPages * m_pageBytes;
+        const auto osPage = systemPageSize();
+        // the system page shared with the previous chunk stays committed
+        const auto begin = (chunk * chunkBytes + osPage - 1) / osPage * osPage;
+        const auto end = std::min(m_reservedBytes, ((chunk + 1) * chunkBytes + osPage - 1) / osPage * osPage);
+        if (begin < end) {
+            decommitMemory(m_data + begin, end - begin);
+        }
+        m_freePages.erase(m_freePages.lower_bound(static_cast<int32_t>(chunk * m_chunkPages)), m_freePages.end());
+        m_chunkUsedPages.pop_back();
+        m_totalPages.store(m_chunkUsedPages.size() * m_chunkPages, std::memory_order_release);
+        chunks--;
+    }
+}
+
+std::atomic<int32_t>& KVCachePagePool::Arena::refCounter(int32_t page) const {
+    OPENVINO_ASSERT(page >= 0 && static_cast<size_t>(page) < m_totalPages.load(std::memory_order_acquire),
+                    "KV cache page ", page, " is not allocated");
+    return m_refCounters[page / m_chunkPages][page % m_chunkPages];
+}
+
+int32_t KVCachePagePool::Arena::allocate() {
+    std::vector<int32_t> pages;
+    allocate(1, pages);
+    return pages.back();
+}
+
+void KVCachePagePool::Arena::allocate(size_t count, std::vector<int32_t>& pages) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (m_freePages.size() < count) {
+        grow();
+    }
+    for (size_t i = 0; i < count; i++) {
+        auto page = *m_freePages.begin();
+        m_freePages.erase(m_freePages.begin());
+        m_refCounters[page / m_chunkPages][page % m_chunkPages].store(1, std::memory_order_relaxed);
+        m_chunkUsedPages[page / m_chunkPages]++;
+        pages.push_back(page);
+    }
+    m_usedPages += count;
+}
+
+void KVCachePagePool::Arena::addRef(int32_t page) {
+    // the caller owns a reference, so the page can not be freed concurrently
+    auto& counter = refCounter(page);
+    if (counter.fetch_add(1, std::memory_order_relaxed) <= 0) {
+        counter.fetch_sub(1, std::memory_order_relaxed);
+        OPENVINO_THROW("KV cache page ", page, " is not allocated");
+    }
+}
+
+void KVCachePagePool::Arena::release(int32_t page) {
+    auto& counter = refCounter(page);
+    auto refs = counter.fetch_sub(1, std::memory_order_acq_rel);
+    if (refs <= 0) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+        OPENVINO_THROW("KV cache page ", page, " is not allocated");
+    }
+    if (refs > 1)
+        return;
+    // only the last reference returns the page to the free list
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_freePages.insert(page);
+    m_chunkUsedPages[page / m_chunkPages]--;
+    m_usedPages--;
+    shrink();
+}
+
+bool KVCachePagePool::Arena::isShared(int32_t page) const {
+    return refCounter(page).load(std::memory_order_relaxed) > 1;
+}
+
+size_t KVCachePagePool::Arena::getUsedPages() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_usedPages;
+}
+
+size_t KVCachePagePool::Arena::getTotalPages() const {
+    return m_totalPages.load(std::memory_order_acquire);
+}
+
+KVCachePagePool::Arena* KVCachePagePool::getArena(size_t pageBytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = std::find_if(m_arenas.begin(), m_arenas.end(), [&](const std::unique_ptr<Arena>& arena) {
+        return arena->getPageBytes() == pageBytes;
+    });
+    if (it != m_arenas.end()) {
+        return it->get();
+    }
+    m_arenas.emplace_back(new Arena(pageBytes));
+    return m_arenas.back().get();
+}
+
+size_t KVCachePagePool::getUsedSize() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t size = 0;
+    for (const auto& arena : m_arenas) {
+        size += arena->getUsedPages() * arena->getPageBytes();
+    }
+    return size;
+}
+
+size_t KVCachePagePool::getAllocatedSize() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t size = 0;
+    for (const auto& arena : m_arenas) {
+        size += arena->getTotalPages() * arena->getPageBytes();
+    }
+    return size;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Compiled model level pool of fixed size KV cache pages shared by all the infer requests.
+ *
+ * Pages of the same byte size are stored in one arena, which reserves a contiguous range of the virtual address
+ * space and commits it in fixed size chunks, so the page index is enough to address a page and the block table
+ * based (paged) attention kernels can consume the arena directly. The pages never move when the arena grows,
+ * thus the page data can be accessed without any synchronization with the allocations of the other requests.
+ * The fully free chunks at the end of the arena are returned to the system, one of them is kept to avoid
+ * committing and decommitting the same chunk back and forth.
+ *
+ * Pages are reference counted to allow several sequences (e.g. beams) to share the same prefix pages.
+ */
+class KVCachePagePool {
+public:
+    using Ptr = std::shared_ptr<KVCachePagePool>;
+    using CPtr = std::shared_ptr<const KVCachePagePool>;
+
+    class Arena {
+    public:
+        explicit Arena(size_t pageBytes);
+        ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /**
+         * @brief Allocates a page with the reference counter equal to 1. The page data is uninitialized.
+         * @return page index in the arena
+         */
+        int32_t allocate();
+        /**
+         * @brief Appends count newly allocated pages to the pages, the arena is locked once for all of them.
+         */
+        void allocate(size_t count, std::vector<int32_t>& pages);
+        void addRef(int32_t page);
+        void release(int32_t page);
+        bool isShared(int32_t page) const;
+
+        /**
+         * @brief Base address of the arena, the page p starts at data() + p * getPageBytes().
+         * The address never changes during the arena lifetime.
+         */
+        uint8_t* data() const noexcept {
+            return m_data;
+        }
+        size_t getPageBytes() const noexcept {
+            return m_pageBytes;
+        }
+        size_t getChunkPages() const noexcept {
+            return m_chunkPages;
+        }
+        size_t getUsedPages() const;
+        // pages backed by the committed chunks
+        size_t getTotalPages() const;
+
+    private:
+        void grow();
+        void shrink();
+        std::atomic<int32_t>& refCounter(int32_t page) const;
+
+        size_t m_pageBytes;
+        size_t m_chunkPages;
+        size_t m_maxChunks = 0;
+        size_t m_reservedBytes = 0;
+        uint8_t* m_data = nullptr;
+
+        mutable std::mutex m_mutex;
+        std::atomic<size_t> m_totalPages{0};
+        size_t m_usedPages = 0;
+        // reference counters of each chunk pages, allocated on the first commit of the chunk and never moved
+        std::vector<std::unique_ptr<std::atomic<int32_t>[]>> m_refCounters;
+        std::vector<size_t> m_chunkUsedPages;
+        // the lowest pages are allocated first, so the last chunks get free and may be decommitted
+        std::set<int32_t> m_freePages;
+    };
+
+    /**
+     * @param pageTokens number of tokens stored in one page
+     */
+    explicit KVCachePagePool(size_t pageTokens) : m_pageTokens(pageTokens) {}
+
+    size_t getPageTokens() const noexcept {
+        return m_pageTokens;
+    }
+
+    /**
+     * @brief Returns the arena holding pages of the requested size, creates a new one if it does not exist.
+     */
+    Arena* getArena(size_t pageBytes);
+
+    // pool occupancy in bytes
+    size_t getUsedSize() const;
+    size_t getAllocatedSize() const;
+
+private:
+    size_t m_pageTokens;
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<Arena>> m_arenas;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -14,6 +14,7 @@
 #include "openvino/core/parallel.hpp"
 #include "nodes/common/cpu_convert.h"
 #include "nodes/kernels/scaled_attn/attn_quant.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 
 using namespace ov::Extensions::Cpu::XARCH;
 
@@ -96,6 +97,15 @@ void VariableStateBase::reset() {
     reset_state_flag = true;
 }
 
+void VariableStateBase::fork(const std::shared_ptr<ov::IVariableState>& source, size_t length) {
+    fork_impl(source, length);
+    reset_state_flag = false;
+}
+
+void VariableStateBase::fork_impl(const std::shared_ptr<ov::IVariableState>& source, size_t length) {
+    OPENVINO_THROW("Variable state ", get_name(), " does not support fork");
+}
+
 bool VariableStateBase::is_reset_state() const {
     return reset_state_flag;
 }
@@ -159,14 +169,24 @@ MemoryPtr VariableStateDoubleBuffer::internal_state_mem() const {
 VariableStateKVcache::VariableStateKVcache(
     const std::string& name,
     const MemoryDescPtr& external_desc,
-    const BlockedMemoryDescPtr& dense_internal_desc) :
-    VariableStateBase(name, external_desc), m_dense_internal_desc(dense_internal_desc) {
+    const BlockedMemoryDescPtr& dense_internal_desc,
+    const KVCachePagePool::Ptr& page_pool,
+    size_t quant_group_size) :
+    VariableStateBase(name, external_desc), m_dense_internal_desc(dense_internal_desc), m_page_pool(page_pool),
+    m_quant_group_size(quant_group_size) {
     auto&& shape = external_desc->getShape();
 
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
 
+VariableStateKVcache::~VariableStateKVcache() {
+    release_pages();
+}
+
 ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
+    if (is_paged()) {
+        return get_paged_state();
+    }
     if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
         auto new_desc = to_static(get_external_desc());
         auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
@@ -202,14 +222,19 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     if (pastkv.get_precision() == element::u8) {
         auto nthr = parallel_get_max_threads();
         std::vector<PlainTensor> buffers(nthr);
+        auto groups = m_scale_zp.size(3) / 2;
+        auto group_size = S / groups;
         parallel_for3d(B, H, L0, [&](size_t ithr, size_t b, size_t h, size_t m) {
             auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
+            auto p_scale_zp = m_scale_zp.ptr<float>(b_kv, h, m);
             buffers[ithr].resize<float>({S});
-            attn_dequant_u8(pastkv.ptr<uint8_t>(b_kv, h, m),
-                            buffers[ithr].ptr<float>(),
-                            S,
-                            m_scale_zp.ptr<float>(b_kv, h, m)[0],
-                            m_scale_zp.ptr<float>(b_kv, h, m)[1]);
+            for (size_t g = 0; g < groups; g++) {
+                attn_dequant_u8(pastkv.ptr<uint8_t>(b_kv, h, m) + g * group_size,
+                                buffers[ithr].ptr<float>() + g * group_size,
+                                group_size,
+                                p_scale_zp[2 * g],
+                                p_scale_zp[2 * g + 1]);
+            }
             cpu_convert(buffers[ithr].ptr<float>(),
                         output.ptr_v(b, h, m),
                         element::f32,
@@ -231,6 +256,12 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
 }
 
 void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    if (is_paged()) {
+        set_paged_state(state);
+        return;
+    }
+    // the other requests may fork this state meanwhile
+    auto lock = lock_state();
     //1. reset the memory object
     m_state = state; // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -252,6 +283,9 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
         auto H = internal.size(1);
         auto L0 = internal.size(2);
         auto S = internal.size(3);
+        auto groups = quant_groups(S, m_quant_group_size, element::u8);
+        auto group_size = S / groups;
+        m_scale_zp.resize<float>({B, H, L0, 2 * groups});
         auto nthr = parallel_get_max_threads();
         std::vector<PlainTensor> buffers(nthr);
         parallel_for3d(B, H, L0, [&](size_t ithr, size_t b, size_t h, size_t m) {
@@ -261,11 +295,14 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                         external.m_dt,
                         element::f32,
                         S);
-            attn_quant_u8(buffers[ithr].ptr<float>(),
-                          internal.ptr<uint8_t>(b, h, m),
-                          S,
-                          m_scale_zp.at<float>({b, h, m, size_t{0}}),
-                          m_scale_zp.at<float>({b, h, m, size_t{1}}));
+            auto p_scale_zp = m_scale_zp.ptr<float>(b, h, m);
+            for (size_t g = 0; g < groups; g++) {
+                attn_quant_u8(buffers[ithr].ptr<float>() + g * group_size,
+                              internal.ptr<uint8_t>(b, h, m) + g * group_size,
+                              group_size,
+                              p_scale_zp[2 * g],
+                              p_scale_zp[2 * g + 1]);
+            }
         });
     } else {
         m_internal_mem->load(external_mem);
@@ -291,8 +328,67 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
 }
 
+void VariableStateKVcache::fork_impl(const std::shared_ptr<ov::IVariableState>& source, size_t length) {
+    auto src = std::dynamic_pointer_cast<VariableStateKVcache>(source);
+    OPENVINO_ASSERT(src, "Variable state ", get_name(), " can be forked only from a KV cache state");
+    OPENVINO_ASSERT(src.get() != this, "Variable state ", get_name(), " can not be forked from itself");
+
+    if (is_paged() && m_page_pool == src->m_page_pool) {
+        // the source request may be running, its block table is read under its lock
+        std::unique_lock<std::mutex> lock(m_state_mutex, std::defer_lock);
+        std::unique_lock<std::mutex> src_lock(src->m_state_mutex, std::defer_lock);
+        std::lock(lock, src_lock);
+        OPENVINO_ASSERT(!src->is_reset_state() && src->m_internal_mem,
+                        "Variable state ", get_name(), " can not be forked from the reset state ", src->get_name());
+        auto&& order = m_dense_internal_desc->getOrder();
+        auto&& src_dims = src->m_internal_mem->getStaticDims();
+        OPENVINO_ASSERT(src->m_page_arena, "Variable state ", src->get_name(), " has no pages");
+        OPENVINO_ASSERT(length <= src->m_paged_length,
+                        "Fork length ", length, " exceeds the length ", src->m_paged_length, " of the state ", src->get_name());
+        // the prefix pages are shared, reserve_pages() copies the partially filled page on the first write
+        const auto page_tokens = m_page_pool->getPageTokens();
+        const auto pages_count = (length + page_tokens - 1) / page_tokens;
+        release_pages();
+        m_page_arena = src->m_page_arena;
+        m_page_dims = src->m_page_dims;
+        m_block_table.resize(src->m_block_table.size());
+        for (size_t b = 0; b < m_block_table.size(); b++) {
+            m_block_table[b].assign(src->m_block_table[b].begin(), src->m_block_table[b].begin() + pages_count);
+            for (auto page : m_block_table[b]) {
+                m_page_arena->addRef(page);
+            }
+        }
+        m_paged_length = length;
+        assign_paged_shape(src_dims[order[0]], src_dims[order[1]], length, src_dims[order[3]]);
+        return;
+    }
+
+    // states of different compiled models or not paged ones are copied. The prefix is copied under the lock of the
+    //  source only, the lock of this state is taken by set_state_impl(), so two opposite forks can't deadlock
+    ov::SoPtr<ov::ITensor> dense_prefix;
+    {
+        auto src_lock = src->lock_state();
+        OPENVINO_ASSERT(!src->is_reset_state() && src->m_internal_mem,
+                        "Variable state ", get_name(), " can not be forked from the reset state ", src->get_name());
+        auto&& order = m_dense_internal_desc->getOrder();
+        auto&& src_dims = src->m_internal_mem->getStaticDims();
+        OPENVINO_ASSERT(length <= src_dims[order[2]],
+                        "Fork length ", length, " exceeds the length ", src_dims[order[2]], " of the state ", src->get_name());
+        auto state = src->get_state();
+        ov::Coordinate begin(src_dims.size(), 0);
+        ov::Coordinate end(src_dims.begin(), src_dims.end());
+        end[order[2]] = length;
+        auto prefix = ov::make_tensor(state._ptr, begin, end);
+        dense_prefix = {ov::make_tensor(prefix->get_element_type(), prefix->get_shape()), state._so};
+        prefix->copy_to(dense_prefix._ptr);
+    }
+    set_state_impl(dense_prefix);
+}
+
 void VariableStateKVcache::reset_impl() {
-    //nothing to do
+    // the pages are returned to the pool right away to be reused by the other requests
+    auto lock = lock_state();
+    release_pages();
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -326,5 +422,176 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
 }
+
+void VariableStateKVcache::assign_page_arena(KVCachePagePool::Arena* arena, const VectorDims& page_dims) {
+    OPENVINO_ASSERT(is_paged(), "KV cache state ", get_name(), " is not paged");
+    if (m_page_arena != arena) {
+        release_pages();
+    }
+    m_page_arena = arena;
+    m_page_dims = page_dims;
+}
+
+void VariableStateKVcache::gather_pages(const int32_t* beam_idx, size_t B) {
+    std::vector<std::vector<int32_t>> new_block_table(B);
+    for (size_t b = 0; b < B; b++) {
+        OPENVINO_ASSERT(beam_idx[b] >= 0 && static_cast<size_t>(beam_idx[b]) < m_block_table.size(),
+                        "beam_idx ", beam_idx[b], " is out of range of the KV cache state ", get_name());
+        new_block_table[b] = m_block_table[beam_idx[b]];
+        for (auto page : new_block_table[b]) {
+            m_page_arena->addRef(page);
+        }
+    }
+    for (auto&& pages : m_block_table) {
+        for (auto page : pages) {
+            m_page_arena->release(page);
+        }
+    }
+    m_block_table = std::move(new_block_table);
+}
+
+std::vector<std::pair<int32_t, int32_t>> VariableStateKVcache::reserve_pages(size_t B, size_t length) {
+    OPENVINO_ASSERT(m_page_arena, "KV cache state ", get_name(), " has no page arena");
+    if (m_block_table.size() != B) {
+        OPENVINO_ASSERT(m_paged_length == 0,
+                        "KV cache state ", get_name(), " batch ", m_block_table.size(), " does not match ", B);
+        m_block_table.resize(B);
+    }
+    const auto page_tokens = m_page_pool->getPageTokens();
+    const auto pages_count = (length + page_tokens - 1) / page_tokens;
+    const bool last_page_partial = m_paged_length % page_tokens != 0;
+    std::vector<std::pair<int32_t, int32_t>> copies;
+    for (auto&& pages : m_block_table) {
+        // the partially filled page is going to be appended, so it must not be shared with other sequences
+        if (last_page_partial && !pages.empty() && m_page_arena->isShared(pages.back())) {
+            auto page = m_page_arena->allocate();
+            copies.emplace_back(pages.back(), page);
+            m_page_arena->release(pages.back());
+            pages.back() = page;
+        }
+        if (pages.size() < pages_count) {
+            m_page_arena->allocate(pages_count - pages.size(), pages);
+        }
+    }
+    m_paged_length = length;
+    return copies;
+}
+
+void VariableStateKVcache::release_pages() {
+    for (auto&& pages : m_block_table) {
+        for (auto page : pages) {
+            m_page_arena->release(page);
+        }
+    }
+    m_block_table.clear();
+    m_paged_length = 0;
+}
+
+MemoryPtr VariableStateKVcache::page_mem() const {
+    OPENVINO_ASSERT(m_page_arena, "KV cache state ", get_name(), " has no page arena");
+    VectorDims dims{m_page_arena->getTotalPages()};
+    dims.insert(dims.end(), m_page_dims.begin(), m_page_dims.end());
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(m_dense_internal_desc->getPrecision(), Shape(dims));
+    return std::make_shared<Memory>(get_engine(), desc, m_page_arena->data());
+}
+
+void VariableStateKVcache::assign_paged_shape(size_t B, size_t H, size_t L, size_t S) {
+    auto&& order = m_dense_internal_desc->getOrder();
+    VectorDims dims(4);
+    dims[order[0]] = B;
+    dims[order[1]] = H;
+    dims[order[2]] = L;
+    dims[order[3]] = S;
+    auto desc = m_dense_internal_desc->cloneWithNewDims(dims);
+    if (m_internal_mem) {
+        m_internal_mem->redefineDesc(desc);
+    } else {
+        m_internal_mem = std::make_shared<MemoryStub>(get_engine(), desc);
+    }
+}
+
+ov::SoPtr<ov::ITensor> VariableStateKVcache::get_paged_state() const {
+    if (!m_internal_mem || !m_page_arena || is_reset_state()) {
+        auto new_desc = to_static(get_external_desc());
+        auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
+        return std::make_shared<Tensor>(external_mem);
+    }
+
+    auto&& dims = m_internal_mem->getStaticDims();
+    auto actual_external_desc = get_external_desc()->cloneWithNewDims(dims);
+    auto external_mem = std::make_shared<Memory>(get_engine(), actual_external_desc);
+
+    PlainTensor output, pages;
+    output.reset(external_mem);
+    output = output.permute(m_dense_internal_desc->getOrder());
+    auto B = output.size(0);
+    auto H = output.size(1);
+    auto L0 = output.size(2);
+    auto S = output.size(3);
+    const auto page_tokens = m_page_pool->getPageTokens();
+
+    pages.reset(page_mem());
+    auto kvcache_precision = pages.get_precision();
+    if (kvcache_precision == element::u8 || kvcache_precision == element::u4) {
+        auto nthr = parallel_get_max_threads();
+        std::vector<PlainTensor> buffers(nthr);
+        auto groups = quant_row_groups(S, pages.size(3), kvcache_precision);
+        parallel_for3d(B, H, L0, [&](size_t ithr, size_t b, size_t h, size_t m) {
+            auto page = m_block_table[b][m / page_tokens];
+            buffers[ithr].resize<float>({S});
+            attn_dequant_row(pages.ptr<uint8_t>(page, h, m % page_tokens), buffers[ithr].ptr<float>(), S, groups, kvcache_precision);
+            cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(b, h, m), element::f32, output.m_dt, S);
+        });
+    } else {
+        parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
+            auto page = m_block_table[b][m / page_tokens];
+            cpu_convert(pages.ptr_v(page, h, m % page_tokens), output.ptr_v(b, h, m), pages.m_dt, output.m_dt, S);
+        });
+    }
+
+    return std::make_shared<Tensor>(external_mem);
+}
+
+void VariableStateKVcache::set_paged_state(const ov::SoPtr<ov::ITensor>& state) {
+    auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(state);
+    auto kvcache_precision = m_dense_internal_desc->getPrecision();
+
+    PlainTensor external, pages;
+    external.resize(state_desc->getShape().getStaticDims(), state_desc->getPrecision().size(), state_desc->getPrecision(), state->data());
+    external = external.permute(m_dense_internal_desc->getOrder());
+    auto B = external.size(0);
+    auto H = external.size(1);
+    auto L0 = external.size(2);
+    auto S = external.size(3);
+    const auto page_tokens = m_page_pool->getPageTokens();
+    // the quantized tokens keep the scales and zero points in the row, see the layout in attn_quant.hpp
+    const bool is_quantized = kvcache_precision == element::u8 || kvcache_precision == element::u4;
+    const auto groups = quant_groups(S, m_quant_group_size, kvcache_precision);
+    const auto page_S = is_quantized ? quant_row_bytes(S, groups, kvcache_precision) : S;
+
+    auto lock = lock_state();
+    release_pages();
+    auto arena = m_page_pool->getArena(H * page_tokens * page_S * kvcache_precision.size());
+    assign_page_arena(arena, {H, page_tokens, page_S});
+    reserve_pages(B, L0);
+    assign_paged_shape(B, H, L0, S);
+
+    pages.reset(page_mem());
+    if (is_quantized) {
+        auto nthr = parallel_get_max_threads();
+        std::vector<PlainTensor> buffers(nthr);
+        parallel_for3d(B, H, L0, [&](size_t ithr, size_t b, size_t h, size_t m) {
+            auto page = m_block_table[b][m / page_tokens];
+            buffers[ithr].resize<float>({S});
+            cpu_convert(external.ptr_v(b, h, m), buffers[ithr].ptr<float>(), external.m_dt, element::f32, S);
+            attn_quant_row(buffers[ithr].ptr<float>(), pages.ptr<uint8_t>(page, h, m % page_tokens), S, groups, kvcache_precision);
+        });
+    } else {
+        parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
+            auto page = m_block_table[b][m / page_tokens];
+            cpu_convert(external.ptr_v(b, h, m), pages.ptr_v(page, h, m % page_tokens), external.m_dt, kvcache_precision, S);
+        });
+    }
+}
 }  // namespace intel_cpu
 }  // namespace ov
@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 #include "cpu_memory.h"
+#include "kv_cache_pool.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -33,6 +37,7 @@ public:
     void set_state(const ov::SoPtr<ov::ITensor>& state) override final; // NOLINT
     ov::SoPtr<ov::ITensor> get_state() const override;
     void reset() override final; // NOLINT
+    void fork(const std::shared_ptr<ov::IVariableState>& source, size_t length) override final; // NOLINT
     bool is_reset_state() const override final; // NOLINT
     void commit() override final; // NOLINT
 
@@ -41,6 +46,7 @@ protected:
     virtual void reset_impl() = 0;
     virtual void commit_impl() = 0;
     virtual void set_state_impl(const ov::SoPtr<ov::ITensor>& state);
+    virtual void fork_impl(const std::shared_ptr<ov::IVariableState>& source, size_t length);
 
     static MemoryDescPtr to_static(const MemoryDescPtr& desc);
     static const dnnl::engine& get_engine();
@@ -51,7 +57,8 @@ protected:
 
 private:
     MemoryDescPtr m_external_desc;
-    bool reset_state_flag = true;
+    // read by the forks from the other infer requests
+    std::atomic<bool> reset_state_flag{true};
 };
 
 class VariableStateDoubleBuffer : public VariableStateBase {
@@ -98,7 +105,10 @@ class VariableStateKVcache : public VariableStateBase {
 public:
     VariableStateKVcache(const std::string& name,
                          const MemoryDescPtr& external_desc,
-                         const BlockedMemoryDescPtr& dense_internal_desc);
+                         const BlockedMemoryDescPtr& dense_internal_desc,
+                         const KVCachePagePool::Ptr& page_pool = nullptr,
+                         size_t quant_group_size = 0);
+    ~VariableStateKVcache() override;
 
     //ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
@@ -136,12 +146,52 @@ public:
         m_scale_zp = t;
     }
 
+    // paged KV cache: the data is stored in the pages of the compiled model level pool,
+    // the internal state memory only carries the actual shape
+    bool is_paged() const {
+        return m_page_pool != nullptr;
+    }
+    // The block table and the shape of a paged state and the memory of a not paged one are modified under this lock,
+    //  so the other infer requests can fork the state while its own request is running. The owner request reads
+    //  them without the lock.
+    std::unique_lock<std::mutex> lock_state() const {
+        return std::unique_lock<std::mutex>(m_state_mutex);
+    }
+    const KVCachePagePool::Ptr& page_pool() const {
+        return m_page_pool;
+    }
+    KVCachePagePool::Arena* page_arena() const {
+        return m_page_arena;
+    }
+    // page_dims: [H, page_tokens, S], S is the size of the quantized row in bytes for u8/u4 kv cache
+    void assign_page_arena(KVCachePagePool::Arena* arena, const VectorDims& page_dims);
+    // [B][blocks] page indices of each sequence
+    const std::vector<std::vector<int32_t>>& block_table() const {
+        return m_block_table;
+    }
+    size_t paged_length() const {
+        return m_paged_length;
+    }
+    // the block table of the sequence b is taken from the sequence beam_idx[b], pages are shared
+    void gather_pages(const int32_t* beam_idx, size_t B);
+    // grows the block table to keep length tokens, returns the {src, dst} pairs of copy-on-write pages
+    std::vector<std::pair<int32_t, int32_t>> reserve_pages(size_t B, size_t length);
+    void release_pages();
+    // view of the committed pages of the arena as [pages, H, page_tokens, S]
+    MemoryPtr page_mem() const;
+    // updates the shape of the paged state, the dims are given in the internal [B, H, L, S] order
+    void assign_paged_shape(size_t B, size_t H, size_t L, size_t S);
+
 private:
     //ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
+    void fork_impl(const std::shared_ptr<ov::IVariableState>& source, size_t length) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    ov::SoPtr<ov::ITensor> get_paged_state() const;
+    void set_paged_state(const ov::SoPtr<ov::ITensor>& state);
+
 private:
     MemoryPtr m_internal_mem; // kv cache
     MemoryPtr m_hidden_state; // beam access table
@@ -151,8 +201,17 @@ private:
     // this desc stores the internal prc and axis permutation
     BlockedMemoryDescPtr m_dense_internal_desc;
 
-    // for u8 kv cache: [B, H, L, 2], 0 for scale, 1 for zp
+    // for u8 kv cache: [B, H, L, 2 * groups], 2 * g for scale, 2 * g + 1 for zp of the group g
     PlainTensor m_scale_zp;
+    // channels sharing a scale and zero point of the quantized kv cache, 0 means the whole head
+    size_t m_quant_group_size = 0;
+
+    KVCachePagePool::Ptr m_page_pool;
+    KVCachePagePool::Arena* m_page_arena = nullptr;
+    VectorDims m_page_dims;
+    std::vector<std::vector<int32_t>> m_block_table;
+    size_t m_paged_length = 0;
+    mutable std::mutex m_state_mutex;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -18,6 +18,7 @@
 #include "nodes/eltwise.h"
 #include "nodes/input.h"
 #include "nodes/reorder.h"
+#include "utils/data_hash.hpp"
 #include "nodes/reference.h"
 #include "dnnl_extension_utils.h"
 
@@ -811,17 +812,22 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
         Memory memory{engine, newDesc, internalBlob->getData()};
 
         MemoryPtr _ptr = std::make_shared<Memory>(engine, intDesc);
-        node::Reorder::reorderData(memory, *_ptr, context->getParamsCache());
+        node::Reorder::reorderData(memory, *_ptr, context->getSharedParamsCache());
         return _ptr;
     };
 
     MemoryPtr ptr;
     auto weightCache = context->getWeightsCache();
-    if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
+    auto sharedWeightCache = context->getSharedWeightsCache();
+    const bool isBlocked = memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind();
+    if (sharedWeightCache != nullptr && isBlocked) {
+        const std::string string_hash = WeightsSharing::descKey(intDesc) + "_" +
+                                        WeightsSharing::descKey(internalBlob->getDescPtr()) + "_" +
+                                        WeightsSharing::dataKey(internalBlob->getData(), internalBlob->getSize());
+        ptr = sharedWeightCache->findOrCreateByContent(string_hash, create);
+    } else if (weightCache != nullptr && isBlocked) {
         const auto& format = intDesc->serializeFormat();
-        const uint64_t data_hash =
-            weightCache->GetHashFunc().hash(static_cast<const unsigned char*>(internalBlob->getData()),
-                                            internalBlob->getSize());
+        const uint64_t data_hash = hashData(internalBlob->getData(), internalBlob->getSize());
 
         const std::string string_hash = name + "_" + std::to_string(indx)
                                         + "_" + format
@@ -875,7 +881,7 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     auto create = [&] () {
         Memory srcMemory{ getEngine(), srcWeightDesc, edgeMem->getData() };
         MemoryPtr _ptr = std::make_shared<Memory>(getEngine(), dstWeightDesc);
-        node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
+        node::Reorder::reorderData(srcMemory, *_ptr, context->getSharedParamsCache());
 
         return _ptr;
     };
@@ -891,7 +897,12 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     }
 
     auto weightCache = context->getWeightsCache();
-    if (weightCache != nullptr) {
+    if (auto sharedWeightCache = context->getSharedWeightsCache()) {
+        const std::string string_hash = WeightsSharing::descKey(dstWeightDesc) + "_" +
+                                        WeightsSharing::descKey(srcWeightDesc) + "_" +
+                                        WeightsSharing::dataKey(edgeMem->getData(), edgeMem->getSize());
+        ptr = sharedWeightCache->findOrCreateByContent(string_hash, create);
+    } else if (weightCache != nullptr) {
         const std::string string_hash = getName() + "_" + format
             + "_" + std::to_string(edgeMem->getSize())
             + "_" + std::to_string(*edgeMem->getDataAs<uint64_t>());
@@ -436,6 +436,14 @@ public:
     virtual void resolveInPlaceEdges(Edge::LOOK look = Edge::LOOK_BOTH);
 
     virtual void execute(dnnl::stream strm) = 0;
+    /**
+     * @brief Returns the oneDNN primitive if the execution of the static node is exactly the call of this primitive
+     * with primArgs, so the execution plan of the graph may replay the call with the pre-bound arguments instead of
+     * execute(). Otherwise returns the empty primitive.
+     */
+    virtual dnnl::primitive getReplayablePrimitive() const {
+        return {};
+    }
     void updateShapes();
     void updateDynamicParams();
     void executeDynamic(dnnl::stream strm);
@@ -705,6 +713,7 @@ protected:
     friend class Edge;
     friend class Graph;
     friend class GraphOptimizer;
+    friend class ExecutionPlan;
 
     void selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& priority, bool ignoreConstInputs);
     bool isConfigDefined(const NodeConfig &config) const;
@@ -1390,7 +1390,7 @@ void Convolution::prepareParams() {
 
     auto prevExecPtr = execPtr;
     execPtr = nullptr;
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -1505,6 +1505,12 @@ void Convolution::execute(dnnl::stream strm) {
     execPtr->exec(primArgs, strm);
 }
 
+dnnl::primitive Convolution::getReplayablePrimitive() const {
+    if (execPtr && !execPtr->needReordering())
+        return execPtr->getExecPrim();
+    return {};
+}
+
 void Convolution::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
     if (withSumBroadcast) {
@@ -105,6 +105,7 @@ private:
 
     void prepareParams() override;
     void execute(dnnl::stream strm) override;
+    dnnl::primitive getReplayablePrimitive() const override;
     void executeDynamicImpl(dnnl::stream strm) override;
     void addLegacyZeroPoints(dnnl::primitive_attr& attr);
     void addZeroPoints(dnnl::primitive_attr& attr);
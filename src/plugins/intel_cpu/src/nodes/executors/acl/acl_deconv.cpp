@@ -163,6 +163,14 @@ static MemoryPtr prepareWeightMemory(const std::vector<MemoryCPtr>& src, const E
         return newWei;
     };
 
+    if (auto sharedWeightCache = context->getSharedWeightsCache()) {
+        const std::string string_hash = "deconv_acl_" + WeightsSharing::descKey(src[0]->getDescPtr()) + "_" +
+                                        WeightsSharing::descKey(src[1]->getDescPtr()) + "_" +
+                                        WeightsSharing::dataKey(src[1]->getData(), src[1]->getSize());
+        DEBUG_LOG("ACLDeconvExecutor: findOrCreate in the shared cache, string_hash: ", string_hash);
+        return sharedWeightCache->findOrCreateByContent(string_hash, create);
+    }
+
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr) {
         std::string format = "deconv_acl_" + std::to_string(N) + "_" + std::to_string(C);
@@ -49,8 +49,13 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr srcWeightDesc,
 
     auto globalWeightCache = context->getWeightsCache();
     MemoryPtr ptr;
-    if (globalWeightCache &&
-        dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
+    if (auto sharedWeightCache = context->getSharedWeightsCache()) {
+        const std::string string_hash = WeightsSharing::descKey(dstWeightDesc) + "_" +
+                                        WeightsSharing::descKey(srcWeightDesc) + "_" +
+                                        WeightsSharing::dataKey(weightsMem->getData(), weightsMem->getSize());
+        ptr = sharedWeightCache->findOrCreateByContent(string_hash, create);
+    } else if (globalWeightCache &&
+               dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
         const std::string string_hash = format + "_" + std::to_string(weightsMem->getSize()) + "_" +
                                         std::to_string(*weightsMem->getDataAs<uint64_t>());
         ptr = *globalWeightCache->findOrCreate(string_hash, create);
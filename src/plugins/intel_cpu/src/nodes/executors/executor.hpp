@@ -84,8 +84,10 @@ public:
                     const std::vector<impl_desc_type>& implPriorities,
                     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache = nullptr)
         : runtimeCache(graphContext->getParamsCache()),
-          scratchPads(graphContext->getScratchPads()),
+          graphContext(graphContext),
+          scratchPads(graphContext->getNumNumaNodes()),
           weightsCache(graphContext->getWeightsCache()),
+          sharedWeightsCache(graphContext->getSharedWeightsCache()),
           engine(graphContext->getEngine()),
           implPriorities(implPriorities),
           privateWeighCache(std::move(privateWeighCache)),
@@ -103,7 +105,15 @@ public:
             subStreamID = 0;
         if (subStreamID >= numNumaNodes - 1)
             subStreamID = numNumaNodes - 1;
-        return scratchPads[subStreamID];
+        // the executors are created after the graph has chosen the execution mode, which defines whether
+        // the scratch pad is shared by the nodes
+        auto& scratchPad = scratchPads[subStreamID];
+        if (!scratchPad) {
+            auto graphContextPtr = graphContext.lock();
+            assert(graphContextPtr);
+            scratchPad = graphContextPtr->getScratchPad(subStreamID);
+        }
+        return scratchPad;
     }
 
     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> getPrivateWeighCache() const {
@@ -122,12 +132,19 @@ public:
         return weightsCache;
     }
 
+    const WeightsSharing::Ptr getSharedWeightsCache() const {
+        return sharedWeightsCache;
+    }
+
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
     MultiCacheWeakPtr runtimeCache;
-    std::vector<DnnlScratchPadPtr> scratchPads;
+    std::weak_ptr<const GraphContext> graphContext;
+    // resolved on the first use
+    mutable std::vector<DnnlScratchPadPtr> scratchPads;
     WeightsSharing::Ptr weightsCache;
+    WeightsSharing::Ptr sharedWeightsCache;
     const dnnl::engine& engine;
     std::vector<impl_desc_type> implPriorities;
     // @todo remove after global cache is used exclusevly
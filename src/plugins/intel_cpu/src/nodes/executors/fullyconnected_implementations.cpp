@@ -22,6 +22,7 @@
 #include "nodes/executors/precision_matcher.hpp"
 #include "nodes/executors/precision_translation.hpp"
 #include "nodes/executors/type_mask.hpp"
+#include "nodes/executors/x64/brgemm_decompression_fc.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "ov_optional.hpp"
 #include "utils/cpp/maybe_unused.hpp"
@@ -301,6 +302,36 @@ const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
                     context,
                     false);
             })
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_brgemm_decompression",
+            ExecutorType::jit_x64,
+            OperationType::FullyConnected,
+            ShapeTolerance::Dependant,
+            // supports
+            [](const FCConfig& config) -> bool {
+                VERIFY(noPostOps(config), UNSUPPORTED_POST_OPS);
+                VERIFY(noSparseDecompression(config), UNSUPPORTED_SPARSE_WEIGHTS);
+                return BrgemmDecompressionFCExecutor::supports(config);
+            },
+            // requiresFallback
+            [](const FCConfig& config) -> ov::optional<executor::Config<FCAttrs>> {
+                // the same descriptors as for oneDNN, which handles the shapes with the small number of rows
+                return requiresFallbackCommon(config,
+                                              dnnlFCTypeMapping,
+                                              dnnlFCLayoutConfig,
+                                              dnnlFCMappingNotation);
+            },
+            // acceptsShapes
+            [](const MemoryArgs& memory) -> bool {
+                return BrgemmDecompressionFCExecutor::acceptsShapes(memory);
+            },
+            // create
+            [](const FCAttrs& attrs,
+               const PostOps& postOps,
+               const MemoryArgs& memory,
+               ExecutorContext::CPtr context) -> std::shared_ptr<Executor> {
+                return std::make_shared<BrgemmDecompressionFCExecutor>(attrs, postOps, memory, context);
+            })
         OV_CPU_INSTANCE_DNNL(
             "fullyconnected_dnnl",
             ExecutorType::Dnnl,
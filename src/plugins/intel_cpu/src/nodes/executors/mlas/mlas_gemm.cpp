@@ -47,6 +47,14 @@ static MemoryPtr prepareWeightMemory(const MemoryPtr weightsMemory,
         return _ptr;
     };
 
+    if (auto sharedWeightCache = context->getSharedWeightsCache()) {
+        const std::string string_hash = "gemm_mlas_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                        std::to_string(weightsTransposed) + "_" +
+                                        WeightsSharing::dataKey(weightsMemory->getData(), weightsMemory->getSize());
+        DEBUG_LOG("MlasGemmExecutor: findOrCreate in the shared cache, string_hash: ", string_hash);
+        return sharedWeightCache->findOrCreateByContent(string_hash, create);
+    }
+
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr) {
         std::string format = "gemm_mlas_" + std::to_string(N) + "_" + std::to_string(K);
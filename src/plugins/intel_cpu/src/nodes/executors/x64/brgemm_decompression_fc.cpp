@@ -0,0 +1,482 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "brgemm_decompression_fc.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/kernels/x64/brgemm_kernel.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace dnnl::impl::cpu::x64;
+using namespace ov::element;
+
+namespace {
+template <ov::element::Type_t T>
+float loadCompressed(const uint8_t* data, size_t idx);
+
+template <>
+float loadCompressed<ov::element::Type_t::u8>(const uint8_t* data, size_t idx) {
+    return static_cast<float>(data[idx]);
+}
+
+template <>
+float loadCompressed<ov::element::Type_t::i8>(const uint8_t* data, size_t idx) {
+    return static_cast<float>(reinterpret_cast<const int8_t*>(data)[idx]);
+}
+
+// 4 bit types are packed two values per byte, the even element in the low half
+template <>
+float loadCompressed<ov::element::Type_t::u4>(const uint8_t* data, size_t idx) {
+    return static_cast<float>((data[idx / 2] >> ((idx % 2) * 4)) & 0xF);
+}
+
+template <>
+float loadCompressed<ov::element::Type_t::i4>(const uint8_t* data, size_t idx) {
+    const int value = (data[idx / 2] >> ((idx % 2) * 4)) & 0xF;
+    return static_cast<float>(value >= 8 ? value - 16 : value);
+}
+
+float loadValue(const uint8_t* data, ov::element::Type type, size_t idx) {
+    switch (type) {
+    case ov::element::u8:
+        return loadCompressed<ov::element::Type_t::u8>(data, idx);
+    case ov::element::i8:
+        return loadCompressed<ov::element::Type_t::i8>(data, idx);
+    case ov::element::u4:
+        return loadCompressed<ov::element::Type_t::u4>(data, idx);
+    case ov::element::i4:
+        return loadCompressed<ov::element::Type_t::i4>(data, idx);
+    case ov::element::f32:
+        return reinterpret_cast<const float*>(data)[idx];
+    case ov::element::bf16:
+        return static_cast<float>(reinterpret_cast<const ov::bfloat16*>(data)[idx]);
+    case ov::element::f16:
+        return static_cast<float>(reinterpret_cast<const ov::float16*>(data)[idx]);
+    default:
+        OPENVINO_THROW("BrgemmDecompressionFCExecutor: unsupported decompression parameters precision ", type);
+    }
+}
+
+// the decompression parameters are either per tensor, per output channel or per group of input channels
+bool isSupportedParamsCount(size_t count, size_t N, size_t K) {
+    return count == 1 || (count % N == 0 && K % (count / N) == 0);
+}
+
+size_t paramsGroups(const MemoryCPtr& params, size_t N) {
+    if (!params)
+        return 1;
+    const auto count = params->getShape().getElementsCount();
+    return count == 1 ? 1 : count / N;
+}
+
+// converts the parameters to the dense f32 [N, groups] representation
+std::vector<float> prepareParams(const MemoryCPtr& params, size_t N, size_t groups, float defaultValue) {
+    std::vector<float> values(N * groups, defaultValue);
+    if (!params)
+        return values;
+
+    const auto count = params->getShape().getElementsCount();
+    const auto paramsGroupsNum = paramsGroups(params, N);
+    const auto* data = params->getDataAs<const uint8_t>();
+    for (size_t n = 0; n < N; n++) {
+        for (size_t g = 0; g < groups; g++) {
+            const size_t idx = count == 1 ? 0 : n * paramsGroupsNum + g * paramsGroupsNum / groups;
+            values[n * groups + g] = loadValue(data, params->getPrecision(), idx);
+        }
+    }
+    return values;
+}
+
+// converts the vectors of 16 compressed weights to bf16: (w - zeroPoint) * scale
+// the f32 source is used to convert the output tiles with the unit scale and zero shift
+struct jit_decompress_weights : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_decompress_weights)
+
+    typedef struct {
+        const uint8_t* src;
+        ov::bfloat16* dst;
+        float scale;
+        float zeroPoint;
+        // multiple of vecLen, the 4 bit source starts at the byte boundary
+        size_t count;
+    } args_t;
+
+    typedef void (*fn_t)(const args_t*);
+
+    static constexpr size_t vecLen = 16;
+
+    explicit jit_decompress_weights(ov::element::Type type) : jit_generator(jit_name()), m_type(type) {}
+
+    fn_t get() {
+        return jit_ker() || create_kernel() == dnnl::impl::status::success ? (fn_t)jit_ker() : nullptr;
+    }
+
+    void generate() override {
+        preamble();
+
+        mov(reg_src, ptr[abi_param1 + offsetof(args_t, src)]);
+        mov(reg_dst, ptr[abi_param1 + offsetof(args_t, dst)]);
+        mov(reg_count, ptr[abi_param1 + offsetof(args_t, count)]);
+        vbroadcastss(zmm_scale, ptr[abi_param1 + offsetof(args_t, scale)]);
+        vbroadcastss(zmm_zero_point, ptr[abi_param1 + offsetof(args_t, zeroPoint)]);
+        if (one_of(m_type, u4, i4)) {
+            mov(reg_tmp, 0xF);
+            vpbroadcastd(zmm_nibble_mask, reg_tmp.cvt32());
+            mov(reg_tmp, reinterpret_cast<size_t>(nibblesOrder));
+            vmovdqu32(zmm_nibbles_order, ptr[reg_tmp]);
+        }
+
+        Xbyak::Label loop, exit;
+        L(loop);
+        cmp(reg_count, vecLen);
+        jl(exit, T_NEAR);
+
+        load(zmm_value);
+        if (m_type != f32)
+            vcvtdq2ps(zmm_value, zmm_value);
+        vsubps(zmm_value, zmm_value, zmm_zero_point);
+        vmulps(zmm_value, zmm_value, zmm_scale);
+        vcvtneps2bf16(ymm_value, zmm_value);
+        vmovdqu16(yword[reg_dst], ymm_value);
+
+        add(reg_src, vecLen * m_type.bitwidth() / 8);
+        add(reg_dst, vecLen * sizeof(ov::bfloat16));
+        sub(reg_count, vecLen);
+        jmp(loop, T_NEAR);
+        L(exit);
+
+        postamble();
+    }
+
+private:
+    void load(const Xbyak::Zmm& zmm) {
+        switch (m_type) {
+        case ov::element::f32:
+            vmovups(zmm, zword[reg_src]);
+            break;
+        case ov::element::u8:
+            vpmovzxbd(zmm, xword[reg_src]);
+            break;
+        case ov::element::i8:
+            vpmovsxbd(zmm, xword[reg_src]);
+            break;
+        case ov::element::u4:
+        case ov::element::i4: {
+            // 8 bytes are widened to the dwords, the low nibbles are the even elements, the high ones are the odd
+            const Xbyak::Ymm ymm_low(zmm.getIdx());
+            const Xbyak::Ymm ymm_high(zmm_high.getIdx());
+            vpmovzxbd(ymm_low, qword[reg_src]);
+            if (m_type == u4) {
+                vpsrld(ymm_high, ymm_low, 4);
+                vpandd(ymm_low, ymm_low, Xbyak::Ymm(zmm_nibble_mask.getIdx()));
+            } else {
+                vpslld(ymm_high, ymm_low, 24);
+                vpsrad(ymm_high, ymm_high, 28);
+                vpslld(ymm_low, ymm_low, 28);
+                vpsrad(ymm_low, ymm_low, 28);
+            }
+            vpermt2d(zmm, zmm_nibbles_order, zmm_high);
+            break;
+        }
+        default:
+            OPENVINO_THROW("BrgemmDecompressionFCExecutor: unsupported weights precision ", m_type);
+        }
+    }
+
+    const ov::element::Type m_type;
+
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_dst = r9;
+    const Xbyak::Reg64 reg_count = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+
+    const Xbyak::Zmm zmm_value = zmm0;
+    const Xbyak::Ymm ymm_value = ymm0;
+    const Xbyak::Zmm zmm_high = zmm1;
+    const Xbyak::Zmm zmm_scale = zmm2;
+    const Xbyak::Zmm zmm_zero_point = zmm3;
+    const Xbyak::Zmm zmm_nibble_mask = zmm4;
+    const Xbyak::Zmm zmm_nibbles_order = zmm5;
+
+    // interleaves the low (indices 0..7) and the high (indices 16..23) nibbles
+    alignas(64) static const uint32_t nibblesOrder[vecLen];
+};
+
+alignas(64) const uint32_t jit_decompress_weights::nibblesOrder[jit_decompress_weights::vecLen] = {
+    0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23};
+
+// the kernels are shared by all the executors, nullptr if the kernel can't be generated
+template <ov::element::Type_t T>
+jit_decompress_weights::fn_t decompressKernel() {
+    static jit_decompress_weights kernel(T);
+    static const auto fn = kernel.get();
+    return fn;
+}
+
+template <ov::element::Type_t T>
+float loadCompressedValue(const uint8_t* data, size_t idx) {
+    return loadCompressed<T>(data, idx);
+}
+
+template <>
+float loadCompressedValue<ov::element::Type_t::f32>(const uint8_t* data, size_t idx) {
+    return reinterpret_cast<const float*>(data)[idx];
+}
+
+// converts the elements [idx, idx + count) of the source, the aligned part is done by the vector kernel,
+// the unaligned head of the 4 bit source and the tail shorter than the vector are converted by the scalar code
+template <ov::element::Type_t T>
+void decompressSpan(const uint8_t* src,
+                    size_t idx,
+                    size_t count,
+                    float scale,
+                    float zeroPoint,
+                    ov::bfloat16* dst,
+                    jit_decompress_weights::fn_t kernel) {
+    constexpr bool is4bit = T == ov::element::Type_t::u4 || T == ov::element::Type_t::i4;
+    constexpr size_t elementBits = is4bit ? 4 : (T == ov::element::Type_t::f32 ? 32 : 8);
+    const size_t head = std::min(count, is4bit ? idx % 2 : size_t(0));
+    const size_t body = kernel ? (count - head) / jit_decompress_weights::vecLen * jit_decompress_weights::vecLen : 0;
+
+    for (size_t i = 0; i < head; i++)
+        dst[i] = ov::bfloat16((loadCompressedValue<T>(src, idx + i) - zeroPoint) * scale);
+    if (body) {
+        jit_decompress_weights::args_t args{src + (idx + head) * elementBits / 8,
+                                            dst + head,
+                                            scale,
+                                            zeroPoint,
+                                            body};
+        kernel(&args);
+    }
+    for (size_t i = head + body; i < count; i++)
+        dst[i] = ov::bfloat16((loadCompressedValue<T>(src, idx + i) - zeroPoint) * scale);
+}
+
+template <ov::element::Type_t T>
+void decompressRows(const uint8_t* weights,
+                    const float* scales,
+                    const float* zeroPoints,
+                    size_t n0,
+                    size_t nc,
+                    size_t K,
+                    size_t groups,
+                    size_t groupSize,
+                    ov::bfloat16* tile) {
+    const auto kernel = decompressKernel<T>();
+    for (size_t n = 0; n < nc; n++) {
+        const size_t row = n0 + n;
+        for (size_t g = 0; g < groups; g++) {
+            decompressSpan<T>(weights,
+                              row * K + g * groupSize,
+                              groupSize,
+                              scales[row * groups + g],
+                              zeroPoints[row * groups + g],
+                              tile + n * K + g * groupSize,
+                              kernel);
+        }
+    }
+}
+}  // namespace
+
+constexpr size_t BrgemmDecompressionFCExecutor::N_blk;
+constexpr size_t BrgemmDecompressionFCExecutor::minRows;
+
+BrgemmDecompressionFCExecutor::BrgemmDecompressionFCExecutor(const FCAttrs& attrs,
+                                                             const PostOps& postOps,
+                                                             const MemoryArgs& memory,
+                                                             const ExecutorContext::CPtr context)
+    : m_context(context),
+      m_weiType(memory.at(ARG_WEI)->getPrecision()) {
+    const auto& weiDims = memory.at(ARG_WEI)->getStaticDims();
+    N = weiDims[0];
+    K = weiDims[1];
+    m_groups = std::max(paramsGroups(attrs.decompressionMultiplyPtr, N),
+                        paramsGroups(attrs.decompressionSubtractPtr, N));
+    m_groupSize = K / m_groups;
+    m_scales = prepareParams(attrs.decompressionMultiplyPtr, N, m_groups, 1.f);
+    m_zeroPoints = prepareParams(attrs.decompressionSubtractPtr, N, m_groups, 0.f);
+}
+
+bool BrgemmDecompressionFCExecutor::supports(const FCConfig& config) {
+    VERIFY(mayiuse(avx512_core_bf16), UNSUPPORTED_ISA);
+    VERIFY(config.attrs.decompressionMultiplyPtr, " weights are not compressed");
+    VERIFY(!config.attrs.withBias && !config.attrs.weightsNonTransposed && config.attrs.dequantizationScales.empty(),
+           HEURISTICS_MISMATCH);
+    VERIFY(srcType(config) == bf16, UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(one_of(weiType(config), u8, i8, u4, i4), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(one_of(dstType(config), bf16, f32), UNSUPPORTED_DST_PRECISIONS);
+    VERIFY(weiRank(config) == 2, UNSUPPORTED_WEI_RANK);
+
+    const auto& weiDims = config.descs.at(ARG_WEI)->getShape().getStaticDims();
+    const auto N = weiDims[0];
+    const auto K = weiDims[1];
+    for (const auto& params : {config.attrs.decompressionMultiplyPtr, config.attrs.decompressionSubtractPtr}) {
+        VERIFY(!params || isSupportedParamsCount(params->getShape().getElementsCount(), N, K),
+               " unsupported decompression parameters shape");
+    }
+    const auto groups = std::max(paramsGroups(config.attrs.decompressionMultiplyPtr, N),
+                                 paramsGroups(config.attrs.decompressionSubtractPtr, N));
+    for (const auto& params : {config.attrs.decompressionMultiplyPtr, config.attrs.decompressionSubtractPtr}) {
+        VERIFY(groups % paramsGroups(params, N) == 0, " unsupported decompression parameters shape");
+    }
+
+    return true;
+}
+
+bool BrgemmDecompressionFCExecutor::acceptsShapes(const MemoryArgs& memory) {
+    const auto& srcDims = memory.at(ARG_SRC)->getStaticDims();
+    const auto rows = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    VERIFY(rows >= minRows, HEURISTICS_MISMATCH);
+    return true;
+}
+
+bool BrgemmDecompressionFCExecutor::update(const MemoryArgs& memory) {
+    const auto& srcDims = memory.at(ARG_SRC)->getStaticDims();
+    const auto rows = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    if (rows == M && m_kernel)
+        return true;
+
+    M = rows;
+    // the kernel writes f32 tile [M_blk, nc], the B tile is [nc, K] (transposed)
+    auto makeKernel = [&](size_t nc) -> std::shared_ptr<BrgemmKernel> {
+        if (nc == 0)
+            return nullptr;
+        return std::make_shared<BrgemmKernel>(M, nc, K, K, K, nc, true, ov::element::bf16);
+    };
+    m_kernel = makeKernel(std::min(N, N_blk));
+    m_kernelTail = N > N_blk ? makeKernel(N % N_blk) : nullptr;
+
+    const auto alignment = size_t(64);
+    m_threadBufferSize = rnd_up(N_blk * K * bf16.size(), alignment) +
+                         rnd_up(m_kernel->get_scratch_b_size(), alignment) +
+                         rnd_up(m_kernel->get_mblk_size() * N_blk * f32.size(), alignment) +
+                         rnd_up(m_kernel->get_scratch_a_size(), alignment) +
+                         rnd_up(m_kernel->get_wsp_size(), alignment);
+    m_threads = parallel_get_max_threads();
+    const auto bufferSize = m_threadBufferSize * m_threads;
+    if (!m_buffers || m_buffers->getSize() < bufferSize) {
+        m_buffers = std::make_shared<Memory>(m_context->getEngine(), CpuBlockedMemoryDesc(u8, Shape{bufferSize}));
+    }
+
+    return true;
+}
+
+impl_desc_type BrgemmDecompressionFCExecutor::implType() const {
+    // the jit decompression distinguishes the executor from the oneDNN brgemm implementations
+    return mayiuse(avx512_core_amx) ? impl_desc_type::jit_avx512_amx : impl_desc_type::jit_avx512;
+}
+
+void BrgemmDecompressionFCExecutor::decompressTile(const uint8_t* weights, size_t n0, size_t nc, void* tile) const {
+    auto* dst = reinterpret_cast<ov::bfloat16*>(tile);
+    switch (m_weiType) {
+    case ov::element::u8:
+        decompressRows<ov::element::Type_t::u8>(weights, m_scales.data(), m_zeroPoints.data(),
+                                                n0, nc, K, m_groups, m_groupSize, dst);
+        break;
+    case ov::element::i8:
+        decompressRows<ov::element::Type_t::i8>(weights, m_scales.data(), m_zeroPoints.data(),
+                                                n0, nc, K, m_groups, m_groupSize, dst);
+        break;
+    case ov::element::u4:
+        decompressRows<ov::element::Type_t::u4>(weights, m_scales.data(), m_zeroPoints.data(),
+                                                n0, nc, K, m_groups, m_groupSize, dst);
+        break;
+    case ov::element::i4:
+        decompressRows<ov::element::Type_t::i4>(weights, m_scales.data(), m_zeroPoints.data(),
+                                                n0, nc, K, m_groups, m_groupSize, dst);
+        break;
+    default:
+        OPENVINO_THROW("BrgemmDecompressionFCExecutor: unsupported weights precision ", m_weiType);
+    }
+}
+
+void BrgemmDecompressionFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<uint8_t>();
+    const auto* weights = memory.at(ARG_WEI)->getDataAs<const uint8_t>();
+    const auto& dstMem = memory.at(ARG_DST);
+    auto* dst = dstMem->getDataAs<uint8_t>();
+    const auto dstPrc = dstMem->getPrecision();
+    auto* buffers = m_buffers->getDataAs<uint8_t>();
+    const auto convertKernel = dstPrc == bf16 ? decompressKernel<ov::element::Type_t::f32>() : nullptr;
+
+    const size_t mBlk = m_kernel->get_mblk_size();
+    const size_t nBlocks = div_up(N, N_blk);
+    const size_t mBlocks = div_up(M, mBlk);
+    const auto alignment = size_t(64);
+
+    // the work is split by the [N_blk, mBlk] tiles, the blocks of M are the inner dimension, so a thread
+    // decompresses the weights tile once for all its consecutive blocks of M. If there are fewer blocks of N than
+    // threads, the same weights tile is decompressed by several threads, each multiplying it by a part of the rows
+    parallel_nt(static_cast<int>(m_threads), [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(nBlocks * mBlocks, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        auto* tile = buffers + ithr * m_threadBufferSize;
+        auto* packedTile = tile + rnd_up(N_blk * K * bf16.size(), alignment);
+        auto* out = packedTile + rnd_up(m_kernel->get_scratch_b_size(), alignment);
+        auto* scratchA = out + rnd_up(mBlk * N_blk * f32.size(), alignment);
+        auto* wsp = scratchA + rnd_up(m_kernel->get_scratch_a_size(), alignment);
+
+        size_t packedBlock = nBlocks;
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const size_t nb = iwork / mBlocks;
+            const size_t n0 = nb * N_blk;
+            const size_t nc = std::min(N_blk, N - n0);
+            auto& kernel = nc == N_blk || !m_kernelTail ? m_kernel : m_kernelTail;
+
+            // decompress the tile and pack it to the VNNI layout once for all the rows
+            if (packedBlock != nb) {
+                decompressTile(weights, n0, nc, tile);
+                kernel->copy_buffer_b(tile, packedTile);
+                packedBlock = nb;
+            }
+
+            const size_t m0 = (iwork % mBlocks) * mBlk;
+            const size_t mc = std::min(mBlk, M - m0);
+            kernel->executeGemm(mc < mBlk,
+                                const_cast<uint8_t*>(src) + m0 * K * bf16.size(),
+                                packedTile,
+                                out,
+                                wsp,
+                                scratchA);
+            const auto* outF32 = reinterpret_cast<const float*>(out);
+            for (size_t m = 0; m < mc; m++) {
+                const float* outRow = outF32 + m * nc;
+                const size_t dstOffset = (m0 + m) * N + n0;
+                if (dstPrc == f32) {
+                    std::memcpy(reinterpret_cast<float*>(dst) + dstOffset, outRow, nc * sizeof(float));
+                } else {
+                    decompressSpan<ov::element::Type_t::f32>(reinterpret_cast<const uint8_t*>(outRow),
+                                                             0,
+                                                             nc,
+                                                             1.f,
+                                                             0.f,
+                                                             reinterpret_cast<ov::bfloat16*>(dst) + dstOffset,
+                                                             convertKernel);
+                }
+            }
+        }
+    });
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov {
+namespace intel_cpu {
+
+class BrgemmKernel;
+
+/**
+ * @brief FullyConnected executor for the weights compressed to u8 / i8 / u4 / i4 and the bf16 source with many rows
+ * (e.g. the prompt processing of LLMs).
+ *
+ * The weights are decompressed by the jit kernel by the tiles of N_blk output channels and packed to the VNNI layout
+ * expected by the bf16 brgemm kernel (AMX or avx512_core_bf16). The work is split by the tiles of N_blk output
+ * channels and the brgemm block of rows, the decompressed tile stays in cache while it is multiplied by the rows of
+ * all the consecutive tiles of a thread, so the decompression cost is amortized over M and no decompressed copy of
+ * the whole weights is materialized.
+ */
+class BrgemmDecompressionFCExecutor : public Executor {
+public:
+    BrgemmDecompressionFCExecutor(const FCAttrs& attrs,
+                                  const PostOps& postOps,
+                                  const MemoryArgs& memory,
+                                  const ExecutorContext::CPtr context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    impl_desc_type implType() const override;
+
+    bool update(const MemoryArgs& memory) override;
+
+    // the decompression parameters are small and read by all the threads, the weights are taken from the memory
+    void moveMemToNumaNode(int numaNodeID) override {}
+
+    static bool supports(const FCConfig& config);
+
+    // the decompression on the fly is amortized only for the big enough number of rows
+    static bool acceptsShapes(const MemoryArgs& memory);
+
+private:
+    void decompressTile(const uint8_t* weights, size_t n0, size_t nc, void* tile) const;
+
+    static constexpr size_t N_blk = 64;
+    static constexpr size_t minRows = 64;
+
+    const ExecutorContext::CPtr m_context;
+    ov::element::Type m_weiType;
+    size_t M = 0, N = 0, K = 0;
+    size_t m_groupSize = 0;
+    size_t m_groups = 1;
+    // [N, groups] decompression parameters converted to f32
+    std::vector<float> m_scales;
+    std::vector<float> m_zeroPoints;
+
+    std::shared_ptr<BrgemmKernel> m_kernel;
+    std::shared_ptr<BrgemmKernel> m_kernelTail;
+    // per thread buffers: decompressed tile, packed tile, output tile, scratch A and workspace
+    MemoryPtr m_buffers;
+    size_t m_threadBufferSize = 0;
+    size_t m_threads = 0;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -18,6 +18,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/fullyconnected_config.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "post_ops.hpp"
 #include "shape_inference/custom/fullyconnected.hpp"
@@ -62,6 +63,8 @@ FullyConnected::FullyConnected(const std::shared_ptr<ov::Node>& op, const GraphC
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage))
         OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+
+    withLora = op->get_input_size() == 5;
 }
 
 bool FullyConnected::canBeExecutedInInt8() const {
@@ -84,6 +87,85 @@ void FullyConnected::prepareParams() {
 
 void FullyConnected::execute(dnnl::stream strm) {
     executor->execute(memory);
+    if (withLora)
+        executeLora();
+}
+
+namespace {
+template <typename T>
+void addLoraOutput(T* dst, const float* hidden, const float* loraB, size_t M, size_t N, size_t rank) {
+    parallel_for2d(M, N, [&](size_t m, size_t n) {
+        const float* h = hidden + m * rank;
+        const float* b = loraB + n * rank;
+        float acc = 0.f;
+        for (size_t r = 0; r < rank; r++)
+            acc += h[r] * b[r];
+        T& y = dst[m * N + n];
+        y = static_cast<T>(static_cast<float>(y) + acc);
+    });
+}
+}  // namespace
+
+// Adds the low-rank adapter correction B * (alpha * (A * src)) to the output of the main executor.
+// The adapter is read from the node inputs on each inference, so it may be switched between the inferences.
+void FullyConnected::executeLora() {
+    const auto& srcMem = getSrcMemoryAtPort(DATA_ID);
+    const auto& loraAMem = getSrcMemoryAtPort(LORA_A_ID);
+    const auto& loraAlphaMem = getSrcMemoryAtPort(LORA_ALPHA_ID);
+    const auto& loraBMem = getSrcMemoryAtPort(LORA_B_ID);
+    const auto& dstMem = getDstMemoryAtPort(0);
+
+    const auto& loraADims = loraAMem->getStaticDims();
+    const auto& loraBDims = loraBMem->getStaticDims();
+    const size_t rank = loraADims[0];
+    // no adapter is set
+    if (rank == 0)
+        return;
+
+    const size_t K = loraADims[1];
+    const size_t N = loraBDims[0];
+    // a single alpha is broadcast to all the rank channels
+    const size_t alphaSize = loraAlphaMem->getShape().getElementsCount();
+    OPENVINO_ASSERT(srcMem->getStaticDims().back() == K && dstMem->getStaticDims().back() == N &&
+                        loraBDims[1] == rank && one_of(alphaSize, rank, 1u),
+                    errorPrefix,
+                    " has inconsistent shapes of the LoRA inputs");
+    const size_t alphaStride = alphaSize == 1 ? 0 : 1;
+    const size_t M = dstMem->getShape().getElementsCount() / N;
+
+    const float* src = srcMem->getDataAs<const float>();
+    if (srcMem->getPrecision() != ov::element::f32) {
+        loraSrc.resize(M * K);
+        cpu_convert(srcMem->getData(), loraSrc.data(), srcMem->getPrecision(), ov::element::f32, M * K);
+        src = loraSrc.data();
+    }
+
+    const auto* loraA = loraAMem->getDataAs<const float>();
+    const auto* loraAlpha = loraAlphaMem->getDataAs<const float>();
+    loraHidden.resize(M * rank);
+    parallel_for2d(M, rank, [&](size_t m, size_t r) {
+        const float* x = src + m * K;
+        const float* a = loraA + r * K;
+        float acc = 0.f;
+        for (size_t k = 0; k < K; k++)
+            acc += x[k] * a[k];
+        loraHidden[m * rank + r] = acc * loraAlpha[r * alphaStride];
+    });
+
+    const auto* loraB = loraBMem->getDataAs<const float>();
+    switch (dstMem->getPrecision()) {
+    case ov::element::f32:
+        addLoraOutput(dstMem->getDataAs<float>(), loraHidden.data(), loraB, M, N, rank);
+        break;
+    case ov::element::bf16:
+        addLoraOutput(dstMem->getDataAs<ov::bfloat16>(), loraHidden.data(), loraB, M, N, rank);
+        break;
+    case ov::element::f16:
+        addLoraOutput(dstMem->getDataAs<ov::float16>(), loraHidden.data(), loraB, M, N, rank);
+        break;
+    default:
+        OPENVINO_THROW(errorPrefix, " doesn't support LoRA with output precision ", dstMem->getPrecision());
+    }
 }
 
 void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
@@ -91,9 +173,17 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the post ops would be applied before the LoRA correction is added
+    if (withLora)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
+bool FullyConnected::isExecutable() const {
+    // the empty LoRA inputs mean no adapter is set
+    return !isInputTensorAtPortEmpty(DATA_ID) && !isInputTensorAtPortEmpty(WEIGHTS_ID);
+}
+
 bool FullyConnected::created() const {
     return getType() == Type::FullyConnected;
 }
@@ -240,6 +330,12 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     nodeConfig.inConfs.emplace_back(nodeDescriptors.at(ARG_SRC));
     nodeConfig.inConfs.emplace_back(nodeDescriptors.at(ARG_WEI));
     if (attrs.withBias) nodeConfig.inConfs.emplace_back(nodeDescriptors.at(ARG_BIAS));
+    // the adapters are applied in f32
+    if (withLora) {
+        for (const auto port : {LORA_A_ID, LORA_ALPHA_ID, LORA_B_ID})
+            nodeConfig.inConfs.emplace_back(
+                creatorsMap.at(LayoutType::ncsp)->createSharedDesc(ov::element::f32, getInputShapeAtPort(port)));
+    }
 
     const int inPlace = canBeInPlace() ? 0 : -1;
     nodeConfig.outConfs.emplace_back(nodeDescriptors.at(ARG_DST), BlockedMemoryDesc::FULL_MASK, inPlace);
@@ -33,6 +33,8 @@ public:
         return false;
     }
 
+    bool isExecutable() const override;
+
     int getFusingAxis() const override {
         return getOutputShapeAtPort(0).getRank() == 3 ? 2 : 1;
     }
@@ -69,8 +71,13 @@ private:
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
     static const size_t BIAS_ID = 2;
+    // low-rank adapter inputs: A [rank, IC], alpha [1, rank], B [OC, rank]
+    static const size_t LORA_A_ID = 2;
+    static const size_t LORA_ALPHA_ID = 3;
+    static const size_t LORA_B_ID = 4;
 
     ExecutorPtr createExecutor();
+    void executeLora();
     void fuseDecompressionConstant(const MemoryCPtr& memory, MemoryCPtr& decompressionValuesPtr);
 
     FCAttrs attrs;
@@ -79,6 +86,10 @@ private:
     ExecutorFactoryPtr<FCAttrs, node::FullyConnected> factory;
     ExecutorPtr executor = nullptr;
     std::string errorPrefix;
+
+    bool withLora = false;
+    std::vector<float> loraSrc;
+    std::vector<float> loraHidden;
 };
 
 }  // namespace node
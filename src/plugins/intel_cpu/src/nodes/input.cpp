@@ -6,6 +6,7 @@
 
 #include "cpu/x64/jit_generator.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "shape_inference/shape_inference_pass_through.hpp"
 
 using namespace dnnl;
@@ -16,6 +17,9 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+// alignment of the memory allocated for the copies of the constants shared by the streams
+static constexpr size_t sharedBlobAlignment = 64;
+
 #if defined(OPENVINO_ARCH_X86_64)
 namespace {
 struct jit_has_subnormals_base : public jit_generator {
@@ -373,15 +377,33 @@ void Input::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
+    // IRs already have all subnormals flushed to zero, but in
+    // read_model scenario with directly loaded original model still can have subnormals
+    auto canReuseBlob = [&] () {
+        return prec != element::string && isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA();
+    };
+
+    auto reuseBlob = [&, this] () -> MemoryPtr {
+        return std::make_shared<Memory>(getEngine(), memDesc, constOp->get_data_ptr());
+    };
+
     auto weightCache = context->getWeightsCache();
 
     if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        // The streams of a single socket share the constant memory of the model as is, so the weights of the model
+        // imported from the memory mapped cache blob are loaded on demand and shared with other processes.
+        // It's safe as the memory is never written, and the constants are owned by the model of the compiled model,
+        // which outlives the weights cache. The reuse is limited to the data aligned as the copies are, so the kernels
+        // get the same alignment in both cases. On the multi-socket systems the weights are copied to be local
+        // for each socket.
+        const bool reuse = get_num_sockets() == 1 &&
+                           reinterpret_cast<uintptr_t>(constOp->get_data_ptr()) % sharedBlobAlignment == 0 &&
+                           canReuseBlob();
+        MemoryPtr ptr = reuse ? *weightCache->findOrCreate(blobKey(), reuseBlob)
+                              : *weightCache->findOrCreate(blobKey(), cloneBlob);
         memoryPtr = std::const_pointer_cast<const IMemory>(ptr);
-    // IRs already have all subnormals flushed to zero, but in
-    // read_model scenario with directly loaded original model still can have subnormals
-    } else if (prec != element::string && isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA()) {
-        memoryPtr = std::make_shared<Memory>(getEngine(), memDesc, constOp->get_data_ptr());
+    } else if (canReuseBlob()) {
+        memoryPtr = reuseBlob();
     } else {
         memoryPtr = std::const_pointer_cast<const IMemory>(cloneBlob());
     }
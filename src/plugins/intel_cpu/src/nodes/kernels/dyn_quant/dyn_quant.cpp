@@ -0,0 +1,258 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <float.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "nodes/kernels/scaled_attn/common.hpp"
+#include "dyn_quant.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+static void find_minmax(const float* src, size_t n, float& min, float& max) {
+    size_t i = 0;
+    max = -FLT_MAX;
+    min = FLT_MAX;
+#if defined(HAVE_AVX512F)
+    auto v_max = _mm512_set1_ps(-FLT_MAX);
+    auto v_min = _mm512_set1_ps(FLT_MAX);
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        auto v = _mm512_loadu_ps(src + i);
+        v_max = _mm512_max_ps(v_max, v);
+        v_min = _mm512_min_ps(v_min, v);
+    }
+    max = _mm512_reduce_max_ps(v_max);
+    min = _mm512_reduce_min_ps(v_min);
+#elif defined(HAVE_AVX2)
+    auto v_max = _mm256_set1_ps(-FLT_MAX);
+    auto v_min = _mm256_set1_ps(FLT_MAX);
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        auto v = _mm256_loadu_ps(src + i);
+        v_max = _mm256_max_ps(v_max, v);
+        v_min = _mm256_min_ps(v_min, v);
+    }
+    hmax(v_max);
+    hmin(v_min);
+    max = _mm256_cvtss_f32(v_max);
+    min = _mm256_cvtss_f32(v_min);
+#endif
+    for (; i < n; i++) {
+        max = std::max(max, src[i]);
+        min = std::min(min, src[i]);
+    }
+}
+
+static float find_absmax(const float* src, size_t n) {
+    size_t i = 0;
+    float max = 0.f;
+#if defined(HAVE_AVX512F)
+    auto v_max = _mm512_setzero_ps();
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        v_max = _mm512_max_ps(v_max, _mm512_abs_ps(_mm512_loadu_ps(src + i)));
+    }
+    max = _mm512_reduce_max_ps(v_max);
+#elif defined(HAVE_AVX2)
+    auto v_sign = _mm256_set1_ps(-0.f);
+    auto v_max = _mm256_setzero_ps();
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        v_max = _mm256_max_ps(v_max, _mm256_andnot_ps(v_sign, _mm256_loadu_ps(src + i)));
+    }
+    hmax(v_max);
+    max = _mm256_cvtss_f32(v_max);
+#endif
+    for (; i < n; i++) {
+        max = std::max(max, std::abs(src[i]));
+    }
+    return max;
+}
+
+void dyn_quant_u8(const float* src, uint8_t* dst, size_t n, float& scale, float& zp) {
+    float max, min;
+    find_minmax(src, n, min, max);
+    // the constant group is kept exactly by the unit scale
+    scale = max > min ? (max - min) / 255 : 1.f;
+    zp = -min / scale;
+
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    auto v_inv = _mm512_set1_ps(1 / scale);
+    auto v_zp = _mm512_set1_ps(zp);
+    auto v_zero = _mm512_setzero_epi32();
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        auto v = _mm512_fmadd_ps(_mm512_loadu_ps(src + i), v_inv, v_zp);
+        auto v_i32 = _mm512_cvt_roundps_epi32(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        v_i32 = _mm512_max_epi32(v_i32, v_zero);
+        _mm512_mask_cvtusepi32_storeu_epi8(dst + i, 0xffff, v_i32);
+    }
+#elif defined(HAVE_AVX2)
+    auto v_inv = _mm256_set1_ps(1 / scale);
+    auto v_zp = _mm256_set1_ps(zp);
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        auto v = _mm256_fmadd_ps(_mm256_loadu_ps(src + i), v_inv, v_zp);
+        auto v_i32 = _mm256_cvtps_epi32(_mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        auto packed = _mm_packs_epi32(_mm256_castsi256_si128(v_i32), _mm256_extractf128_si256(v_i32, 1));
+        packed = _mm_packus_epi16(packed, packed);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = static_cast<uint8_t>(std::min(std::max(std::nearbyint(src[i] / scale + zp), 0.f), 255.f));
+    }
+}
+
+void dyn_quant_i8(const float* src, int8_t* dst, size_t n, float& scale, int32_t& sum) {
+    const float max = find_absmax(src, n);
+    scale = max > 0.f ? max / 127 : 1.f;
+    sum = 0;
+
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    auto v_inv = _mm512_set1_ps(1 / scale);
+    auto v_sum = _mm512_setzero_si512();
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        auto v = _mm512_mul_ps(_mm512_loadu_ps(src + i), v_inv);
+        auto v_i32 = _mm512_cvt_roundps_epi32(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        v_sum = _mm512_add_epi32(v_sum, v_i32);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm512_cvtsepi32_epi8(v_i32));
+    }
+    sum = _mm512_reduce_add_epi32(v_sum);
+#elif defined(HAVE_AVX2)
+    auto v_inv = _mm256_set1_ps(1 / scale);
+    auto v_sum = _mm256_setzero_si256();
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        auto v = _mm256_mul_ps(_mm256_loadu_ps(src + i), v_inv);
+        auto v_i32 = _mm256_cvtps_epi32(_mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        v_sum = _mm256_add_epi32(v_sum, v_i32);
+        auto packed = _mm_packs_epi32(_mm256_castsi256_si128(v_i32), _mm256_extractf128_si256(v_i32, 1));
+        packed = _mm_packs_epi16(packed, packed);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+    int32_t sums[vec_len_f32_avx2];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums), v_sum);
+    for (size_t j = 0; j < vec_len_f32_avx2; j++)
+        sum += sums[j];
+#endif
+    for (; i < n; i++) {
+        dst[i] = static_cast<int8_t>(std::nearbyint(src[i] / scale));
+        sum += dst[i];
+    }
+}
+
+void dyn_quant_cols_i8(const float* src,
+                       size_t src_stride,
+                       int8_t* dst,
+                       size_t dst_stride,
+                       size_t rows,
+                       size_t cols,
+                       float* scales,
+                       int32_t* sums) {
+    size_t c = 0;
+#if defined(HAVE_AVX512F)
+    auto v_one = _mm512_set1_ps(1.f);
+    for (; c + vec_len_f32_avx512 <= cols; c += vec_len_f32_avx512) {
+        auto v_max = _mm512_setzero_ps();
+        for (size_t r = 0; r < rows; r++) {
+            v_max = _mm512_max_ps(v_max, _mm512_abs_ps(_mm512_loadu_ps(src + r * src_stride + c)));
+        }
+        auto zero_mask = _mm512_cmp_ps_mask(v_max, _mm512_setzero_ps(), _CMP_EQ_OQ);
+        auto v_scale = _mm512_mask_blend_ps(zero_mask, _mm512_mul_ps(v_max, _mm512_set1_ps(1.f / 127)), v_one);
+        auto v_inv = _mm512_div_ps(v_one, v_scale);
+        auto v_sum = _mm512_setzero_si512();
+        for (size_t r = 0; r < rows; r++) {
+            auto v = _mm512_mul_ps(_mm512_loadu_ps(src + r * src_stride + c), v_inv);
+            auto v_i32 = _mm512_cvt_roundps_epi32(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            v_sum = _mm512_add_epi32(v_sum, v_i32);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + r * dst_stride + c), _mm512_cvtsepi32_epi8(v_i32));
+        }
+        _mm512_storeu_ps(scales + c, v_scale);
+        _mm512_storeu_si512(sums + c, v_sum);
+    }
+#elif defined(HAVE_AVX2)
+    auto v_one = _mm256_set1_ps(1.f);
+    auto v_sign = _mm256_set1_ps(-0.f);
+    for (; c + vec_len_f32_avx2 <= cols; c += vec_len_f32_avx2) {
+        auto v_max = _mm256_setzero_ps();
+        for (size_t r = 0; r < rows; r++) {
+            v_max = _mm256_max_ps(v_max, _mm256_andnot_ps(v_sign, _mm256_loadu_ps(src + r * src_stride + c)));
+        }
+        auto zero_mask = _mm256_cmp_ps(v_max, _mm256_setzero_ps(), _CMP_EQ_OQ);
+        auto v_scale = _mm256_blendv_ps(_mm256_mul_ps(v_max, _mm256_set1_ps(1.f / 127)), v_one, zero_mask);
+        auto v_inv = _mm256_div_ps(v_one, v_scale);
+        auto v_sum = _mm256_setzero_si256();
+        for (size_t r = 0; r < rows; r++) {
+            auto v = _mm256_mul_ps(_mm256_loadu_ps(src + r * src_stride + c), v_inv);
+            auto v_i32 = _mm256_cvtps_epi32(_mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+            v_sum = _mm256_add_epi32(v_sum, v_i32);
+            auto packed = _mm_packs_epi32(_mm256_castsi256_si128(v_i32), _mm256_extractf128_si256(v_i32, 1));
+            packed = _mm_packs_epi16(packed, packed);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + r * dst_stride + c), packed);
+        }
+        _mm256_storeu_ps(scales + c, v_scale);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums + c), v_sum);
+    }
+#endif
+    for (; c < cols; c++) {
+        float max = 0.f;
+        for (size_t r = 0; r < rows; r++) {
+            max = std::max(max, std::abs(src[r * src_stride + c]));
+        }
+        const float scale = max > 0.f ? max / 127 : 1.f;
+        int32_t sum = 0;
+        for (size_t r = 0; r < rows; r++) {
+            auto q = static_cast<int8_t>(std::nearbyint(src[r * src_stride + c] / scale));
+            dst[r * dst_stride + c] = q;
+            sum += q;
+        }
+        scales[c] = scale;
+        sums[c] = sum;
+    }
+}
+
+void dyn_quant_dequant(const int32_t* acc,
+                       float* dst,
+                       size_t n,
+                       float a_scale,
+                       float a_zp,
+                       const float* b_scales,
+                       const int32_t* b_sums) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    auto v_a_scale = _mm512_set1_ps(a_scale);
+    auto v_a_zp = _mm512_set1_ps(a_zp);
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        auto v_acc = _mm512_cvtepi32_ps(_mm512_loadu_si512(acc + i));
+        auto v_sum = _mm512_cvtepi32_ps(_mm512_loadu_si512(b_sums + i));
+        auto v = _mm512_fnmadd_ps(v_a_zp, v_sum, v_acc);
+        v = _mm512_mul_ps(v, _mm512_mul_ps(v_a_scale, _mm512_loadu_ps(b_scales + i)));
+        _mm512_storeu_ps(dst + i, v);
+    }
+#elif defined(HAVE_AVX2)
+    auto v_a_scale = _mm256_set1_ps(a_scale);
+    auto v_a_zp = _mm256_set1_ps(a_zp);
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        auto v_acc = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + i)));
+        auto v_sum = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b_sums + i)));
+        auto v = _mm256_fnmadd_ps(v_a_zp, v_sum, v_acc);
+        v = _mm256_mul_ps(v, _mm256_mul_ps(v_a_scale, _mm256_loadu_ps(b_scales + i)));
+        _mm256_storeu_ps(dst + i, v);
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = a_scale * b_scales[i] * (static_cast<float>(acc[i]) - a_zp * static_cast<float>(b_sums[i]));
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// The kernels of the dynamic (per inference) quantization of the activations. A group of the first GEMM operand is
+//  quantized to u8 with a scale and a zero point: src = (dst - zp) * scale, a group of the second operand is quantized
+//  to i8 symmetrically: src = dst * scale. The u8 x i8 product of the groups is dequantized by dyn_quant_dequant().
+
+// quantizes n contiguous values
+void dyn_quant_u8(const float* src, uint8_t* dst, size_t n, float& scale, float& zp);
+
+// quantizes n contiguous values, sum receives the sum of the quantized values
+void dyn_quant_i8(const float* src, int8_t* dst, size_t n, float& scale, int32_t& sum);
+
+// quantizes each column of the [rows, cols] block, a column is a group, sums receive the sums of the quantized columns
+void dyn_quant_cols_i8(const float* src,
+                       size_t src_stride,
+                       int8_t* dst,
+                       size_t dst_stride,
+                       size_t rows,
+                       size_t cols,
+                       float* scales,
+                       int32_t* sums);
+
+// dst[i] = a_scale * b_scales[i] * (acc[i] - a_zp * b_sums[i]), dst may alias acc
+void dyn_quant_dequant(const int32_t* acc,
+                       float* dst,
+                       size_t n,
+                       float a_scale,
+                       float a_zp,
+                       const float* b_scales,
+                       const int32_t* b_sums);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
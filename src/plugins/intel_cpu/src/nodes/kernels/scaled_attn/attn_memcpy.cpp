@@ -81,20 +81,23 @@ static void paged_attn_memcpy_kernel(const ov::intel_cpu::PlainTensor& k_input,
                                      const ov::intel_cpu::PlainTensor& v_input,
                                      const ov::intel_cpu::PlainTensor& past_k_output,
                                      const ov::intel_cpu::PlainTensor& past_v_output,
-                                     const ov::intel_cpu::PlainTensor& slot_mapping) {
-    size_t B = k_input.m_dims[0], H = k_input.m_dims[1], L1 = k_input.m_dims[2], S = k_input.m_dims[3];
+                                     const ov::intel_cpu::PlainTensor& slot_mapping,
+                                     const ov::intel_cpu::PlainTensor& v_slot_mapping) {
+    size_t B = k_input.m_dims[0], H = k_input.m_dims[1], L1 = k_input.m_dims[2], S = k_input.m_dims[3], SV = v_input.m_dims[3];
     size_t block_size = past_k_output.m_dims[2];
     parallel_for3d(B, L1, H, [&](size_t b, size_t m, size_t h) {
         auto slot = slot_mapping.ptr<int32_t>(b)[m];
-        if (slot < 0) return;
-        auto block_number = slot / block_size;
-        auto block_offset = slot % block_size;
-        attn_copy(past_k_output.ptr<T2>(block_number, h, block_offset, 0),
-                  k_input.ptr<T>(b, h, m, 0),
-                  S);
-        attn_copy(past_v_output.ptr<T2>(block_number, h, block_offset, 0),
-                  v_input.ptr<T>(b, h, m, 0),
-                  S);
+        if (slot >= 0) {
+            attn_copy(past_k_output.ptr<T2>(slot / block_size, h, slot % block_size, 0),
+                      k_input.ptr<T>(b, h, m, 0),
+                      S);
+        }
+        auto v_slot = v_slot_mapping.ptr<int32_t>(b)[m];
+        if (v_slot >= 0) {
+            attn_copy(past_v_output.ptr<T2>(v_slot / block_size, h, v_slot % block_size, 0),
+                      v_input.ptr<T>(b, h, m, 0),
+                      SV);
+        }
     });
 }
 
@@ -102,20 +105,23 @@ static void paged_attn_memcpy_kernel(const ov::intel_cpu::PlainTensor& k_input,
                                      const ov::intel_cpu::PlainTensor& v_input,
                                      const ov::intel_cpu::PlainTensor& past_k_output,
                                      const ov::intel_cpu::PlainTensor& past_v_output,
-                                     const ov::intel_cpu::PlainTensor& slot_mapping) {
-    size_t B = k_input.m_dims[0], H = k_input.m_dims[1], L1 = k_input.m_dims[2], S = k_input.m_dims[3];
+                                     const ov::intel_cpu::PlainTensor& slot_mapping,
+                                     const ov::intel_cpu::PlainTensor& v_slot_mapping) {
+    size_t B = k_input.m_dims[0], H = k_input.m_dims[1], L1 = k_input.m_dims[2], S = k_input.m_dims[3], SV = v_input.m_dims[3];
     size_t block_size = past_k_output.m_dims[2];
     parallel_for3d(B, L1, H, [&](size_t b, size_t m, size_t h) {
         auto slot = slot_mapping.ptr<int32_t>(b)[m];
-        if (slot < 0) return;
-        auto block_number = slot / block_size;
-        auto block_offset = slot % block_size;
-        std::memcpy(past_k_output.ptr_v(block_number, h, block_offset, 0),
-                    k_input.ptr_v(b, h, m, 0),
-                    S * k_input.m_element_size);
-        std::memcpy(past_v_output.ptr_v(block_number, h, block_offset, 0),
-                    v_input.ptr_v(b, h, m, 0),
-                    S * v_input.m_element_size);
+        if (slot >= 0) {
+            std::memcpy(past_k_output.ptr_v(slot / block_size, h, slot % block_size, 0),
+                        k_input.ptr_v(b, h, m, 0),
+                        S * k_input.m_element_size);
+        }
+        auto v_slot = v_slot_mapping.ptr<int32_t>(b)[m];
+        if (v_slot >= 0) {
+            std::memcpy(past_v_output.ptr_v(v_slot / block_size, h, v_slot % block_size, 0),
+                        v_input.ptr_v(b, h, m, 0),
+                        SV * v_input.m_element_size);
+        }
     });
 }
 
@@ -138,13 +144,14 @@ void paged_attn_memcpy(const ov::intel_cpu::PlainTensor& k_input,
                        const ov::intel_cpu::PlainTensor& v_input,
                        const ov::intel_cpu::PlainTensor& past_k_output,
                        const ov::intel_cpu::PlainTensor& past_v_output,
-                       const ov::intel_cpu::PlainTensor& slot_mapping) {
+                       const ov::intel_cpu::PlainTensor& slot_mapping,
+                       const ov::intel_cpu::PlainTensor& v_slot_mapping) {
     if (past_k_output.get_precision() == k_input.get_precision()) {
-        paged_attn_memcpy_kernel(k_input, v_input, past_k_output, past_v_output, slot_mapping);
+        paged_attn_memcpy_kernel(k_input, v_input, past_k_output, past_v_output, slot_mapping, v_slot_mapping);
     } else if (k_input.get_precision() == ov::element::f32 && past_k_output.get_precision() == ov::element::f16) {
-        paged_attn_memcpy_kernel<float, ov::float16>(k_input, v_input, past_k_output, past_v_output, slot_mapping);
+        paged_attn_memcpy_kernel<float, ov::float16>(k_input, v_input, past_k_output, past_v_output, slot_mapping, v_slot_mapping);
     } else if (k_input.get_precision() == ov::element::f32 && past_k_output.get_precision() == ov::element::bf16) {
-        paged_attn_memcpy_kernel<float, ov::bfloat16>(k_input, v_input, past_k_output, past_v_output, slot_mapping);
+        paged_attn_memcpy_kernel<float, ov::bfloat16>(k_input, v_input, past_k_output, past_v_output, slot_mapping, v_slot_mapping);
     } else {
         OPENVINO_THROW("unsupport src type: ", k_input.get_precision(), ", dst type: ", past_k_output.get_precision(), " in paged_attn_memcpy");
     }
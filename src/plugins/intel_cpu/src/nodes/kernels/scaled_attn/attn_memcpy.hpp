@@ -24,7 +24,8 @@ void paged_attn_memcpy(const ov::intel_cpu::PlainTensor& k_input,
                        const ov::intel_cpu::PlainTensor& v_input,
                        const ov::intel_cpu::PlainTensor& past_k_output,
                        const ov::intel_cpu::PlainTensor& past_v_output,
-                       const ov::intel_cpu::PlainTensor& slot_mapping);
+                       const ov::intel_cpu::PlainTensor& slot_mapping,
+                       const ov::intel_cpu::PlainTensor& v_slot_mapping);
 
 void attn_memcpy2d_kernel(void* src,
                           void* dst,
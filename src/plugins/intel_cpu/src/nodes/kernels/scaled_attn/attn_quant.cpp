@@ -26,10 +26,10 @@ namespace XARCH {
 using namespace ov;
 
 template<typename T>
-static void quant_u8(const T* src, uint8_t* dst, size_t n, float& scale, float& zp) {
+static void find_minmax(const T* src, size_t n, float& min, float& max) {
     size_t i = 0;
-    float max = -FLT_MAX;
-    float min = FLT_MAX;
+    max = -FLT_MAX;
+    min = FLT_MAX;
 #if defined(HAVE_AVX512F)
     auto v0_max = _mm512_set1_ps(-FLT_MAX);
     auto v0_min = _mm512_set1_ps(FLT_MAX);
@@ -130,10 +130,16 @@ static void quant_u8(const T* src, uint8_t* dst, size_t n, float& scale, float&
         max = std::max(max, tmp);
         min = std::min(min, tmp);
     }
+}
+
+template<typename T>
+static void quant_u8(const T* src, uint8_t* dst, size_t n, float& scale, float& zp) {
+    size_t i = 0;
+    float max, min;
+    find_minmax(src, n, min, max);
     scale = (max - min) / 255;
     zp = -min / scale;
 
-    i = 0;
 #if defined(HAVE_AVX512F)
     auto v_scale = _mm512_set1_ps(1 / scale);
     auto v_zp = _mm512_set1_ps(zp);
@@ -167,6 +173,68 @@ static void quant_u8(const T* src, uint8_t* dst, size_t n, float& scale, float&
     }
 }
 
+// packs each 16 features into 8 bytes, the low nibble of the byte i keeps the feature i and the high nibble keeps
+//  the feature i + 8, the tail chunk is padded with zeros
+template<typename T>
+static void quant_u4(const T* src, uint8_t* dst, size_t n, float& scale, float& zp) {
+    float max, min;
+    find_minmax(src, n, min, max);
+    scale = (max - min) / 15;
+    zp = -min / scale;
+
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    auto v_scale = _mm256_set1_ps(1 / scale);
+    auto v_zp = _mm256_set1_ps(zp);
+    auto v_zero = _mm256_setzero_si256();
+    auto v_max = _mm256_set1_epi32(15);
+    for (; i + 2 * vec_len_f32_avx2 <= n; i += 2 * vec_len_f32_avx2) {
+        auto v0 = _mm256_fmadd_ps(mm256_uni_loadu_ps(src + i), v_scale, v_zp);
+        auto v1 = _mm256_fmadd_ps(mm256_uni_loadu_ps(src + i + vec_len_f32_avx2), v_scale, v_zp);
+        auto v0_i32 = _mm256_cvtps_epi32(_mm256_round_ps(v0, _MM_ROUND_NEAREST));
+        auto v1_i32 = _mm256_cvtps_epi32(_mm256_round_ps(v1, _MM_ROUND_NEAREST));
+        v0_i32 = _mm256_min_epi32(_mm256_max_epi32(v0_i32, v_zero), v_max);
+        v1_i32 = _mm256_min_epi32(_mm256_max_epi32(v1_i32, v_zero), v_max);
+        auto packed_i32 = _mm256_or_si256(v0_i32, _mm256_slli_epi32(v1_i32, 4));
+        auto packed = _mm_packs_epi32(_mm256_castsi256_si128(packed_i32), _mm256_extractf128_si256(packed_i32, 1));
+        packed = _mm_packus_epi16(packed, packed);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i / 2), packed);
+    }
+#endif
+    // the nibbles of the tail are OR-ed into the bytes, so all the remaining bytes of the row are cleared first
+    if (i < n) {
+        std::memset(dst + i / 2, 0, quant_data_bytes(n, ov::element::u4) - i / 2);
+    }
+    for (; i < n; i++) {
+        float tmp = src[i];
+        auto q = static_cast<uint8_t>(std::min(std::max(std::round(tmp / scale + zp), 0.0f), 15.0f));
+        auto& byte = dst[i / 16 * 8 + i % 8];
+        byte |= (i % 16 < 8) ? q : static_cast<uint8_t>(q << 4);
+    }
+}
+
+static void dequant_u4(const uint8_t* src, float* dst, size_t n, float scale, float zp) {
+    for (size_t i = 0; i < n; i++) {
+        auto byte = src[i / 16 * 8 + i % 8];
+        float tmp = (i % 16 < 8) ? (byte & 0xF) : (byte >> 4);
+        dst[i] = (tmp - zp) * scale;
+    }
+}
+
+template<typename T>
+static void quant_row(const T* src, uint8_t* row, size_t n, size_t groups, ov::element::Type precision) {
+    auto scale_zp = reinterpret_cast<float*>(row);
+    auto data = row + groups * sizeof(float) * 2;
+    auto group_size = n / groups;
+    for (size_t g = 0; g < groups; g++) {
+        if (precision == ov::element::u4) {
+            quant_u4(src + g * group_size, data + g * group_size / 2, group_size, scale_zp[2 * g], scale_zp[2 * g + 1]);
+        } else {
+            quant_u8(src + g * group_size, data + g * group_size, group_size, scale_zp[2 * g], scale_zp[2 * g + 1]);
+        }
+    }
+}
+
 template <typename T, typename T2>
 static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
                           const ov::intel_cpu::PlainTensor& v_src,
@@ -175,19 +243,24 @@ static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
                           const ov::intel_cpu::PlainTensor& k_scale_zp,
                           const ov::intel_cpu::PlainTensor& v_scale_zp) {
     size_t B = k_src.m_dims[0], H = k_src.m_dims[1], L1 = k_src.m_dims[2], S = k_src.m_dims[3];
+    // scale_zp: [B, H, L, 2 * groups], the (scale, zp) pairs of the groups of a token
+    size_t groups = k_scale_zp.m_dims[3] / 2;
+    size_t group_size = S / groups;
     parallel_for3d(B, H, L1, [&](size_t b, size_t h, size_t m) {
         auto p_k = k_scale_zp.ptr<float>(b, h, m);
         auto p_v = v_scale_zp.ptr<float>(b, h, m);
-        quant_u8(k_src.ptr<T>(b, h, m),
-                 k_dst.ptr<T2>(b, h, m),
-                 S,
-                 p_k[0],
-                 p_k[1]);
-        quant_u8(v_src.ptr<T>(b, h, m),
-                 v_dst.ptr<T2>(b, h, m),
-                 S,
-                 p_v[0],
-                 p_v[1]);
+        for (size_t g = 0; g < groups; g++) {
+            quant_u8(k_src.ptr<T>(b, h, m) + g * group_size,
+                     k_dst.ptr<T2>(b, h, m) + g * group_size,
+                     group_size,
+                     p_k[2 * g],
+                     p_k[2 * g + 1]);
+            quant_u8(v_src.ptr<T>(b, h, m) + g * group_size,
+                     v_dst.ptr<T2>(b, h, m) + g * group_size,
+                     group_size,
+                     p_v[2 * g],
+                     p_v[2 * g + 1]);
+        }
     });
 }
 
@@ -196,29 +269,30 @@ static void paged_attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
                                 const ov::intel_cpu::PlainTensor& v_src,
                                 const ov::intel_cpu::PlainTensor& k_dst,
                                 const ov::intel_cpu::PlainTensor& v_dst,
-                                const ov::intel_cpu::PlainTensor& slot_mapping) {
-    size_t B = k_src.m_dims[0], H = k_src.m_dims[1], L1 = k_src.m_dims[2], S = k_src.m_dims[3];
+                                const ov::intel_cpu::PlainTensor& slot_mapping,
+                                const ov::intel_cpu::PlainTensor& v_slot_mapping) {
+    size_t B = k_src.m_dims[0], H = k_src.m_dims[1], L1 = k_src.m_dims[2], S = k_src.m_dims[3], SV = v_src.m_dims[3];
     size_t block_size = k_dst.m_dims[2];
+    // the layout of a token row is described in attn_quant.hpp
+    auto k_groups = quant_row_groups(S, k_dst.m_dims[3], k_dst.get_precision());
+    auto v_groups = quant_row_groups(SV, v_dst.m_dims[3], v_dst.get_precision());
     parallel_for3d(B, L1, H, [&](size_t b, size_t m, size_t h) {
         auto slot = slot_mapping.ptr<int32_t>(b)[m];
-        if (slot < 0) return;
-        auto block_number = slot / block_size;
-        auto block_offset = slot % block_size;
-
-        auto p_k = reinterpret_cast<float*>(k_dst.ptr<T2>(block_number, h, block_offset));
-        auto p_v = reinterpret_cast<float*>(v_dst.ptr<T2>(block_number, h, block_offset));
-        // The layout for per token per head:
-        // |scale(f32)|zeropoint(f32)|quantized feature(u8,idx_1)|quantized feature(u8,idx_2)|...|quantized feature(u8,idx_S)|
-        quant_u8(k_src.ptr<T>(b, h, m),
-                 k_dst.ptr<T2>(block_number, h, block_offset) + sizeof(float) + sizeof(float),
-                 S,
-                 p_k[0],
-                 p_k[1]);
-        quant_u8(v_src.ptr<T>(b, h, m),
-                 v_dst.ptr<T2>(block_number, h, block_offset) + sizeof(float) + sizeof(float),
-                 S,
-                 p_v[0],
-                 p_v[1]);
+        if (slot >= 0) {
+            quant_row(k_src.ptr<T>(b, h, m),
+                      k_dst.ptr<T2>(slot / block_size, h, slot % block_size),
+                      S,
+                      k_groups,
+                      k_dst.get_precision());
+        }
+        auto v_slot = v_slot_mapping.ptr<int32_t>(b)[m];
+        if (v_slot >= 0) {
+            quant_row(v_src.ptr<T>(b, h, m),
+                      v_dst.ptr<T2>(v_slot / block_size, h, v_slot % block_size),
+                      SV,
+                      v_groups,
+                      v_dst.get_precision());
+        }
     });
 }
 
@@ -241,11 +315,13 @@ void paged_attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
                         const ov::intel_cpu::PlainTensor& v_src,
                         const ov::intel_cpu::PlainTensor& k_dst,
                         const ov::intel_cpu::PlainTensor& v_dst,
-                        const ov::intel_cpu::PlainTensor& slot_mapping) {
-    if (k_src.get_precision() == ov::element::f32 && k_dst.get_precision() == ov::element::u8) {
-        paged_attn_quant_mt<float, uint8_t>(k_src, v_src, k_dst, v_dst, slot_mapping);
-    } else if (k_src.get_precision() == ov::element::bf16 && k_dst.get_precision() == ov::element::u8) {
-        paged_attn_quant_mt<ov::bfloat16, uint8_t>(k_src, v_src, k_dst, v_dst, slot_mapping);
+                        const ov::intel_cpu::PlainTensor& slot_mapping,
+                        const ov::intel_cpu::PlainTensor& v_slot_mapping) {
+    auto is_quantized = k_dst.get_precision() == ov::element::u8 || k_dst.get_precision() == ov::element::u4;
+    if (k_src.get_precision() == ov::element::f32 && is_quantized) {
+        paged_attn_quant_mt<float, uint8_t>(k_src, v_src, k_dst, v_dst, slot_mapping, v_slot_mapping);
+    } else if (k_src.get_precision() == ov::element::bf16 && is_quantized) {
+        paged_attn_quant_mt<ov::bfloat16, uint8_t>(k_src, v_src, k_dst, v_dst, slot_mapping, v_slot_mapping);
     } else {
         OPENVINO_THROW("unsupport src type: ", k_src.get_precision(), ", dst type: ", k_dst.get_precision(), " in paged_attn_quantkv");
     }
@@ -289,6 +365,23 @@ void attn_dequant_u8(const uint8_t* src, float* dst, size_t n, float scale, floa
     }
 }
 
+void attn_quant_row(const float* src, uint8_t* row, size_t n, size_t groups, ov::element::Type precision) {
+    quant_row(src, row, n, groups, precision);
+}
+
+void attn_dequant_row(const uint8_t* row, float* dst, size_t n, size_t groups, ov::element::Type precision) {
+    auto scale_zp = reinterpret_cast<const float*>(row);
+    auto data = row + groups * sizeof(float) * 2;
+    auto group_size = n / groups;
+    for (size_t g = 0; g < groups; g++) {
+        if (precision == ov::element::u4) {
+            dequant_u4(data + g * group_size / 2, dst + g * group_size, group_size, scale_zp[2 * g], scale_zp[2 * g + 1]);
+        } else {
+            attn_dequant_u8(data + g * group_size, dst + g * group_size, group_size, scale_zp[2 * g], scale_zp[2 * g + 1]);
+        }
+    }
+}
+
 }  // namespace XARCH
 }  // namespace Cpu
 }  // namespace Extensions
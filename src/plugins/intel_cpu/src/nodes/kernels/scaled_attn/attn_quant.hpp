@@ -15,6 +15,30 @@ namespace Extensions {
 namespace Cpu {
 namespace XARCH {
 
+// The layout for per token per head of the paged u8/u4 kv cache:
+// |scale(f32)|zeropoint(f32)| of each group |quantized feature(idx_1)|quantized feature(idx_2)|...|quantized feature(idx_S)|
+// u8 keeps one feature per byte. u4 packs each 16 features into 8 bytes: the low nibble of the byte i keeps the feature i
+//  and the high nibble keeps the feature i + 8. A head with several u4 groups has the group size of a multiple of 16.
+inline size_t quant_data_bytes(size_t S, ov::element::Type precision) {
+    return precision == ov::element::u4 ? (S + 15) / 16 * 8 : S;
+}
+
+inline size_t quant_row_bytes(size_t S, size_t groups, ov::element::Type precision) {
+    return groups * sizeof(float) * 2 + quant_data_bytes(S, precision);
+}
+
+inline size_t quant_row_groups(size_t S, size_t row_bytes, ov::element::Type precision) {
+    return (row_bytes - quant_data_bytes(S, precision)) / (sizeof(float) * 2);
+}
+
+// groups of a head with S features, group_size 0 or a size not dividing the head quantizes the whole head at once
+inline size_t quant_groups(size_t S, size_t group_size, ov::element::Type precision) {
+    if (group_size == 0 || group_size >= S || S % group_size != 0 ||
+        (precision == ov::element::u4 && group_size % 16 != 0))
+        return 1;
+    return S / group_size;
+}
+
 void attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
                   const ov::intel_cpu::PlainTensor& v_src,
                   const ov::intel_cpu::PlainTensor& k_dst,
@@ -26,12 +50,17 @@ void paged_attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
                         const ov::intel_cpu::PlainTensor& v_src,
                         const ov::intel_cpu::PlainTensor& k_dst,
                         const ov::intel_cpu::PlainTensor& v_dst,
-                        const ov::intel_cpu::PlainTensor& slot_mapping);
+                        const ov::intel_cpu::PlainTensor& slot_mapping,
+                        const ov::intel_cpu::PlainTensor& v_slot_mapping);
 
 void attn_quant_u8(const float* src, uint8_t* dst, size_t n, float& scale, float& zp);
 
 void attn_dequant_u8(const uint8_t* src, float* dst, size_t n, float scale, float zp);
 
+void attn_quant_row(const float* src, uint8_t* row, size_t n, size_t groups, ov::element::Type precision);
+
+void attn_dequant_row(const uint8_t* row, float* dst, size_t n, size_t groups, ov::element::Type precision);
+
 }  // namespace XARCH
 }  // namespace Cpu
 }  // namespace Extensions
@@ -16,6 +16,7 @@
 #include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/parallel.hpp"
 #include "mha_single_token.hpp"
+#include "attn_quant.hpp"
 #include "common.hpp"
 #include "softmax_kernel.hpp"
 
@@ -1057,6 +1058,214 @@ static void dot_product_block(TA* a, uint8_t* b, float* c, size_t n, size_t bloc
     }
 }
 
+// Kernels of the grouped u8/u4 kv cache, the layout of a token row is described in attn_quant.hpp.
+//  The features i of the u4 data are expected to start at a 16 features chunk.
+template <bool IS_U4>
+static inline float quant_feature(uint8_t* b, size_t i) {
+    if (IS_U4) {
+        auto byte = b[i / 16 * 8 + i % 8];
+        return (i % 16 < 8) ? (byte & 0xF) : (byte >> 4);
+    }
+    return b[i];
+}
+
+#if defined(HAVE_AVX512F)
+// 16 quantized features starting from the feature i
+template <bool IS_U4>
+static inline __m512 mm512_loadu_quant_ps(uint8_t* b, size_t i) {
+    if (IS_U4) {
+        auto v_i32 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i*>(b + i / 2)));
+        auto v_low = _mm256_and_si256(v_i32, _mm256_set1_epi32(0xF));
+        auto v_high = _mm256_srli_epi32(v_i32, 4);
+        return _mm512_cvtepi32_ps(_mm512_inserti64x4(_mm512_castsi256_si512(v_low), v_high, 1));
+    }
+    return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<__m128i*>(b + i))));
+}
+#elif defined(HAVE_AVX2)
+// 16 quantized features starting from the feature i
+template <bool IS_U4>
+static inline void mm256_loadu_quant_ps(uint8_t* b, size_t i, __m256& v0, __m256& v1) {
+    if (IS_U4) {
+        auto v_i32 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i*>(b + i / 2)));
+        v0 = _mm256_cvtepi32_ps(_mm256_and_si256(v_i32, _mm256_set1_epi32(0xF)));
+        v1 = _mm256_cvtepi32_ps(_mm256_srli_epi32(v_i32, 4));
+    } else {
+        v0 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i*>(b + i))));
+        v1 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i*>(b + i + vec_len_f32_avx2))));
+    }
+}
+#endif
+
+template <typename TA, bool IS_U4>
+static float dot_product_group(TA* a, uint8_t* b, size_t n, float scale, float zp) {
+    size_t i = 0;
+    float sum = 0.0f;
+#if defined(HAVE_AVX512F)
+    auto vsum0 = _mm512_setzero_ps();
+    auto vsum1 = _mm512_setzero_ps();
+    auto v_zp = _mm512_set1_ps(zp);
+    for (; i + 2 * vec_len_f32_avx512 <= n; i += 2 * vec_len_f32_avx512) {
+        auto va0 = mm512_uni_loadu_ps(a + i);
+        auto va1 = mm512_uni_loadu_ps(a + i + vec_len_f32_avx512);
+        auto vb0 = _mm512_sub_ps(mm512_loadu_quant_ps<IS_U4>(b, i), v_zp);
+        auto vb1 = _mm512_sub_ps(mm512_loadu_quant_ps<IS_U4>(b, i + vec_len_f32_avx512), v_zp);
+        vsum0 = _mm512_fmadd_ps(va0, vb0, vsum0);
+        vsum1 = _mm512_fmadd_ps(va1, vb1, vsum1);
+    }
+    if (i + vec_len_f32_avx512 <= n) {
+        auto va0 = mm512_uni_loadu_ps(a + i);
+        auto vb0 = _mm512_sub_ps(mm512_loadu_quant_ps<IS_U4>(b, i), v_zp);
+        vsum0 = _mm512_fmadd_ps(va0, vb0, vsum0);
+        i += vec_len_f32_avx512;
+    }
+    sum = _mm512_reduce_add_ps(_mm512_add_ps(vsum0, vsum1));
+#elif defined(HAVE_AVX2)
+    auto vsum0 = _mm256_setzero_ps();
+    auto vsum1 = _mm256_setzero_ps();
+    auto v_zp = _mm256_set1_ps(zp);
+    for (; i + 2 * vec_len_f32_avx2 <= n; i += 2 * vec_len_f32_avx2) {
+        __m256 vb0, vb1;
+        mm256_loadu_quant_ps<IS_U4>(b, i, vb0, vb1);
+        auto va0 = mm256_uni_loadu_ps(a + i);
+        auto va1 = mm256_uni_loadu_ps(a + i + vec_len_f32_avx2);
+        vsum0 = _mm256_fmadd_ps(va0, _mm256_sub_ps(vb0, v_zp), vsum0);
+        vsum1 = _mm256_fmadd_ps(va1, _mm256_sub_ps(vb1, v_zp), vsum1);
+    }
+    vsum0 = _mm256_add_ps(vsum0, vsum1);
+    hsum(vsum0);
+    sum = _mm256_cvtss_f32(vsum0);
+#endif
+    for (; i < n; i++) {
+        sum += a[i] * (quant_feature<IS_U4>(b, i) - zp);
+    }
+    return scale * sum;
+}
+
+template <bool IS_U4>
+static void attn_acc_value_group(float* out, float weight, uint8_t* v, size_t n, float scale, float zp) {
+    size_t i = 0;
+    weight *= scale;
+#if defined(HAVE_AVX512F)
+    auto attn_w_vec_fp32 = _mm512_set1_ps(weight);
+    auto v_zp = _mm512_set1_ps(zp);
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        auto v_out = mm512_uni_loadu_ps(out + i);
+        auto v_value = _mm512_sub_ps(mm512_loadu_quant_ps<IS_U4>(v, i), v_zp);
+        v_out = _mm512_fmadd_ps(attn_w_vec_fp32, v_value, v_out);
+        _mm512_storeu_ps(out + i, v_out);
+    }
+#elif defined(HAVE_AVX2)
+    auto attn_w_vec_fp32 = _mm256_set1_ps(weight);
+    auto v_zp = _mm256_set1_ps(zp);
+    for (; i + 2 * vec_len_f32_avx2 <= n; i += 2 * vec_len_f32_avx2) {
+        __m256 v0, v1;
+        mm256_loadu_quant_ps<IS_U4>(v, i, v0, v1);
+        auto v0_out = mm256_uni_loadu_ps(out + i);
+        auto v1_out = mm256_uni_loadu_ps(out + i + vec_len_f32_avx2);
+        v0_out = _mm256_fmadd_ps(attn_w_vec_fp32, _mm256_sub_ps(v0, v_zp), v0_out);
+        v1_out = _mm256_fmadd_ps(attn_w_vec_fp32, _mm256_sub_ps(v1, v_zp), v1_out);
+        mm256_uni_storeu_ps(out + i, v0_out);
+        mm256_uni_storeu_ps(out + i + vec_len_f32_avx2, v1_out);
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] += weight * (quant_feature<IS_U4>(v, i) - zp);
+    }
+}
+
+template <typename TA, bool IS_U4>
+static void dot_product_block_grouped(TA* a, uint8_t* b, float* c, size_t n, size_t block_size, size_t groups) {
+    auto row_bytes = quant_row_bytes(n, groups, IS_U4 ? ov::element::u4 : ov::element::u8);
+    auto group_size = n / groups;
+    auto group_bytes = IS_U4 ? group_size / 2 : group_size;
+    for (size_t j = 0; j < block_size; j++) {
+        auto scale_zp = reinterpret_cast<float*>(b);
+        auto data = b + groups * sizeof(float) * 2;
+        float sum = 0.0f;
+        for (size_t g = 0; g < groups; g++) {
+            sum += dot_product_group<TA, IS_U4>(a + g * group_size, data + g * group_bytes, group_size,
+                                                scale_zp[2 * g], scale_zp[2 * g + 1]);
+        }
+        c[j] = sum;
+        b += row_bytes;
+    }
+}
+
+template <bool IS_U4>
+static void attn_acc_value_block_grouped(float* out, float* weight, uint8_t* v, size_t n, size_t block_size, size_t groups) {
+    auto row_bytes = quant_row_bytes(n, groups, IS_U4 ? ov::element::u4 : ov::element::u8);
+    auto group_size = n / groups;
+    auto group_bytes = IS_U4 ? group_size / 2 : group_size;
+    for (size_t j = 0; j < block_size; j++) {
+        auto scale_zp = reinterpret_cast<float*>(v);
+        auto data = v + groups * sizeof(float) * 2;
+        for (size_t g = 0; g < groups; g++) {
+            attn_acc_value_group<IS_U4>(out + g * group_size, weight[j], data + g * group_bytes, group_size,
+                                        scale_zp[2 * g], scale_zp[2 * g + 1]);
+        }
+        v += row_bytes;
+    }
+}
+
+// paged kv cache, the quantized rows may have several groups or be packed as u4
+template <typename TA, typename TB>
+static void dot_product_block(TA* a, TB* b, float* c, size_t n, size_t block_size, size_t groups, bool is_u4) {
+    dot_product_block(a, b, c, n, block_size);
+}
+
+template <typename TA>
+static void dot_product_block(TA* a, uint8_t* b, float* c, size_t n, size_t block_size, size_t groups, bool is_u4) {
+    if (is_u4) {
+        dot_product_block_grouped<TA, true>(a, b, c, n, block_size, groups);
+    } else if (groups > 1) {
+        dot_product_block_grouped<TA, false>(a, b, c, n, block_size, groups);
+    } else {
+        dot_product_block(a, b, c, n, block_size);
+    }
+}
+
+template <typename T>
+static void attn_acc_value_block(float* out, float* weight, T* v, size_t S, size_t block_size, size_t groups, bool is_u4) {
+    attn_acc_value_block(out, weight, v, S, block_size);
+}
+
+static void attn_acc_value_block(float* out, float* weight, uint8_t* v, size_t S, size_t block_size, size_t groups, bool is_u4) {
+    if (is_u4) {
+        attn_acc_value_block_grouped<true>(out, weight, v, S, block_size, groups);
+    } else if (groups > 1) {
+        attn_acc_value_block_grouped<false>(out, weight, v, S, block_size, groups);
+    } else {
+        attn_acc_value_block(out, weight, v, S, block_size);
+    }
+}
+
+// contiguous u8 kv cache, scale_zp keeps the (scale, zp) pair of each group and head_sum the sum of the query of each group
+template <typename TA, typename TB>
+static float dot_product_by_group(TA* a, TB* b, size_t n, size_t groups, float* scale_zp, float* head_sum) {
+    if (groups == 1) {
+        return dot_product(a, b, n, scale_zp, scale_zp + 1, head_sum);
+    }
+    auto group_size = n / groups;
+    float sum = 0.0f;
+    for (size_t g = 0; g < groups; g++) {
+        sum += dot_product(a + g * group_size, b + g * group_size, group_size, scale_zp + 2 * g, scale_zp + 2 * g + 1,
+                           head_sum + g);
+    }
+    return sum;
+}
+
+template <typename T>
+static void attn_acc_value_by_group(float* out, float weight, T* v, size_t S, size_t groups, float* scale_zp) {
+    if (groups == 1) {
+        attn_acc_value(out, weight, v, S, scale_zp, scale_zp + 1);
+        return;
+    }
+    auto group_size = S / groups;
+    for (size_t g = 0; g < groups; g++) {
+        attn_acc_value(out + g * group_size, weight, v + g * group_size, group_size, scale_zp + 2 * g, scale_zp + 2 * g + 1);
+    }
+}
+
 template<typename T>
 static void attn_reduce(T* dst, float* temp, size_t M, size_t S, size_t temp_stride) {
     size_t i = 0;
@@ -1103,8 +1312,10 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                              const ov::intel_cpu::PlainTensor& alibi_mask,
                              const ov::intel_cpu::PlainTensor& attention_mask,
                              const ov::intel_cpu::PlainTensor& beams,
+                             const ov::intel_cpu::PlainTensor& value_beams,
                              size_t max_context_len,
                              const ov::intel_cpu::PlainTensor& context_lens,
+                             const ov::intel_cpu::PlainTensor& query_lens,
                              ov::intel_cpu::PlainTensor& output_emb,
                              ov::intel_cpu::PlainTensor& buf_attn_w,
                              ov::intel_cpu::PlainTensor& buf_attn_score,
@@ -1120,6 +1331,8 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     auto H = query.size(1);
     auto q_len = query.size(2);
     auto S = query.size(3);
+    // the head size of the value may differ from the key one, the output keeps the value heads
+    auto SV = has_out_transpose ? output_emb.size(2) / H : output_emb.size(3);
     auto h_group_num = present_value.size(1);
     size_t h_each_group_len = 1;
     bool is_pagedattn = context_lens;
@@ -1136,6 +1349,20 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     } else {
         kv_len = present_key.size(2);
     }
+    // quantization groups of a token, the contiguous u8 kv cache keeps them in the scale_zp [B, H, L, 2 * groups],
+    //  the paged one in the token row
+    size_t key_groups = 1, value_groups = 1;
+    bool kv_is_u4 = present_value.get_precision() == ov::element::u4;
+    if (std::is_same<T2, uint8_t>::value) {
+        if (is_pagedattn) {
+            if (present_key)
+                key_groups = quant_row_groups(S, present_key.size(3), present_key.get_precision());
+            value_groups = quant_row_groups(SV, present_value.size(3), present_value.get_precision());
+        } else {
+            key_groups = past_k_scale_zp.size(3) / 2;
+            value_groups = past_v_scale_zp.size(3) / 2;
+        }
+    }
 
 #if defined(HAVE_AVX2) && !defined(HAVE_AVX512F)
     // avx2 will pre-compute the zero point and try to save the sub instruction in the dot_product,
@@ -1144,15 +1371,24 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     bool pastkv_is_int8 = past_k_scale_zp;
     if (pastkv_is_int8 && !is_pagedattn) {
         // be sure no false sharing
-        head_sum.resize<float>({B, H, q_len, 16});
+        head_sum.resize<float>({B, H, q_len, (key_groups + 15) / 16 * 16});
+        auto group_size = S / key_groups;
         parallel_for3d(B, H, q_len, [&](size_t b, size_t h, size_t pq) {
-            *head_sum.ptr<float>(b, h, pq) = sum_q_head(query.ptr<T>(b, h, pq), S);
+            for (size_t g = 0; g < key_groups; g++) {
+                head_sum.ptr<float>(b, h, pq)[g] = sum_q_head(query.ptr<T>(b, h, pq) + g * group_size, group_size);
+            }
         });
     }
 #endif
 
     // TODO: refactor to seperate files
     if (is_pagedattn) {
+        // key and value pages may be allocated independently, value falls back to the key block table otherwise
+        const auto& v_block_table = value_beams ? value_beams : beams;
+        // chunked prefill: sequence b has only query_lens[b] valid queries, the rest of q_len is padding
+        auto get_q_len = [&](size_t b) {
+            return query_lens ? static_cast<size_t>(query_lens.ptr<int32_t>()[b]) : q_len;
+        };
         // if present_key is true, it means q*k is already computed in the caller
         if (present_key) {
             if (B >= static_cast<size_t>(nthr)) {
@@ -1162,11 +1398,13 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                     auto pk = pk_in_blocks * block_size;
                     if (pk < context_len) {
                         auto block_number = beams.ptr<int32_t>(b)[pk_in_blocks];
+                        auto cur_q_len = get_q_len(b);
                         for (size_t h_group = 0; h_group < h_group_num; h_group++) {
-                            for (size_t pq = 0; pq < q_len; pq++) {
+                            for (size_t pq = 0; pq < cur_q_len; pq++) {
                                 for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                                     dot_product_block(query.ptr<T>(b, h, pq), present_key.ptr<T2>(block_number, h_group),
-                                        buf_attn_w.ptr<float>(b, h, pq) + pk, S, std::min(block_size, context_len - pk));
+                                        buf_attn_w.ptr<float>(b, h, pq) + pk, S, std::min(block_size, context_len - pk),
+                                        key_groups, kv_is_u4);
                                 }
                             }
                         }
@@ -1179,10 +1417,12 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                     auto pk = pk_in_blocks * block_size;
                     if (pk < context_len) {
                         auto block_number = beams.ptr<int32_t>(b)[pk_in_blocks];
-                        for (size_t pq = 0; pq < q_len; pq++) {
+                        auto cur_q_len = get_q_len(b);
+                        for (size_t pq = 0; pq < cur_q_len; pq++) {
                             for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                                 dot_product_block(query.ptr<T>(b, h, pq), present_key.ptr<T2>(block_number, h_group),
-                                    buf_attn_w.ptr<float>(b, h, pq) + pk, S, std::min(block_size, context_len - pk));
+                                    buf_attn_w.ptr<float>(b, h, pq) + pk, S, std::min(block_size, context_len - pk),
+                                    key_groups, kv_is_u4);
                             }
                         }
                     }
@@ -1192,7 +1432,11 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
 
         parallel_for3d_dynamic(B, H, q_len, [&](size_t b, size_t h, size_t pq) {
             auto cur_kv_len = static_cast<size_t>(context_lens.ptr<int32_t>()[b]);
-            auto ncausal = cur_kv_len;
+            auto cur_q_len = get_q_len(b);
+            if (pq >= cur_q_len)
+                return;
+            // the queries are the last cur_q_len tokens of the sequence
+            auto ncausal = auto_causal ? (cur_kv_len - cur_q_len + pq + 1) : cur_kv_len;
             // apply attention mask & sofmax
             float* alibi_ptr = alibi_mask ? &alibi_mask.at<float>({b, h, pq, 0}, true) : nullptr;
             uint8_t* attn_mask_ptr = nullptr;
@@ -1216,33 +1460,41 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
         // attn_w * V
         // there are enough works for each thread
         if (B >= static_cast<size_t>(nthr)) {
-            buf_attn_score.resize<float>({static_cast<size_t>(nthr), q_len, h_each_group_len, S});
+            buf_attn_score.resize<float>({static_cast<size_t>(nthr), q_len, h_each_group_len, SV});
             parallel_for2d_dynamic(B, h_group_num, [&](size_t b, size_t h_group) {
                 auto ithr = parallel_get_thread_num();
                 auto context_len = static_cast<size_t>(context_lens.ptr<int32_t>()[b]);
-                memset(buf_attn_score.ptr<float>(ithr), 0, q_len * h_each_group_len * S * sizeof(float));
+                auto cur_q_len = get_q_len(b);
+                memset(buf_attn_score.ptr<float>(ithr), 0, q_len * h_each_group_len * SV * sizeof(float));
                 for (size_t pv = 0; pv < context_len; pv += block_size) {
                     size_t pv_in_blocks = pv / block_size;
-                    auto block_number = beams.ptr<int32_t>(b)[pv_in_blocks];
+                    auto block_number = v_block_table.ptr<int32_t>(b)[pv_in_blocks];
                     auto* v = present_value.ptr<T2>(block_number, h_group);
-                    for (size_t pq = 0; pq < q_len; pq++) {
+                    for (size_t pq = 0; pq < cur_q_len; pq++) {
                         for (size_t h = h_group * h_each_group_len, group_idx = 0; h < (h_group + 1) * h_each_group_len; h++, group_idx++) {
                             attn_acc_value_block(buf_attn_score.ptr<float>(ithr, pq, group_idx),
                                                  buf_attn_w.ptr<float>(b, h, pq) + pv,
                                                  v,
-                                                 S,
-                                                 std::min(block_size, context_len - pv));
+                                                 SV,
+                                                 std::min(block_size, context_len - pv),
+                                                 value_groups,
+                                                 kv_is_u4);
                         }
                     }
                 }
-                // convert to dst
+                // convert to dst, the outputs of the padding queries are zeroed
                 for (size_t pq = 0; pq < q_len; pq++)
-                    for (size_t h = h_group * h_each_group_len, group_idx = 0; h < (h_group + 1) * h_each_group_len; h++, group_idx++)
-                        cvt_copy(output_emb.ptr<T>(b, pq, h * S), buf_attn_score.ptr<float>(ithr, pq, group_idx), S);
+                    for (size_t h = h_group * h_each_group_len, group_idx = 0; h < (h_group + 1) * h_each_group_len; h++, group_idx++) {
+                        auto* dst = has_out_transpose ? output_emb.ptr<T>(b, pq, h * SV) : output_emb.ptr<T>(b, h, pq);
+                        if (pq < cur_q_len)
+                            cvt_copy(dst, buf_attn_score.ptr<float>(ithr, pq, group_idx), SV);
+                        else
+                            std::memset(dst, 0, SV * sizeof(T));
+                    }
             });
             return;
         }
-        buf_attn_score.resize<float>({static_cast<size_t>(nthr), B, q_len, H, S});
+        buf_attn_score.resize<float>({static_cast<size_t>(nthr), B, q_len, H, SV});
         // buf_attn_w {B, H, q_len, kv_len}
         parallel_nt_static(nthr, [&](const size_t ithr, const size_t nthr) {
             memset(buf_attn_score.ptr<float>(ithr, 0, 0, 0, 0), 0, buf_attn_score.stride(0) * sizeof(float));
@@ -1255,15 +1507,18 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             auto pv = pv_in_blocks * block_size;
             // kv_len must be valid
             if (pv < context_len) {
-                auto block_number = beams.ptr<int32_t>(b)[pv_in_blocks];
+                auto block_number = v_block_table.ptr<int32_t>(b)[pv_in_blocks];
                 auto* v = present_value.ptr<T2>(block_number, h_group);
-                for (size_t pq = 0; pq < q_len; pq++) {
+                auto cur_q_len = get_q_len(b);
+                for (size_t pq = 0; pq < cur_q_len; pq++) {
                     for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                         attn_acc_value_block(buf_attn_score.ptr<float>(ithr, b, pq, h),
                                              buf_attn_w.ptr<float>(b, h, pq) + pv,
                                              v,
-                                             S,
-                                             std::min(block_size, context_len - pv));
+                                             SV,
+                                             std::min(block_size, context_len - pv),
+                                             value_groups,
+                                             kv_is_u4);
                     }
                 }
             }
@@ -1284,8 +1539,8 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                             auto p_k = present_key.ptr<T2>(0, h_group, pk);
                             prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
                             buf_attn_w.ptr<float>(0, h_group, 0)[pk] =
-                                    dot_product(query.ptr<T>(0, h_group), p_k,
-                                        S, p, p + 1, head_sum.ptr<float>(0, h_group));
+                                    dot_product_by_group(query.ptr<T>(0, h_group), p_k,
+                                        S, key_groups, p, head_sum.ptr<float>(0, h_group));
                             parallel_it_step(b, B, h_group, h_group_num, pk, kv_len);
                         }
                     } else {
@@ -1294,8 +1549,8 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                             auto p = past_k_scale_zp.ptr<float>(b_kv, h_group, pk);
                             auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
                             buf_attn_w.ptr<float>(b, h_group, 0)[pk] =
-                                    dot_product(query.ptr<T>(b, h_group), p_k,
-                                        S, p, p + 1, head_sum.ptr<float>(b, h_group));
+                                    dot_product_by_group(query.ptr<T>(b, h_group), p_k,
+                                        S, key_groups, p, head_sum.ptr<float>(b, h_group));
                             parallel_it_step(b, B, h_group, h_group_num, pk, kv_len);
                         }
                     }
@@ -1306,8 +1561,8 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                             auto p = past_k_scale_zp.ptr<float>(b_kv, h_group, pk);
                             for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                                 buf_attn_w.ptr<float>(b, h, pq)[pk] =
-                                        dot_product(query.ptr<T>(b, h, pq), present_key.ptr<T2>(b_kv, h_group, pk),
-                                            S, p, p + 1, head_sum.ptr<float>(b, h, pq));
+                                        dot_product_by_group(query.ptr<T>(b, h, pq), present_key.ptr<T2>(b_kv, h_group, pk),
+                                            S, key_groups, p, head_sum.ptr<float>(b, h, pq));
                             }
                         }
                         parallel_it_step(b, B, h_group, h_group_num, pk, kv_len);
@@ -1338,7 +1593,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                                 ov::element::f32);
         });
         // attn_w * V
-        buf_attn_score.resize<float>({static_cast<size_t>(nthr), B, q_len, H, S});
+        buf_attn_score.resize<float>({static_cast<size_t>(nthr), B, q_len, H, SV});
         // buf_attn_w {B, H, q_len, kv_len}
         parallel_nt_static(nthr, [&](const size_t ithr, const size_t nthr) {
             size_t start{0}, end{0};
@@ -1354,12 +1609,12 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                         auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
                         auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
                         auto p = past_v_scale_zp.ptr<float>(b_kv, h_group, pv);
-                        attn_acc_value(buf_attn_score.ptr<float>(ithr, b, 0, h_group),
+                        attn_acc_value_by_group(buf_attn_score.ptr<float>(ithr, b, 0, h_group),
                                     buf_attn_w.ptr<float>(b, h_group, 0, pv)[0],
                                     v,
-                                    S,
-                                    p + 0,
-                                    p + 1);
+                                    SV,
+                                    value_groups,
+                                    p);
                         parallel_it_step(b, B, h_group, h_group_num, pv, kv_len);
                     }
                 } else {
@@ -1369,12 +1624,12 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                         auto p = past_v_scale_zp.ptr<float>(b_kv, h_group, pv);
                         for (size_t pq = 0; pq < q_len; pq++) {
                             for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
-                                attn_acc_value(buf_attn_score.ptr<float>(ithr, b, pq, h),
+                                attn_acc_value_by_group(buf_attn_score.ptr<float>(ithr, b, pq, h),
                                             buf_attn_w.ptr<float>(b, h, pq)[pv],
                                             v,
-                                            S,
-                                            p + 0,
-                                            p + 1);
+                                            SV,
+                                            value_groups,
+                                            p);
                             }
                         }
                         parallel_it_step(b, B, h_group, h_group_num, pv, kv_len);
@@ -1387,8 +1642,13 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     parallel_for3d(B, H, q_len, [&](size_t b, size_t h, size_t pq) {
         auto* temp = buf_attn_score.ptr<float>(0, b, pq, h);
         size_t temp_stride = buf_attn_score.stride(0);
-        auto* dst = has_out_transpose ? output_emb.ptr<T>(b, pq, h * S) : output_emb.ptr<T>(b, h, pq);
-        attn_reduce(dst, temp, nthr, S, temp_stride);
+        auto* dst = has_out_transpose ? output_emb.ptr<T>(b, pq, h * SV) : output_emb.ptr<T>(b, h, pq);
+        // chunked prefill: the outputs of the padding queries are zeroed
+        if (query_lens && pq >= static_cast<size_t>(query_lens.ptr<int32_t>()[b])) {
+            std::memset(dst, 0, SV * sizeof(T));
+            return;
+        }
+        attn_reduce(dst, temp, nthr, SV, temp_stride);
     });
 }
 
@@ -1398,8 +1658,10 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                       const ov::intel_cpu::PlainTensor& alibi_mask,
                       const ov::intel_cpu::PlainTensor& attention_mask,
                       const ov::intel_cpu::PlainTensor& beams,
+                      const ov::intel_cpu::PlainTensor& value_beams,
                       size_t max_context_len,
                       const ov::intel_cpu::PlainTensor& context_lens,
+                      const ov::intel_cpu::PlainTensor& query_lens,
                       ov::intel_cpu::PlainTensor& output_emb,
                       ov::intel_cpu::PlainTensor& buf_attn_w,
                       ov::intel_cpu::PlainTensor& buf_attn_score,
@@ -1409,16 +1671,20 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                       const ov::intel_cpu::PlainTensor& past_k_scale_zp,
                       const ov::intel_cpu::PlainTensor& past_v_scale_zp,
                       ov::intel_cpu::PlainTensor& head_sum) {
+    // the paged u4 kv cache is packed into bytes
+    auto is_quantized = present_value.get_precision() == ov::element::u8 || present_value.get_precision() == ov::element::u4;
     if (query.get_precision() == ov::element::bf16) {
-        if (present_key.get_precision() == ov::element::u8) {
+        if (is_quantized) {
             mha_single_token_kernel<ov::bfloat16, uint8_t>(query,
                                                            present_key,
                                                            present_value,
                                                            alibi_mask,
                                                            attention_mask,
                                                            beams,
+                                                           value_beams,
                                                            max_context_len,
                                                            context_lens,
+                                                           query_lens,
                                                            output_emb,
                                                            buf_attn_w,
                                                            buf_attn_score,
@@ -1435,8 +1701,10 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                                 alibi_mask,
                                                                 attention_mask,
                                                                 beams,
+                                                                value_beams,
                                                                 max_context_len,
                                                                 context_lens,
+                                                                query_lens,
                                                                 output_emb,
                                                                 buf_attn_w,
                                                                 buf_attn_score,
@@ -1448,15 +1716,17 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                                 head_sum);
         }
     } else if (query.get_precision() == ov::element::f32) {
-        if (present_key.get_precision() == ov::element::u8) {
+        if (is_quantized) {
             mha_single_token_kernel<float, uint8_t>(query,
                                                     present_key,
                                                     present_value,
                                                     alibi_mask,
                                                     attention_mask,
                                                     beams,
+                                                    value_beams,
                                                     max_context_len,
                                                     context_lens,
+                                                    query_lens,
                                                     output_emb,
                                                     buf_attn_w,
                                                     buf_attn_score,
@@ -1473,8 +1743,10 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                         alibi_mask,
                                                         attention_mask,
                                                         beams,
+                                                        value_beams,
                                                         max_context_len,
                                                         context_lens,
+                                                        query_lens,
                                                         output_emb,
                                                         buf_attn_w,
                                                         buf_attn_score,
@@ -1491,8 +1763,10 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                 alibi_mask,
                                                 attention_mask,
                                                 beams,
+                                                value_beams,
                                                 max_context_len,
                                                 context_lens,
+                                                query_lens,
                                                 output_emb,
                                                 buf_attn_w,
                                                 buf_attn_score,
@@ -21,8 +21,10 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                       const ov::intel_cpu::PlainTensor& alibi_mask,
                       const ov::intel_cpu::PlainTensor& attention_mask,
                       const ov::intel_cpu::PlainTensor& beams,
+                      const ov::intel_cpu::PlainTensor& value_beams,
                       size_t max_context_len,
                       const ov::intel_cpu::PlainTensor& context_lens,
+                      const ov::intel_cpu::PlainTensor& query_lens,
                       ov::intel_cpu::PlainTensor& output_emb,
                       ov::intel_cpu::PlainTensor& buf_attn_w,
                       ov::intel_cpu::PlainTensor& buf_attn_score,
@@ -8,10 +8,12 @@
 #include "cpu_types.h"
 #include "eltwise.h"
 
+#include <functional>
 #include <numeric>
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include "common/cpu_memcpy.h"
 #include "openvino/opsets/opset1.hpp"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -22,6 +24,8 @@
 #include "common/primitive_hashing_utils.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "shape_inference/custom/matmul.hpp"
+#include "nodes/kernels/dyn_quant/dyn_quant.hpp"
+#include "openvino/core/parallel.hpp"
 using namespace dnnl;
 
 
@@ -77,6 +81,39 @@ bool MatMulKey::operator==(const MatMulKey &rhs) const {
              implType == rhs.implType;
     return retVal;
 }
+
+std::shared_ptr<DnnlExecutor> createExecutor(const dnnl::engine& engine, const MatMulKey& key) {
+    dnnl::matmul::primitive_desc prim_desc;
+
+    if (key.bias) {
+        prim_desc = matmul::primitive_desc(
+            engine,
+            key.inp0->getDnnlDesc(),
+            key.inp1->getDnnlDesc(),
+            key.bias->getDnnlDesc(),
+            key.out->getDnnlDesc(),
+            key.attr);
+    } else {
+        prim_desc = matmul::primitive_desc(
+            engine,
+            key.inp0->getDnnlDesc(),
+            key.inp1->getDnnlDesc(),
+            key.out->getDnnlDesc(),
+            key.attr);
+    }
+
+    auto first_desc = dnnl::matmul::primitive_desc(prim_desc.get());
+    const bool found = DnnlExtensionUtils::find_implementation(prim_desc, key.implType);
+
+    if (found)
+        return std::make_shared<DnnlExecutor>(prim_desc);
+
+    // In case of dynamic shapes an implementation type chosen as optimal for a primitive_desc with
+    // undefined input shapes, is not necessarily available for the primitive_desc with defined shape.
+    // Example: brgemm_avx512_amx (Intel Sapphire Rapids Platform) is available for a primitive with
+    // undefined input shapes but not available for primitive_desc with input batch 1.
+    return std::make_shared<DnnlExecutor>(first_desc);
+}
 } // namespace
 
 bool MatMul::canBeExecutedInInt8() const {
@@ -520,6 +557,9 @@ bool MatMul::created() const {
 }
 
 ov::element::Type MatMul::getRuntimePrecision() const {
+    // the inputs quantized at runtime are multiplied by the int8 matmul
+    if (dynQuant)
+        return ov::element::u8;
     return getMaxPrecision(getInputPrecisions());
 }
 
@@ -536,6 +576,12 @@ void MatMul::prepareParams() {
     if (selected_pd == nullptr)
         OPENVINO_THROW(errorPrefix, " did not set preferable primitive descriptor");
 
+    if (canUseDynamicQuantization(src0MemPtr->getStaticDims())) {
+        prepareDynamicQuantization();
+        return;
+    }
+    dynQuant.reset();
+
     DnnlMemoryDescPtr src0TransposedDesc;
     DnnlMemoryDescPtr src1TransposedDesc;
 
@@ -576,39 +622,10 @@ void MatMul::prepareParams() {
     auto engine = getEngine();
 
     auto builder = [&engine](const MatMulKey& key) -> executorPtr {
-        dnnl::matmul::primitive_desc prim_desc;
-
-        if (key.bias) {
-            prim_desc = matmul::primitive_desc(
-                engine,
-                key.inp0->getDnnlDesc(),
-                key.inp1->getDnnlDesc(),
-                key.bias->getDnnlDesc(),
-                key.out->getDnnlDesc(),
-                key.attr);
-        } else {
-            prim_desc = matmul::primitive_desc(
-                engine,
-                key.inp0->getDnnlDesc(),
-                key.inp1->getDnnlDesc(),
-                key.out->getDnnlDesc(),
-                key.attr);
-        }
-
-        auto first_desc = dnnl::matmul::primitive_desc(prim_desc.get());
-        const bool found = DnnlExtensionUtils::find_implementation(prim_desc, key.implType);
-
-        if (found)
-            return std::make_shared<DnnlExecutor>(prim_desc);
-
-        // In case of dynamic shapes an implementation type chosen as optimal for a primitive_desc with
-        // undefined input shapes, is not necessarily available for the primitive_desc with defined shape.
-        // Example: brgemm_avx512_amx (Intel Sapphire Rapids Platform) is available for a primitive with
-        // undefined input shapes but not available for primitive_desc with input batch 1.
-        return std::make_shared<DnnlExecutor>(first_desc);
+        return createExecutor(engine, key);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -634,14 +651,169 @@ void MatMul::prepareParams() {
 #endif
 }
 
+bool MatMul::canUseDynamicQuantization(const VectorDims& src0Dims) const {
+    // The rows are quantized as a whole, so the product is a single int8 matmul dequantized by one pass over the
+    // output. The finer groups along K would need a matmul and a dequantization pass per group, which costs more
+    // than the int8 products save, so the f32 matmul is kept for the group size smaller than K.
+    const auto groupSize = context->getConfig().fcDynamicQuantizationGroupSize;
+    if (groupSize == 0 || src0Dims.back() == 0 || groupSize < src0Dims.back())
+        return false;
+
+    // The u8 x i8 products are accumulated without saturation only by the VNNI instructions. The quantization
+    // kernels are x64 only: on aarch64 the int8 oneDNN matmul with the per row scales of both inputs is not backed
+    // by the i8mm ACL GEMM, so the f32 matmul is kept there.
+    if (!impl::cpu::x64::mayiuse(impl::cpu::x64::avx2_vnni) &&
+        !impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core_vnni))
+        return false;
+
+    // activation x activation products only, a constant input is handled as the weights by oneDNN
+    if (getParentEdgeAt(0)->getParent()->isConstant() || getParentEdgeAt(1)->getParent()->isConstant())
+        return false;
+
+    if (withBiases || !fusedWith.empty() || transposeIn[0])
+        return false;
+
+    const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+    return config.inConfs[0].getMemDesc()->getPrecision() == ov::element::f32 &&
+           config.inConfs[1].getMemDesc()->getPrecision() == ov::element::f32 &&
+           config.outConfs[0].getMemDesc()->getPrecision() == ov::element::f32;
+}
+
+void MatMul::prepareDynamicQuantization() {
+    const auto& src0Dims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& src1Dims = getSrcMemoryAtPort(1)->getStaticDims();
+    const auto& dstDims = getDstMemoryAtPort(0)->getStaticDims();
+    const size_t rank = dstDims.size();
+
+    auto dq = make_unique<DynamicQuantization>();
+    dq->M = dstDims[rank - 2];
+    dq->N = dstDims[rank - 1];
+    dq->K = src0Dims[rank - 1];
+
+    auto batches = [rank](const VectorDims& dims) {
+        return std::accumulate(dims.begin(), dims.begin() + rank - 2, size_t{1}, std::multiplies<size_t>());
+    };
+    const size_t batchesA = batches(src0Dims);
+    dq->batchesB = batches(src1Dims);
+    dq->batchesOut = batches(dstDims);
+    dq->rowsA = batchesA * dq->M;
+    dq->rowsB = dq->batchesB * dq->N;
+
+    dq->batchIdxA.resize(dq->batchesOut);
+    dq->batchIdxB.resize(dq->batchesOut);
+    for (size_t b = 0; b < dq->batchesOut; b++) {
+        size_t rest = b, idxA = 0, idxB = 0, strideA = 1, strideB = 1;
+        for (size_t i = rank - 2; i-- > 0;) {
+            const size_t idx = rest % dstDims[i];
+            rest /= dstDims[i];
+            if (src0Dims[i] != 1)
+                idxA += idx * strideA;
+            if (src1Dims[i] != 1)
+                idxB += idx * strideB;
+            strideA *= src0Dims[i];
+            strideB *= src1Dims[i];
+        }
+        dq->batchIdxA[b] = idxA;
+        dq->batchIdxB[b] = idxB;
+    }
+
+    // the quantized inputs keep the layout of the f32 ones, the i32 accumulator is written in place of the output
+    dq->srcDesc = std::make_shared<DnnlBlockedMemoryDesc>(ov::element::u8, Shape(src0Dims));
+    Shape weiShape(src1Dims);
+    const auto weiStrides = getStridesAndModifyShape(weiShape, transposeIn[1]);
+    dq->weiDesc = std::make_shared<DnnlBlockedMemoryDesc>(ov::element::i8, weiShape, weiStrides);
+    dq->accDesc = std::make_shared<DnnlBlockedMemoryDesc>(ov::element::i32, Shape(dstDims));
+
+    auto attr = dnnl::primitive_attr();
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    MatMulKey key = {dq->srcDesc, dq->weiDesc, nullptr, dq->accDesc, attr,
+                     getSelectedPrimitiveDescriptor()->getImplementationType()};
+    auto engine = getEngine();
+    auto result = context->getSharedParamsCache()->getOrCreate(key, [&engine](const MatMulKey& key) {
+        return createExecutor(engine, key);
+    });
+    dq->exec = result.first;
+    if (!dq->exec)
+        OPENVINO_THROW("Primitive descriptor was not found for node ", getName(), ".");
+    dq->scratchpad = getScratchPadMem(dq->exec->getScratchPadDesc());
+
+    const size_t alignment = 64;
+    dq->sizeA = rnd_up(dq->rowsA * dq->K, alignment);
+    const size_t bufferSize = dq->sizeA + dq->rowsB * dq->K;
+    dq->buffer = std::make_shared<Memory>(getEngine(),
+                                          std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, Shape{bufferSize}));
+    dq->paramsA.resize(dq->rowsA * 2);
+    dq->scalesB.resize(dq->rowsB);
+    dq->sumsB.resize(dq->rowsB);
+
+    execPtr = nullptr;
+    dynQuant = std::move(dq);
+}
+
+void MatMul::executeDynamicQuantization(dnnl::stream strm) {
+    using namespace ov::Extensions::Cpu::XARCH;
+    auto& dq = *dynQuant;
+    const auto* src0 = getSrcDataAtPortAs<const float>(0);
+    const auto* src1 = getSrcDataAtPortAs<const float>(1);
+    auto* dst = getDstDataAtPortAs<float>(0);
+    auto* quantA = dq.buffer->getDataAs<uint8_t>();
+    auto* quantB = reinterpret_cast<int8_t*>(quantA + dq.sizeA);
+    auto* acc = reinterpret_cast<int32_t*>(dst);
+    const size_t M = dq.M, N = dq.N, K = dq.K;
+
+    parallel_for(dq.rowsA, [&](size_t r) {
+        dyn_quant_u8(src0 + r * K, quantA + r * K, K, dq.paramsA[r * 2], dq.paramsA[r * 2 + 1]);
+    });
+
+    if (transposeIn[1]) {
+        parallel_for(dq.rowsB, [&](size_t r) {
+            dyn_quant_i8(src1 + r * K, quantB + r * K, K, dq.scalesB[r], dq.sumsB[r]);
+        });
+    } else {
+        // the columns are quantized by the blocks to keep the threads busy for a single batch
+        const size_t colsBlk = 64;
+        parallel_for2d(dq.batchesB, div_up(N, colsBlk), [&](size_t b, size_t nb) {
+            const size_t n0 = nb * colsBlk;
+            const size_t idx = b * N + n0;
+            dyn_quant_cols_i8(src1 + b * K * N + n0, N, quantB + b * K * N + n0, N,
+                              K, std::min(colsBlk, N - n0), &dq.scalesB[idx], &dq.sumsB[idx]);
+        });
+    }
+
+    const auto& engine = getEngine();
+    std::unordered_map<int, dnnl::memory> args{
+        {DNNL_ARG_SRC_0, dnnl::memory(dq.srcDesc->getDnnlDesc(), engine, quantA)},
+        {DNNL_ARG_WEIGHTS_0, dnnl::memory(dq.weiDesc->getDnnlDesc(), engine, quantB)},
+        {DNNL_ARG_DST, dnnl::memory(dq.accDesc->getDnnlDesc(), engine, acc)},
+        {DNNL_ARG_SCRATCHPAD, dq.scratchpad->getPrimitive()}};
+    dq.exec->exec(args, strm);
+
+    parallel_for2d(dq.batchesOut, M, [&](size_t b, size_t m) {
+        const auto params = &dq.paramsA[(dq.batchIdxA[b] * M + m) * 2];
+        const size_t idxB = dq.batchIdxB[b] * N;
+        const size_t offset = (b * M + m) * N;
+        dyn_quant_dequant(acc + offset, dst + offset, N, params[0], params[1], &dq.scalesB[idxB], &dq.sumsB[idxB]);
+    });
+}
+
 void MatMul::execute(dnnl::stream strm) {
-    if (execPtr) {
+    if (dynQuant) {
+        executeDynamicQuantization(strm);
+    } else if (execPtr) {
         execPtr->exec(primArgs, strm);
     } else {
         OPENVINO_THROW(errorPrefix, " doesn't have an initialized executor");
     }
 }
 
+dnnl::primitive MatMul::getReplayablePrimitive() const {
+    if (dynQuant)
+        return {};
+    if (execPtr && !execPtr->needReordering())
+        return execPtr->getExecPrim();
+    return {};
+}
+
 void MatMul::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
@@ -9,6 +9,8 @@
 #include "node.h"
 
 #include <array>
+#include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -37,6 +39,7 @@ public:
 
     void prepareParams() override;
     void execute(dnnl::stream strm) override;
+    dnnl::primitive getReplayablePrimitive() const override;
     void executeDynamicImpl(dnnl::stream strm) override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
@@ -65,6 +68,37 @@ private:
 
     std::array<DnnlBlockedMemoryDescPtr, 2> inDataDesc;
     DnnlBlockedMemoryDescPtr outDataDesc;
+
+    bool canUseDynamicQuantization(const VectorDims& src0Dims) const;
+    void prepareDynamicQuantization();
+    void executeDynamicQuantization(dnnl::stream strm);
+
+    // Both f32 activations are quantized at runtime by the whole rows along K: the first input to u8 with a zero point,
+    // the second one to i8. The product is computed by the int8 oneDNN matmul and dequantized in place of the output.
+    struct DynamicQuantization {
+        size_t M = 0;
+        size_t N = 0;
+        size_t K = 0;
+        size_t rowsA = 0;      // rows of all the batches of the first input
+        size_t rowsB = 0;      // columns of all the batches of the second input
+        size_t batchesB = 0;
+        size_t batchesOut = 0;
+        size_t sizeA = 0;      // bytes of the quantized first input
+        // the batch of the inputs used by the output batch (the broadcasted batch dimensions)
+        std::vector<size_t> batchIdxA;
+        std::vector<size_t> batchIdxB;
+        DnnlMemoryDescPtr srcDesc;
+        DnnlMemoryDescPtr weiDesc;
+        DnnlMemoryDescPtr accDesc;
+        // [rowsA] scales and zero points of the first input, [rowsB] scales and sums of the second one
+        std::vector<float> paramsA;
+        std::vector<float> scalesB;
+        std::vector<int32_t> sumsB;
+        MemoryPtr buffer;
+        MemoryPtr scratchpad;
+        executorPtr exec;
+    };
+    std::unique_ptr<DynamicQuantization> dynQuant;
 };
 
 }   // namespace node
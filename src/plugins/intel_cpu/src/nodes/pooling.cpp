@@ -466,7 +466,7 @@ void Pooling::prepareParams() {
             return std::make_shared<DnnlExecutor>(first_desc);
         };
 
-        auto cache = context->getParamsCache();
+        auto cache = context->getSharedParamsCache();
         auto result = cache->getOrCreate(key, builder);
 
         dnnlExecPtr = result.first;
@@ -510,6 +510,12 @@ void Pooling::execute(dnnl::stream strm) {
     }
 }
 
+dnnl::primitive Pooling::getReplayablePrimitive() const {
+    if (dnnlExecPtr && !dnnlExecPtr->needReordering())
+        return dnnlExecPtr->getExecPrim();
+    return {};
+}
+
 void Pooling::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
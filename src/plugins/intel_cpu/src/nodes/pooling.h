@@ -30,6 +30,7 @@ public:
 
     void prepareParams() override;
     void execute(dnnl::stream strm) override;
+    dnnl::primitive getReplayablePrimitive() const override;
     void executeDynamicImpl(dnnl::stream strm) override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
@@ -304,7 +304,7 @@ void Reorder::createReorderPrimitive(const dnnl::memory::desc& srcDesc,
         src_desc = src_blocked->getPrimitive().get_desc();
     }
 
-    auto result = getReorderPrim(context->getParamsCache(), getEngine(), src_desc, dst_desc);
+    auto result = getReorderPrim(context->getSharedParamsCache(), getEngine(), src_desc, dst_desc);
     if (!result) {
         DEBUG_LOG("src desc: ", src_desc, " dst_desc: ", dst_desc);
         THROW_CPU_NODE_ERR("could not create reorder primitive: unsupported reorder case.");
@@ -429,6 +429,16 @@ void Reorder::execute(dnnl::stream strm) {
     }
 }
 
+dnnl::primitive Reorder::getReplayablePrimitive() const {
+#if defined(OPENVINO_ARCH_ARM) || defined(OPENVINO_ARCH_ARM64)
+    if (transposeExecutor)
+        return {};
+#endif
+    if (isOptimized || canUseNspc2Ncsp || canUseNcsp2Nspc)
+        return {};
+    return prim;
+}
+
 std::string Reorder::getReorderArgs(const MemoryDesc &parentDesc, const MemoryDesc &childDesc) {
     std::string inArgs, outArgs;
     if (parentDesc.getPrecision() != childDesc.getPrecision()) {
@@ -20,6 +20,7 @@ public:
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
     void execute(dnnl::stream strm) override;
+    dnnl::primitive getReplayablePrimitive() const override;
     bool created() const override;
     const std::vector<impl_desc_type>& getDefaultImplPriority() override;
 
@@ -883,8 +883,10 @@ struct MHASingleToken {
                     const PlainTensor& attention_mask,
                     PlainTensor& output_emb,
                     const PlainTensor& beams,
+                    const PlainTensor& value_beams,
                     size_t max_context_len,
                     const PlainTensor& context_lens,
+                    const PlainTensor& query_lens,
                     bool has_out_transpose,
                     bool auto_causal,
                     float d_scale,
@@ -929,8 +931,9 @@ struct MHASingleToken {
                         if (pk < context_len) {
                             m_gemv->tile_config();
                             auto block_number = beams.ptr<int32_t>(b)[pk_in_blocks];
+                            auto cur_q_len = query_lens ? static_cast<size_t>(query_lens.ptr<int32_t>()[b]) : q_len;
                             for (size_t h_group = 0; h_group < h_group_num; h_group++) {
-                                for (size_t pq = 0; pq < q_len; pq++) {
+                                for (size_t pq = 0; pq < cur_q_len; pq++) {
                                     for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                                         (*m_gemv)(query.ptr<ov::bfloat16>(b, h, pq), present_key.ptr<ov::bfloat16>(block_number, h_group),
                                             m_attn_w.ptr<float>(b, h, pq) + pk);
@@ -948,8 +951,8 @@ struct MHASingleToken {
                         if (pk < context_len) {
                             m_gemv->tile_config();
                             auto block_number = beams.ptr<int32_t>(b)[pk_in_blocks];
-
-                            for (size_t pq = 0; pq < q_len; pq++) {
+                            auto cur_q_len = query_lens ? static_cast<size_t>(query_lens.ptr<int32_t>()[b]) : q_len;
+                            for (size_t pq = 0; pq < cur_q_len; pq++) {
                                 for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                                     (*m_gemv)(query.ptr<ov::bfloat16>(b, h, pq), present_key.ptr<ov::bfloat16>(block_number, h_group),
                                         m_attn_w.ptr<float>(b, h, pq) + pk);
@@ -966,8 +969,8 @@ struct MHASingleToken {
             // aligned to cache line (64bytes=16*sizeof(float)) to avoid false sharing
             m_attn_w.resize<float>({B, H, q_len, (kv_len + 15) / 16 * 16});
         }
-        mha_single_token(query, fastpath_valid ? PlainTensor() : present_key, present_value, alibi_mask, attention_mask, beams, max_context_len,
-            context_lens, output_emb, m_attn_w, m_temp, has_out_transpose, auto_causal, d_scale, k_scale_zp, v_scale_zp, m_head_sum);
+        mha_single_token(query, fastpath_valid ? PlainTensor() : present_key, present_value, alibi_mask, attention_mask, beams, value_beams,
+            max_context_len, context_lens, query_lens, output_emb, m_attn_w, m_temp, has_out_transpose, auto_causal, d_scale, k_scale_zp, v_scale_zp, m_head_sum);
     }
 };
 
@@ -978,9 +981,58 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
 
     MHAKernel<KType, T> kernel;
     MHASingleToken kernel_single_token;
+    // 1-token kernels of the heads shards in the tensor parallel mode, one per socket
+    std::vector<MHASingleToken> kernel_single_token_shards;
 
     AttentionExecutor(GraphContext::CPtr ctx) : context(ctx), kernel(context) {}
 
+    // Tensor parallel decoding: the kv heads are split across the sockets, so each socket reads only its part of the
+    //  kv cache. The heads write their outputs in place, thus no gather is required after the shards are done.
+    bool execute_single_token_sharded(PlainTensor& q_input,
+                                      PlainTensor& present_key,
+                                      PlainTensor& present_value,
+                                      const PlainTensor& attn_mask,
+                                      PlainTensor& output_emb,
+                                      const PlainTensor& beam_table,
+                                      bool has_out_transpose,
+                                      bool auto_causal,
+                                      float scale_input,
+                                      const PlainTensor& k_scale_zp,
+                                      const PlainTensor& v_scale_zp) {
+        const auto shards = static_cast<size_t>(context->getNumSubStreamSockets());
+        if (shards <= 1)
+            return false;
+        const auto H = q_input.size(1);
+        const auto Hk = present_key.size(1);
+        const auto S = q_input.size(3);
+        // u4 cache packs two elements in a byte, so the heads views can't be addressed
+        if (Hk < shards || H % Hk != 0 || present_key.get_precision() == ov::element::u4 ||
+            present_value.get_precision() == ov::element::u4)
+            return false;
+        if (attn_mask && attn_mask.size(1) != 1 && attn_mask.size(1) != H)
+            return false;
+
+        const auto group = H / Hk;
+        kernel_single_token_shards.resize(shards);
+        context->parallelOnNumaNodes(shards, [&](int, size_t shard) {
+            size_t hk0, hk1;
+            splitter(Hk, shards, shard, hk0, hk1);
+            const auto h0 = static_cast<int>(hk0 * group);
+            const auto h1 = static_cast<int>(hk1 * group);
+            auto query = q_input.slice(1, h0, h1);
+            auto key = present_key.slice(1, static_cast<int>(hk0), static_cast<int>(hk1));
+            auto value = present_value.slice(1, static_cast<int>(hk0), static_cast<int>(hk1));
+            auto mask = attn_mask && attn_mask.size(1) == H ? attn_mask.slice(1, h0, h1) : attn_mask;
+            auto output = has_out_transpose ? output_emb.slice(2, h0 * static_cast<int>(S), h1 * static_cast<int>(S))
+                                            : output_emb.slice(1, h0, h1);
+            auto k_zp = k_scale_zp ? k_scale_zp.slice(1, static_cast<int>(hk0), static_cast<int>(hk1)) : PlainTensor();
+            auto v_zp = v_scale_zp ? v_scale_zp.slice(1, static_cast<int>(hk0), static_cast<int>(hk1)) : PlainTensor();
+            kernel_single_token_shards[shard](query, key, value, {}, mask, output, beam_table, {}, 0, {}, {},
+                                              has_out_transpose, auto_causal, scale_input, k_zp, v_zp);
+        });
+        return true;
+    }
+
     void prepare_attn_mask(MemoryPtr attn_input) {
         attn_buf.resize<float>(attn_input->getStaticDims());
         auto p = attn_input->getDataAs<uint8_t>();
@@ -990,12 +1042,14 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
 
     void execute(dnnl::stream strm, const Config& config, const std::vector<MemoryPtr>& inputs, const MemoryPtr output,
                  const MemoryPtr presentk_input, const MemoryPtr presentv_input, const MemoryPtr beam_input,
-                 const PlainTensor& k_scale_zp, const PlainTensor& v_scale_zp) override {
+                 const PlainTensor& k_scale_zp, const PlainTensor& v_scale_zp, const PagedKVCache& paged_kv) override {
         bool has_out_transpose = config.config.output_BLHxS;
         bool fuse_causal_attn = config.config.fuse_causal_attn;
         bool is_causal = config.config.is_causal;
         bool fuse_concat = config.config.fuse_concat;
         bool is_pagedattn = config.is_pageattn;
+        // stateful model whose kv cache is kept in the pages of the compiled model pool
+        bool is_paged_kv = static_cast<bool>(paged_kv.context_lens);
         auto input_num = inputs.size();
         bool is_prompt = false;
         PlainTensor present_key, present_value;
@@ -1003,7 +1057,9 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
         PlainTensor k_input;           // f32[B, H|1, L1, S] / [B, H|1, L0+L1, S]
         PlainTensor v_input;           // f32[B, H|1, L1, S] / [B, H|1, L0+L1, S]
         PlainTensor beam_table;        // i32[B, max_kvLen]
+        PlainTensor value_block_table; // i32[B, max_blocks]
         PlainTensor context_lens;
+        PlainTensor query_lens;        // i32[B], valid queries of each sequence in a chunked prefill step
         PlainTensor attn_mask;
         PlainTensor output_emb(output);
         float scale_input = 0.0f;
@@ -1047,6 +1103,28 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             if (!is_prompt) {
                 context_lens.assert_dims({B});
                 beam_table.assert_dims({B, 0}, true);
+                if (L1 > 1) {
+                    // Chunked prefill: a chunk of the prompt attends to the prefix cached in the blocks while the decoding
+                    //  sequences of the same step carry one token. The queries of the sequence b are the first n_b tokens,
+                    //  the rest is padding marked by negative slots, so the causal mask is built per sequence.
+                    PlainTensor slot_mapping(inputs[ID_SLOT_MAPPING]);
+                    query_lens.resize<int32_t>({B});
+                    for (size_t b = 0; b < B; b++) {
+                        auto slots = slot_mapping.ptr<int32_t>(b);
+                        auto padding = std::find_if(slots, slots + L1, [](int32_t slot) {
+                            return slot < 0;
+                        });
+                        OPENVINO_ASSERT(std::all_of(padding, slots + L1, [](int32_t slot) {
+                                            return slot < 0;
+                                        }),
+                                        "PagedAttention: padding of the sequence ", b, " must follow its queries");
+                        auto n = static_cast<int32_t>(padding - slots);
+                        OPENVINO_ASSERT(n <= context_lens.ptr<int32_t>()[b],
+                                        "PagedAttention: query length ", n, " exceeds context length ",
+                                        context_lens.ptr<int32_t>()[b], " of sequence ", b);
+                        query_lens.ptr<int32_t>()[b] = n;
+                    }
+                }
             } else {
                 sliding_window = static_cast<size_t>(*inputs[ID_SLIDING_WINDOW]->getDataAs<int32_t>());
             }
@@ -1078,15 +1156,30 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
                 q_input = q_input.permute(permute_axes);
                 k_input = k_input.permute(permute_axes);
                 v_input = v_input.permute(permute_axes);
-                present_key = present_key.permute(permute_axes);
-                present_value = present_value.permute(permute_axes);
+                if (!is_paged_kv) {
+                    present_key = present_key.permute(permute_axes);
+                    present_value = present_value.permute(permute_axes);
+                }
             }
             B = q_input.size(0);
             L1 = q_input.size(2);
             S = q_input.size(3);
-            L0 = present_key.size(2) - L1;
             auto Hk = k_input.size(1);
 
+            if (is_paged_kv) {
+                // k/v cache: [NUM_PAGES, Hk, page_tokens, S], all the sequences share the same length
+                context_lens = paged_kv.context_lens;
+                beam_table = paged_kv.key_block_table;
+                value_block_table = paged_kv.value_block_table;
+                max_context_len = static_cast<size_t>(context_lens.ptr<int32_t>()[0]);
+                L0 = max_context_len - L1;
+                context_lens.assert_dims({B});
+                beam_table.assert_dims({B, 0}, true);
+                present_key.assert_dims({0, Hk, 0, 0}, true);
+            } else {
+                L0 = present_key.size(2) - L1;
+            }
+
             if (fuse_concat) {
                 k_input.assert_dims({B, Hk, L1, S});
                 v_input.assert_dims({B, Hk, L1, S});
@@ -1094,10 +1187,12 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
                 k_input.assert_dims({B, Hk, L0 + L1, S});
                 v_input.assert_dims({B, Hk, L0 + L1, S});
             }
-            present_key.assert_dims({B, Hk, L0 + L1, S});
-            present_value.assert_dims({B, Hk, L0 + L1, S});
-            if (beam_table)
-                beam_table.assert_dims({B, L0 + L1});
+            if (!is_paged_kv) {
+                present_key.assert_dims({B, Hk, L0 + L1, S});
+                present_value.assert_dims({B, Hk, L0 + L1, S});
+                if (beam_table)
+                    beam_table.assert_dims({B, L0 + L1});
+            }
         }
 
         bool auto_causal;
@@ -1145,8 +1240,13 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             //  1, in matrix mutiply, using AMX is not efficency because the M dimension of A will alway be 1
             //  2, using float will save the repack cost which typically is required for bf16/int8 opt
             //  3, using dot product can leverage the SIMD while easily adapt to indirect kv cache
+            if (!is_pagedattn && !is_paged_kv &&
+                execute_single_token_sharded(q_input, present_key, present_value, use_attn_mask ? attn_mask : PlainTensor(),
+                    output_emb, beam_table, has_out_transpose, auto_causal, scale_input, k_scale_zp, v_scale_zp))
+                return;
             kernel_single_token(q_input, present_key, present_value, {}, use_attn_mask ? attn_mask : PlainTensor(),
-                output_emb, beam_table, max_context_len, context_lens, has_out_transpose, auto_causal, scale_input, k_scale_zp, v_scale_zp);
+                output_emb, beam_table, value_block_table, max_context_len, context_lens, query_lens, has_out_transpose, auto_causal,
+                scale_input, k_scale_zp, v_scale_zp);
         }
     }
 };
@@ -1324,6 +1424,7 @@ void ScaledDotProductAttention::execute(dnnl::stream strm) {
     }
 
     PlainTensor k_scale_zp, v_scale_zp;
+    bool is_paged_kv = false;
     if (m_is_pageattn) {
         gatherConcatPastkvForPagedAttn(inputs);
 
@@ -1332,20 +1433,30 @@ void ScaledDotProductAttention::execute(dnnl::stream strm) {
     } else {
         if (m_config.config.fuse_concat) {
             CPU_NODE_ASSERT(m_k_state && m_v_state, "has null input states");
-            // initialization will be also completed in this func
-            gatherConcatPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
-
-            presentk_input = m_k_state->internal_state_mem();
-            presentv_input = m_v_state->internal_state_mem();
-            beam_input = m_k_state->hidden_state_mem();
-            k_scale_zp = m_k_state->get_scale_zp();
-            v_scale_zp = m_v_state->get_scale_zp();
+            if (m_k_state->is_paged()) {
+                updatePagedPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
+                is_paged_kv = true;
+
+                presentk_input = m_k_state->page_mem();
+                presentv_input = m_v_state->page_mem();
+            } else {
+                // initialization will be also completed in this func
+                gatherConcatPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
+
+                presentk_input = m_k_state->internal_state_mem();
+                presentv_input = m_v_state->internal_state_mem();
+                beam_input = m_k_state->hidden_state_mem();
+                bindPastkvToNumaNodes(presentk_input, presentv_input);
+                k_scale_zp = m_k_state->get_scale_zp();
+                v_scale_zp = m_v_state->get_scale_zp();
+            }
         } else {
             presentk_input = inputs[1];
             presentv_input = inputs[2];
         }
     }
-    m_executor->execute(strm, m_config, inputs, output, presentk_input, presentv_input, beam_input, k_scale_zp, v_scale_zp);
+    m_executor->execute(strm, m_config, inputs, output, presentk_input, presentv_input, beam_input, k_scale_zp, v_scale_zp,
+                        is_paged_kv ? m_paged_kv : PagedKVCache());
 }
 
 bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
@@ -1479,17 +1590,20 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             PlainTensor new_scale_zp_k, new_scale_zp_v;
+            auto groups = quant_groups(S, context->getConfig().kvCacheGroupSize, kvcache_precision);
 
-            new_scale_zp_k.resize<float>({B, H, (L0 + L1) * 2, 2});
-            new_scale_zp_v.resize<float>({B, H, (L0 + L1) * 2, 2});
+            new_scale_zp_k.resize<float>({B, H, (L0 + L1) * 2, 2 * groups});
+            new_scale_zp_v.resize<float>({B, H, (L0 + L1) * 2, 2 * groups});
             parallel_for2d(B, H, [&](size_t b, size_t h) {
                 auto idx = static_cast<size_t>(table[b]);
                 for (size_t m = 0; m < L0; m++) {
                     auto b_kv = static_cast<size_t>(old_beam_table_k.at<int32_t>({idx, m}));
-                    new_scale_zp_k.at<float>({b, h, m, 0}) = old_scale_zp_k.at<float>({b_kv, h, m, 0});
-                    new_scale_zp_k.at<float>({b, h, m, 1}) = old_scale_zp_k.at<float>({b_kv, h, m, 1});
-                    new_scale_zp_v.at<float>({b, h, m, 0}) = old_scale_zp_v.at<float>({b_kv, h, m, 0});
-                    new_scale_zp_v.at<float>({b, h, m, 1}) = old_scale_zp_v.at<float>({b_kv, h, m, 1});
+                    std::memcpy(new_scale_zp_k.ptr<float>(b, h, m),
+                                old_scale_zp_k.ptr<float>(b_kv, h, m),
+                                sizeof(float) * 2 * groups);
+                    std::memcpy(new_scale_zp_v.ptr<float>(b, h, m),
+                                old_scale_zp_v.ptr<float>(b_kv, h, m),
+                                sizeof(float) * 2 * groups);
                 }
             });
 
@@ -1577,11 +1691,11 @@ void ScaledDotProductAttention::gatherConcatPastkvForPagedAttn(const std::vector
     if (k_cache.m_dt == ov::element::Type_t::u8) {
         k_cache.assert_dims({0, H, 0, S + 8}, true);
         v_cache.assert_dims({k_cache.m_dims[0], H, k_cache.m_dims[2], S + 8});
-        paged_attn_quantkv(k, v, k_cache, v_cache, slot_mapping);
+        paged_attn_quantkv(k, v, k_cache, v_cache, slot_mapping, slot_mapping);
     } else {
         k_cache.assert_dims({0, H, 0, S}, true);
         v_cache.assert_dims({k_cache.m_dims[0], H, k_cache.m_dims[2], S});
-        paged_attn_memcpy(k, v, k_cache, v_cache, slot_mapping);
+        paged_attn_memcpy(k, v, k_cache, v_cache, slot_mapping, slot_mapping);
     }
 }
 
@@ -1600,6 +1714,9 @@ void ScaledDotProductAttention::gatherConcatPastkv(const MemoryPtr& mem_cur_k, c
 
     auto B = cur_k.size(0);
     auto L1 = cur_k.size(2);
+    // the other requests may fork the states meanwhile
+    auto k_lock = m_k_state->lock_state();
+    auto v_lock = m_v_state->lock_state();
     if (B != B_state) {
         resetBeamTablePastkv(mem_cur_k, mem_cur_v, mem_beam_idx);
         return;
@@ -1609,6 +1726,35 @@ void ScaledDotProductAttention::gatherConcatPastkv(const MemoryPtr& mem_cur_k, c
     updatePastkv(mem_cur_k, mem_cur_v);
 }
 
+// In the tensor parallel mode the decoding of the kv heads is split across the sockets (see execute_single_token_sharded),
+//  so the part of the cache keeping the heads of the shard is bound to the memory of the socket computing it. The policy
+//  is set once per buffer, the tokens appended later are allocated on the same node.
+void ScaledDotProductAttention::bindPastkvToNumaNodes(const MemoryPtr& mem_past_k, const MemoryPtr& mem_past_v) {
+    const auto shards = static_cast<size_t>(context->getNumSubStreamSockets());
+    if (shards <= 1 || !mem_past_k->getData() || !mem_past_v->getData())
+        return;
+    if (m_numa_bound_pastkv.first == mem_past_k->getData() && m_numa_bound_pastkv.second == mem_past_v->getData())
+        return;
+    m_numa_bound_pastkv = {mem_past_k->getData(), mem_past_v->getData()};
+
+    for (const auto& mem : {mem_past_k, mem_past_v}) {
+        PlainTensor past(mem);
+        if (!m_config.config.permute_axes.empty())
+            past = past.permute(m_config.config.permute_axes);
+        // [B, Hk, L, S]: only the heads outer to the tokens are placed contiguously, u4 packs two elements in a byte
+        const auto Hk = past.size(1);
+        if (Hk < shards || past.stride(1) <= past.stride(2) || past.get_precision() == ov::element::u4)
+            continue;
+        for (size_t shard = 0; shard < shards; shard++) {
+            size_t hk0, hk1;
+            splitter(Hk, shards, shard, hk0, hk1);
+            for (size_t b = 0; b < past.size(0); b++) {
+                mbind_move(past.ptr_v(b, hk0), (hk1 - hk0) * past.stride(1) * past.m_element_size, static_cast<int>(shard));
+            }
+        }
+    }
+}
+
 // Update beam table using beam_idx. For first token, beam table is like [[0, 0, 0, ...], [1, 1, 1, ...], ...],
 //   for second token, beam table is updated using gather(beam_table, beam_idx) then appending [0, 1, 2, ...] to the end for itself.
 void ScaledDotProductAttention::updateBeamTable(const MemoryPtr& mem_beam_idx, size_t L1) {
@@ -1774,6 +1920,8 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     OPENVINO_ASSERT(B * (L0 + L1) > 0, "B or (L0+L1) is zero, B: ", B, ", L0: ", L0, ", L1: ", L1);
     // resize buffer
     ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
+    // the (scale, zp) pairs of the groups of a token are kept in scale_zp [B, H, L, 2 * groups]
+    auto groups = quant_groups(S, context->getConfig().kvCacheGroupSize, kvcache_precision);
     bool need_redefine = true;
     if (B * H * (L0 + L1) * S > m_k_state->internal_state_max_size()) {
         auto new_shape = {B, H, (L0 + L1) * 2, S};
@@ -1810,16 +1958,16 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             PlainTensor new_scale_zp_k, new_scale_zp_v;
 
-            new_scale_zp_k.resize<float>({B, H, (L0 + L1) * 2, 2});
-            new_scale_zp_v.resize<float>({B, H, (L0 + L1) * 2, 2});
+            new_scale_zp_k.resize<float>({B, H, (L0 + L1) * 2, 2 * groups});
+            new_scale_zp_v.resize<float>({B, H, (L0 + L1) * 2, 2 * groups});
             if (L0 > 0 && !is_reset) {
                 parallel_for2d(B, H, [&](size_t b, size_t h) {
                     memcpy(new_scale_zp_k.ptr<float>(b, h),
                            old_scale_zp_k.ptr<float>(b, h),
-                           sizeof(float) * L0 * 2);
+                           sizeof(float) * L0 * 2 * groups);
                     memcpy(new_scale_zp_v.ptr<float>(b, h),
                            old_scale_zp_v.ptr<float>(b, h),
-                           sizeof(float) * L0 * 2);
+                           sizeof(float) * L0 * 2 * groups);
                 });
             }
 
@@ -1850,10 +1998,10 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             // only dim0, dim1 need change
-            old_scale_zp_k.m_strides[0] = H * max_l * 2;
-            old_scale_zp_k.m_strides[1] = max_l * 2;
-            old_scale_zp_v.m_strides[0] = H * max_l * 2;
-            old_scale_zp_v.m_strides[1] = max_l * 2;
+            old_scale_zp_k.m_strides[0] = H * max_l * 2 * groups;
+            old_scale_zp_k.m_strides[1] = max_l * 2 * groups;
+            old_scale_zp_v.m_strides[0] = H * max_l * 2 * groups;
+            old_scale_zp_v.m_strides[1] = max_l * 2 * groups;
         }
     }
     if (need_redefine) {
@@ -1904,6 +2052,131 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     }
 }
 
+// Append cur_k, cur_v to the paged kv cache states. Beam search reorders the block tables only, the pages of the common
+//   prefix are shared between the sequences and the partially filled last page is copied on write.
+void ScaledDotProductAttention::updatePagedPastkv(const MemoryPtr& mem_cur_k,
+                                                  const MemoryPtr& mem_cur_v,
+                                                  const MemoryPtr& mem_beam_idx) {
+    std::vector<size_t> order = {0, 1, 2, 3};
+    if (!m_config.config.permute_axes.empty()) {
+        order = m_config.config.permute_axes;
+    }
+    PlainTensor cur_k, cur_v, beam_idx;
+    cur_k.reset(mem_cur_k);
+    cur_v.reset(mem_cur_v);
+    beam_idx.reset(mem_beam_idx);
+    cur_k = cur_k.permute(order);
+    cur_v = cur_v.permute(order);
+    auto B = cur_k.size(0);
+    auto H = cur_k.size(1);
+    auto L1 = cur_k.size(2);
+    auto S = cur_k.size(3);
+    auto SV = cur_v.size(3);
+
+    auto inputNumber = getOriginalInputsNumber();
+    auto&& v_dims = getParentEdgeAt(inputNumber - 1)->getMemory().getStaticDims();
+    size_t L0 = v_dims.at(order[2]);
+    auto B_state = v_dims.at(order[0]);
+    auto is_reset = m_k_state->is_reset_state();
+    OPENVINO_ASSERT(is_reset == m_v_state->is_reset_state(), "key and value states must be reset together");
+
+    // the other requests may fork the states meanwhile
+    auto k_lock = m_k_state->lock_state();
+    auto v_lock = m_v_state->lock_state();
+    auto& pool = m_k_state->page_pool();
+    auto page_tokens = pool->getPageTokens();
+    ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
+    // the quantized tokens keep the scales and zero points in the row, the last dim of the page is in bytes then,
+    //  see the layout in attn_quant.hpp
+    bool is_quantized = kvcache_precision == ov::element::u8 || kvcache_precision == ov::element::u4;
+    auto group_size = context->getConfig().kvCacheGroupSize;
+    auto row_k = is_quantized ? quant_row_bytes(S, quant_groups(S, group_size, kvcache_precision), kvcache_precision) : S;
+    auto row_v = is_quantized ? quant_row_bytes(SV, quant_groups(SV, group_size, kvcache_precision), kvcache_precision) : SV;
+    m_k_state->assign_page_arena(pool->getArena(H * page_tokens * row_k * kvcache_precision.size()),
+                                 {H, page_tokens, row_k});
+    m_v_state->assign_page_arena(pool->getArena(H * page_tokens * row_v * kvcache_precision.size()),
+                                 {H, page_tokens, row_v});
+
+    PlainTensor init_k, init_v;
+    if (is_reset) {
+        m_k_state->release_pages();
+        m_v_state->release_pages();
+        if (L0 > 0) {
+            auto k_mem = getSrcMemoryAtPort(inputNumber - 2);
+            auto v_mem = getSrcMemoryAtPort(inputNumber - 1);
+            if (!k_mem->getShape().hasZeroDims() && !v_mem->getShape().hasZeroDims()) {
+                init_k.reset(k_mem);
+                init_v.reset(v_mem);
+                init_k = init_k.permute(order);
+                init_v = init_v.permute(order);
+            }
+        }
+    } else if (L0 > 0) {
+        bool is_identity = B == B_state;
+        for (size_t b = 0; b < B && is_identity; b++) {
+            is_identity = beam_idx.ptr<int32_t>()[b] == static_cast<int32_t>(b);
+        }
+        if (!is_identity) {
+            m_k_state->gather_pages(beam_idx.ptr<int32_t>(), B);
+            m_v_state->gather_pages(beam_idx.ptr<int32_t>(), B);
+        }
+    }
+    OPENVINO_ASSERT(B * (L0 + L1) > 0, "B or (L0+L1) is zero, B: ", B, ", L0: ", L0, ", L1: ", L1);
+
+    auto copies_k = m_k_state->reserve_pages(B, L0 + L1);
+    auto copies_v = m_v_state->reserve_pages(B, L0 + L1);
+    m_k_state->assign_paged_shape(B, H, L0 + L1, S);
+    m_v_state->assign_paged_shape(B, H, L0 + L1, SV);
+
+    auto&& block_table_k = m_k_state->block_table();
+    auto&& block_table_v = m_v_state->block_table();
+    auto max_blocks = (L0 + L1 + page_tokens - 1) / page_tokens;
+    m_paged_kv.key_block_table.resize<int32_t>({B, max_blocks});
+    m_paged_kv.value_block_table.resize<int32_t>({B, max_blocks});
+    m_paged_kv.context_lens.resize<int32_t>({B});
+    for (size_t b = 0; b < B; b++) {
+        std::copy(block_table_k[b].begin(), block_table_k[b].end(), m_paged_kv.key_block_table.ptr<int32_t>(b));
+        std::copy(block_table_v[b].begin(), block_table_v[b].end(), m_paged_kv.value_block_table.ptr<int32_t>(b));
+        m_paged_kv.context_lens.ptr<int32_t>()[b] = static_cast<int32_t>(L0 + L1);
+    }
+    // slot of the token m of the sequence b, filled with the new tokens, or with the initial ones when reset
+    auto fill_slots = [&](PlainTensor& slots, const PlainTensor& block_table, size_t start, size_t len) {
+        slots.resize<int32_t>({B, len});
+        for (size_t b = 0; b < B; b++) {
+            for (size_t m = 0; m < len; m++) {
+                auto pos = start + m;
+                slots.ptr<int32_t>(b)[m] = block_table.ptr<int32_t>(b)[pos / page_tokens] * page_tokens + pos % page_tokens;
+            }
+        }
+    };
+
+    PlainTensor past_k, past_v, slots_k, slots_v;
+    past_k.reset(m_k_state->page_mem());
+    past_v.reset(m_v_state->page_mem());
+    auto copy_pages = [&](const PlainTensor& pages, const std::vector<std::pair<int32_t, int32_t>>& copies) {
+        auto page_bytes = pages.stride(0) * pages.m_element_size;
+        for (auto&& copy : copies) {
+            std::memcpy(pages.ptr_v(copy.second), pages.ptr_v(copy.first), page_bytes);
+        }
+    };
+    copy_pages(past_k, copies_k);
+    copy_pages(past_v, copies_v);
+
+    auto write_tokens = [&](const PlainTensor& k, const PlainTensor& v, size_t start, size_t len) {
+        fill_slots(slots_k, m_paged_kv.key_block_table, start, len);
+        fill_slots(slots_v, m_paged_kv.value_block_table, start, len);
+        if (is_quantized) {
+            paged_attn_quantkv(k, v, past_k, past_v, slots_k, slots_v);
+        } else {
+            paged_attn_memcpy(k, v, past_k, past_v, slots_k, slots_v);
+        }
+    };
+    if (init_k) {
+        write_tokens(init_k, init_v, 0, L0);
+    }
+    write_tokens(cur_k, cur_v, L0, L1);
+}
+
 ov::element::Type ScaledDotProductAttention::getKVCachePrecision() {
     ov::element::Type kvcache_precision;
     auto rtPrecision = getRuntimePrecision();
@@ -1912,7 +2185,11 @@ ov::element::Type ScaledDotProductAttention::getKVCachePrecision() {
         rtPrecision != ov::element::bf16 && kvCachePrecisionHint == ov::element::f16;
     kvcache_precision = enableKVCacheFP16 ? ov::element::f16 : rtPrecision;
     bool use_int8_kv_cache_precision = kvCachePrecisionHint == ov::element::u8;
-    if (use_int8_kv_cache_precision)
+    // u4 is packed in the rows of the paged kv cache only, the contiguous one falls back to u8
+    bool use_int4_kv_cache_precision = kvCachePrecisionHint == ov::element::u4;
+    if (use_int4_kv_cache_precision)
+        kvcache_precision = context->getKVCachePagePool() ? ov::element::u4 : ov::element::u8;
+    else if (use_int8_kv_cache_precision)
         kvcache_precision = ov::element::u8;
     else
         kvcache_precision = enableKVCacheFP16 ? ov::element::f16 : rtPrecision;
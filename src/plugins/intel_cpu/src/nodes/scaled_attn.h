@@ -51,18 +51,27 @@ private:
     void gatherConcatPastkvForPagedAttn(const std::vector<MemoryPtr>& inputs);
     void updateBeamTable(const MemoryPtr& mem_beam_idx, size_t new_q_len);
     void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
+    void bindPastkvToNumaNodes(const MemoryPtr& mem_past_k, const MemoryPtr& mem_past_v);
     ov::element::Type getRuntimePrecision() const override;
     void resetBeamTablePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
+    void updatePagedPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
 
     struct Config {
         ScaledDotProductAttentionWithKVCache::Config config;
         bool is_pageattn = false;
     };
 
+    // block tables of the paged KV cache states, empty when the states are not paged
+    struct PagedKVCache {
+        PlainTensor key_block_table;      // i32[B, max_blocks]
+        PlainTensor value_block_table;    // i32[B, max_blocks]
+        PlainTensor context_lens;         // i32[B], L0 + L1
+    };
+
     struct Executor {
         virtual void execute(dnnl::stream strm, const Config& config, const std::vector<MemoryPtr>& inputs, const MemoryPtr output,
                              const MemoryPtr presentk_input, const MemoryPtr presentv_input, const MemoryPtr beam_input,
-                             const PlainTensor& k_scale_zp, const PlainTensor& v_scale_zp) = 0;
+                             const PlainTensor& k_scale_zp, const PlainTensor& v_scale_zp, const PagedKVCache& paged_kv) = 0;
     };
 
     bool m_is_pageattn;
@@ -73,6 +82,9 @@ private:
 
     std::shared_ptr<VariableStateKVcache> m_k_state;
     std::shared_ptr<VariableStateKVcache> m_v_state;
+    PagedKVCache m_paged_kv;
+    // kv cache buffers whose heads are bound to the sockets in the tensor parallel mode
+    std::pair<const void*, const void*> m_numa_bound_pastkv = {nullptr, nullptr};
 
     // PagedAttention input index
     static const size_t ID_Q = 0;
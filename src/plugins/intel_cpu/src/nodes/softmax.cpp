@@ -206,7 +206,7 @@ void SoftMax::prepareParams() {
         return std::make_shared<DnnlExecutor>(prim_desc);
     };
 
-    auto cache = context->getParamsCache();
+    auto cache = context->getSharedParamsCache();
     auto result = cache->getOrCreate(key, builder);
 
     execPtr = result.first;
@@ -235,6 +235,12 @@ void SoftMax::execute(dnnl::stream strm) {
     }
 }
 
+dnnl::primitive SoftMax::getReplayablePrimitive() const {
+    if (execPtr && !execPtr->needReordering())
+        return execPtr->getExecPrim();
+    return {};
+}
+
 void SoftMax::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
@@ -5,7 +5,6 @@
 
 #include "common/primitive_hashing_utils.hpp"
 #include "dnnl_extension_utils.h"
-#include "emitters/snippets/x64/cpu_generator.hpp"
 #include "onednn/dnnl.h"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
@@ -22,6 +21,13 @@
 #include "snippets/lowered/pass/mark_loops.hpp"
 #include "transformations/defs.hpp"
 #include "transformations/cpu_opset/common/pass/convert_to_swish_cpu.hpp"
+#include "utils/cpu_utils.hpp"
+#include "utils/ngraph_utils.hpp"
+
+#if defined(OPENVINO_ARCH_ARM64)
+#include "emitters/snippets/aarch64/cpu_generator.hpp"
+#else
+#include "emitters/snippets/x64/cpu_generator.hpp"
 #include "transformations/snippets/x64/pass/lowered/brgemm_blocking.hpp"
 #include "transformations/snippets/x64/pass/lowered/fuse_load_store_and_convert.hpp"
 #include "transformations/snippets/x64/pass/lowered/set_brgemm_copy_b_buffers_shape.hpp"
@@ -31,14 +37,15 @@
 #include "transformations/snippets/x64/pass/brgemm_to_brgemm_cpu.hpp"
 #include "transformations/snippets/x64/pass/enforce_precision.hpp"
 #include "transformations/snippets/x64/shape_inference.hpp"
-#include "utils/cpu_utils.hpp"
-#include "utils/ngraph_utils.hpp"
+#endif
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <limits>
 #include <vector>
 
-#if defined(__linux__) && defined(SNIPPETS_DEBUG_CAPS)
+#if defined(__linux__) && defined(OPENVINO_ARCH_X86_64) && defined(SNIPPETS_DEBUG_CAPS)
 #include "emitters/snippets/x64/jit_segfault_detector_emitter.hpp"
 #include <signal.h>
 std::mutex err_print_lock;
@@ -53,14 +60,19 @@ std::mutex err_print_lock;
 
 using namespace dnnl::impl::utils;
 using namespace dnnl::impl::cpu;
+#if defined(OPENVINO_ARCH_X86_64)
 using namespace dnnl::impl::cpu::x64;
 using namespace Xbyak;
+#endif
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 namespace {
 
+// each tuning candidate is executed once to warm up the caches, then the best time of the runs is taken
+constexpr size_t tuningRuns = 5;
+
 struct SnippetKey {
     Snippet::SnippetAttrs attrs;
 
@@ -88,6 +100,9 @@ size_t SnippetKey::hash() const {
         seed = hash_combine(seed, prec.hash());
 
     seed = hash_combine(seed, attrs.bodyHash);
+    seed = hash_combine(seed, attrs.tuningParams.blockM);
+    seed = hash_combine(seed, attrs.tuningParams.blockN);
+    seed = hash_combine(seed, attrs.tuningParams.blockK);
 
     return seed;
 }
@@ -95,6 +110,8 @@ size_t SnippetKey::hash() const {
 bool SnippetKey::operator==(const SnippetKey& rhs) const {
     if (attrs.bodyHash != rhs.attrs.bodyHash)
         return false;
+    if (!(attrs.tuningParams == rhs.attrs.tuningParams))
+        return false;
     if (attrs.inMemBlockedDims.size() != rhs.attrs.inMemBlockedDims.size() ||
         attrs.inMemOrders.size() != rhs.attrs.inMemOrders.size() ||
         attrs.inMemPrecs.size() != rhs.attrs.inMemPrecs.size())
@@ -135,8 +152,12 @@ bool SnippetKey::operator==(const SnippetKey& rhs) const {
 
 Snippet::Snippet(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
         : Node(op, context, SnippetShapeInferFactory(op)) {
+#if defined(OPENVINO_ARCH_ARM64)
+    host_isa = dnnl::impl::cpu::aarch64::asimd;
+#else
     host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ?
         dnnl::impl::cpu::x64::avx512_core : dnnl::impl::cpu::x64::avx2;
+#endif
     const auto& tmp_snippet = ov::as_type_ptr<snippets::op::Subgraph>(op);
     OPENVINO_ASSERT(tmp_snippet, "Attempt to create Snippet node from an invalid op type");
     snippetAttrs.snippet = tmp_snippet->clone();
@@ -144,6 +165,8 @@ Snippet::Snippet(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr&
 
 #if defined(OPENVINO_ARCH_X86_64)
     snippetAttrs.snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+#elif defined(OPENVINO_ARCH_ARM64)
+    snippetAttrs.snippet->set_generator(std::make_shared<aarch64::CPUGenerator>(host_isa));
 #else
     OPENVINO_THROW("CPU plugin: Snippets code-generator is not supported on non-x64 platforms");
 
@@ -184,6 +207,10 @@ void Snippet::initSupportedPrimitiveDescriptors() {
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
     bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  3u, 4u, 5u) && dimRanksAreEqual && !isOnlyPlanarApplicable;
+#if defined(OPENVINO_ARCH_ARM64)
+    // The blocked layouts aren't used by the other nodes on aarch64, so the reorders would be inserted around the Subgraph
+    isBlockedApplicable = false;
+#endif
 
     for (const auto& inShape : inputShapes) {
         if (isDynamic && inShape.getRank() != 1)
@@ -214,7 +241,11 @@ void Snippet::initSupportedPrimitiveDescriptors() {
 
                 return std::make_shared<CpuBlockedMemoryDesc>(prc, shape, blocks, order, offset);
             } else if (lt == Blocked && shape.getRank() != 1 && (shape.getMinDims()[1] != Shape::UNDEFINED_DIM && shape.getMinDims()[1] > 1)) {
+#if defined(OPENVINO_ARCH_X86_64)
                 size_t blockSize = mayiuse(dnnl::impl::cpu::x64::avx512_core) ? 16 : 8;
+#else
+                size_t blockSize = 8;
+#endif
 
                 VectorDims blocks = dims;
                 VectorDims order(blocks.size());
@@ -278,11 +309,17 @@ void Snippet::initSupportedPrimitiveDescriptors() {
         }
 
         impl_desc_type impl_type = impl_desc_type::unknown;
+#if defined(OPENVINO_ARCH_X86_64)
         if (mayiuse(x64::avx512_core)) {
             impl_type = impl_desc_type::jit_avx512;
         } else if (mayiuse(x64::avx2)) {
             impl_type = impl_desc_type::jit_avx2;
         }
+#elif defined(OPENVINO_ARCH_ARM64)
+        if (dnnl::impl::cpu::aarch64::mayiuse(dnnl::impl::cpu::aarch64::asimd)) {
+            impl_type = impl_desc_type::jit_asimd;
+        }
+#endif
         return {config, impl_type};
     };
 
@@ -322,6 +359,12 @@ void Snippet::initOptimalPrimitiveDescriptor() {
         snippetAttrs.has_non_planar_inputs |= !isPlanar(order);
         in_blocked_shapes.emplace_back(blockedDesc->getBlockDims(), order);
     }
+    // Note: the shape-agnostic kernel supports only elementwise planar subgraphs:
+    //       domain sensitive operations require the Buffers with the shape-dependent allocation size
+    // Note: the dynamic loops aren't supported by aarch64 generator yet, so the shape-specific kernels are used there
+#if !defined(SNIPPETS_LIBXSMM_TPP) && defined(OPENVINO_ARCH_X86_64)
+    is_shape_agnostic = is_dynamic && !snippetAttrs.has_non_planar_inputs && !snippetAttrs.snippet->has_domain_sensitive_ops();
+#endif
     outputNum = config.outConfs.size();
     snippetAttrs.outMemPrecs.resize(outputNum);
     snippetAttrs.outMemOrders.resize(outputNum);
@@ -392,12 +435,22 @@ void Snippet::initOptimalPrimitiveDescriptor() {
         output_precisions.push_back(p);
 
     snippetAttrs.snippet->data_flow_transformations(in_blocked_shapes, input_precisions, output_precisions, backend_passes);
+#if defined(OPENVINO_ARCH_X86_64)
+    // Only the block sizes of the Brgemm loops are tuned. The dynamic Subgraphs aren't tuned,
+    // since the benchmarking would delay the first inference with each new shape
+    if (context->getSnippetsTuningCache() && !is_dynamic)
+        tuningCandidates = ov::intel_cpu::pass::SetBrgemmCPUBlockingParams::get_tuning_candidates(snippetAttrs.snippet->body_ptr());
+#endif
     // Note: minimal JIT work amount is a predefined value that describes the number of kernel iterations (work amount)
     // needed to cover kernel call overhead. It is used for balancing between parallel and JIT work amounts in domain optimization.
-#ifdef SNIPPETS_LIBXSMM_TPP
+#if defined(SNIPPETS_LIBXSMM_TPP)
     const auto& lir = snippetAttrs.snippet->convert_body_to_linear_ir(static_cast<size_t>(parallel_get_max_threads()), 256,
                                                                       std::make_shared<snippets::CPUShapeInferSnippetsFactory>());
     lir->set_loop_depth(std::min(2ul, lir->get_master_shape().size()));
+#elif defined(OPENVINO_ARCH_ARM64)
+    // There are no backend-specific operations on aarch64, so the common shape infer factory is used
+    snippetAttrs.snippet->convert_body_to_linear_ir(static_cast<size_t>(parallel_get_max_threads()), 256,
+                                                    std::make_shared<snippets::IShapeInferSnippetsFactory>());
 #else
     snippetAttrs.snippet->convert_body_to_linear_ir(static_cast<size_t>(parallel_get_max_threads()), 256,
                                                     std::make_shared<snippets::CPUShapeInferSnippetsFactory>());
@@ -422,6 +475,28 @@ void Snippet::prepareParams() {
     for (size_t i = 0; i < outputNum; i++)
         snippetAttrs.outMemBlockedDims[i] = getChildEdgeAt(i)->getMemory().getDescWithType<BlockedMemoryDesc>()->getBlockDims();
 
+    if (is_shape_agnostic) {
+        if (!shapeAgnosticExecPtr) {
+            const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+            std::vector<VectorDims> inTemplateDims(inputNum), outTemplateDims(outputNum);
+            for (size_t i = 0; i < inputNum; i++)
+                inTemplateDims[i] = config.inConfs[i].getMemDesc()->as<BlockedMemoryDesc>()->getBlockDims();
+            for (size_t i = 0; i < outputNum; i++)
+                outTemplateDims[i] = config.outConfs[i].getMemDesc()->as<BlockedMemoryDesc>()->getBlockDims();
+            shapeAgnosticExecPtr = std::make_shared<SnippetJitDynamicExecutor>(snippetAttrs, inTemplateDims, outTemplateDims);
+        }
+        const auto executor = std::static_pointer_cast<SnippetJitDynamicExecutor>(shapeAgnosticExecPtr);
+        is_shape_agnostic = executor->is_supported();
+        // otherwise fallback to the shape-specific kernel
+        if (is_shape_agnostic && executor->update(snippetAttrs.inMemBlockedDims)) {
+            execPtr = shapeAgnosticExecPtr;
+            return;
+        }
+    }
+
+    if (!tuningCandidates.empty())
+        tuneBlockingParams();
+
     SnippetKey key = {snippetAttrs};
 
     auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetExecutor> {
@@ -452,6 +527,55 @@ void Snippet::prepareParams() {
 #endif
 }
 
+void Snippet::tuneBlockingParams() {
+    const auto& cache = context->getSnippetsTuningCache();
+    // the key doesn't depend on the previously selected parameters
+    snippetAttrs.tuningParams = {};
+    const uint64_t key = dnnl::impl::hash_combine(SnippetKey{snippetAttrs}.hash(), static_cast<size_t>(host_isa));
+    if (cache->find(key, snippetAttrs.tuningParams))
+        return;
+
+    // the candidates are executed on the zeroed copies of the node memory, so the node data isn't modified
+    std::vector<MemoryPtr> inMemPtrs(inputNum), outMemPtrs(outputNum);
+    for (size_t i = 0; i < inputNum; i++) {
+        inMemPtrs[i] = std::make_shared<Memory>(getEngine(), getSrcMemoryAtPort(i)->getDescPtr());
+        inMemPtrs[i]->nullify();
+    }
+    for (size_t i = 0; i < outputNum; i++) {
+        outMemPtrs[i] = std::make_shared<Memory>(getEngine(), getDstMemoryAtPort(i)->getDescPtr());
+    }
+
+    SnippetsTuningCache::Params bestParams;
+    double bestTime = std::numeric_limits<double>::max();
+    for (const auto& params : tuningCandidates) {
+        auto attrs = snippetAttrs;
+        attrs.tuningParams = params;
+        std::shared_ptr<SnippetJitExecutor> executor;
+        try {
+            executor = std::make_shared<SnippetJitExecutor>(attrs, is_dynamic);
+        } catch (const ov::Exception&) {
+            // the candidate isn't supported by the lowering pipeline, e.g. the loops can't be fused
+            continue;
+        }
+        executor->exec(inMemPtrs, outMemPtrs);
+        double time = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < tuningRuns; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            executor->exec(inMemPtrs, outMemPtrs);
+            time = std::min(time, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        DEBUG_LOG("Snippets autotuning of ", getName(), ": M block ", params.blockM, ", N block ", params.blockN,
+                  ", K block ", params.blockK, " - ", time * 1e6, " us");
+        if (time < bestTime) {
+            bestTime = time;
+            bestParams = params;
+        }
+    }
+
+    snippetAttrs.tuningParams = bestParams;
+    cache->record(key, bestParams);
+}
+
 bool Snippet::needPrepareParams() const {
     auto jit_executor = dynamic_cast<SnippetJitExecutor*>(execPtr.get());
     return inputShapesModified() || (jit_executor && !jit_executor->schedule_created());
@@ -541,8 +665,8 @@ void Snippet::SnippetJitExecutor::update_ptrs(jit_snippets_call_args& call_args,
     }
 }
 
-#if defined(__linux__) && defined(SNIPPETS_DEBUG_CAPS)
-void Snippet::SnippetJitExecutor::segfault_detector() {
+#if defined(__linux__) && defined(OPENVINO_ARCH_X86_64) && defined(SNIPPETS_DEBUG_CAPS)
+void Snippet::SnippetExecutor::segfault_detector() {
     const auto target = std::dynamic_pointer_cast<const CPUTargetMachine>(snippetAttrs.snippet->get_generator()->get_target_machine());
     if (target && target->debug_config.enable_segfault_detector) {
         __sighandler_t signal_handler = [](int signal) {
@@ -563,7 +687,7 @@ void Snippet::SnippetJitExecutor::schedule_6d(const std::vector<MemoryPtr>& inMe
     const auto& dom = parallel_exec_domain;
     // < N, C, H, W > < 1, 1, N, C*H*W>
     const auto& callable = schedule.get_callable<kernel>();
-#if defined(__linux__) && defined(SNIPPETS_DEBUG_CAPS)
+#if defined(__linux__) && defined(OPENVINO_ARCH_X86_64) && defined(SNIPPETS_DEBUG_CAPS)
     segfault_detector();
 #endif
     parallel_for5d(dom[0], dom[1], dom[2], dom[3], dom[4],
@@ -577,7 +701,7 @@ void Snippet::SnippetJitExecutor::schedule_6d(const std::vector<MemoryPtr>& inMe
 
 void Snippet::SnippetJitExecutor::schedule_nt(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
     const auto& work_size = parallel_exec_domain;
-#if defined(__linux__) && defined(SNIPPETS_DEBUG_CAPS)
+#if defined(__linux__) && defined(OPENVINO_ARCH_X86_64) && defined(SNIPPETS_DEBUG_CAPS)
     segfault_detector();
 #endif
     parallel_nt(0, [&](const int ithr, const int nthr) {
@@ -637,7 +761,7 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(SnippetAttrs attrs, bool is_dyna
     // generate
     jit_snippets_compile_args jcp;
     jcp.parallel_executor_ndims = tensorRank;
-    generate(&jcp);
+    schedule = generate(&jcp);
     buffer_scratchpad_size = schedule.lowering_result.buffer_scratchpad_size;
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
     parallel_exec_domain = schedule.parallel_exec_domain;
@@ -645,7 +769,7 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(SnippetAttrs attrs, bool is_dyna
     parallel_exec_domain = getNormalizedDimsBySize(parallel_exec_domain, tensorRank);
 }
 
-void Snippet::SnippetJitExecutor::generate(const jit_snippets_compile_args* jcp) {
+snippets::Schedule Snippet::SnippetExecutor::generate(const jit_snippets_compile_args* jcp) const {
     std::vector<ov::snippets::lowered::pass::PassPipeline::PositionedPassLowered> backend_passes;
 
 #if defined(OPENVINO_ARCH_X86_64)
@@ -658,7 +782,8 @@ void Snippet::SnippetJitExecutor::generate(const jit_snippets_compile_args* jcp)
 #endif  // OPENVINO_ARCH_X86_64
 
     SNIPPETS_REGISTER_PASS_RELATIVE(Place::After, ov::snippets::lowered::pass::MarkLoops,
-                                    ov::intel_cpu::pass::BrgemmBlocking);
+                                    ov::intel_cpu::pass::BrgemmBlocking, snippetAttrs.tuningParams.blockM,
+                                    snippetAttrs.tuningParams.blockN, snippetAttrs.tuningParams.blockK);
     SNIPPETS_REGISTER_PASS_RELATIVE(Place::After, ov::snippets::lowered::pass::InsertLoops,
                                     ov::intel_cpu::pass::FuseLoadStoreConvert);
     SNIPPETS_REGISTER_PASS_RELATIVE(Place::After, ov::intel_cpu::pass::FuseLoadStoreConvert,
@@ -672,17 +797,143 @@ void Snippet::SnippetJitExecutor::generate(const jit_snippets_compile_args* jcp)
                                     ov::intel_cpu::tpp::pass::SetTPPLeadingDim);
 #endif
 
-    schedule = snippetAttrs.snippet->generate_from_linear_ir(lowering_config,
-                                                             backend_passes,
-                                                             reinterpret_cast<const void*>(jcp));
-
 #undef SNIPPETS_REGISTER_PASS_RELATIVE
+
+    return snippetAttrs.snippet->generate_from_linear_ir(lowering_config,
+                                                         backend_passes,
+                                                         reinterpret_cast<const void*>(jcp));
 }
 
 bool Snippet::SnippetJitExecutor::schedule_created() {
     return !schedule.lowering_result.compiled_snippet->empty();
 }
 
+Snippet::SnippetJitDynamicExecutor::SnippetJitDynamicExecutor(SnippetAttrs attrs, const std::vector<VectorDims>& inTemplateDims,
+                                                              const std::vector<VectorDims>& outTemplateDims) :
+    SnippetExecutor(std::move(attrs), true) {
+    numInput = inTemplateDims.size();
+    numOutput = outTemplateDims.size();
+    start_offset_in.resize(numInput);
+    start_offset_out.resize(numOutput);
+    dataSize.resize(numInput + numOutput);
+    for (size_t i = 0; i < numInput; i++)
+        dataSize[i] = snippetAttrs.inMemPrecs[i].size();
+    for (size_t i = 0; i < numOutput; i++)
+        dataSize[i + numInput] = snippetAttrs.outMemPrecs[i].size();
+    data_offsets.resize(numInput + numOutput);
+
+    // BroadcastMove can't be inserted for the last dimension which is undefined in the compile time,
+    // so the kernel supports only the shapes with the equal last dimensions of all the inputs in this case
+    is_last_dim_dynamic = std::any_of(outTemplateDims.cbegin(), outTemplateDims.cend(), [](const VectorDims& dims) {
+        return !dims.empty() && snippets::utils::is_dynamic_value(dims.back());
+    });
+
+    // The body is reshaped to the undefined shapes, so the generated kernel doesn't depend on the current input shapes.
+    // The actual shapes are restored after the code generation, since the body is shared with the node shape inference
+    const std::vector<snippets::VectorDimsRef> template_shapes(inTemplateDims.cbegin(), inTemplateDims.cend());
+    snippetAttrs.snippet->shape_infer(template_shapes);
+    try {
+        jit_snippets_compile_args jcp;
+        jcp.parallel_executor_ndims = rank6D;
+        schedule = generate(&jcp);
+        // Note: Buffers aren't supported since the scratchpad size depends on the shapes
+        supported = schedule.lowering_result.linear_ir != nullptr && schedule.lowering_result.buffer_scratchpad_size == 0;
+    } catch (const ov::Exception&) {
+        // the subgraph is executed by the shape-specific kernels
+        supported = false;
+    }
+    const std::vector<snippets::VectorDimsRef> in_shapes(snippetAttrs.inMemBlockedDims.cbegin(), snippetAttrs.inMemBlockedDims.cend());
+    snippetAttrs.snippet->shape_infer(in_shapes);
+
+    configurator = std::make_shared<snippets::RuntimeConfigurator>();
+}
+
+bool Snippet::SnippetJitDynamicExecutor::update(const std::vector<VectorDims>& inMemBlockedDims) {
+    const std::vector<snippets::VectorDimsRef> in_shapes(inMemBlockedDims.cbegin(), inMemBlockedDims.cend());
+    const auto& linear_ir = schedule.lowering_result.linear_ir;
+    const auto& config = configurator->get_updated_config(linear_ir, in_shapes);
+    const auto& master_shape = config->master_shape;
+    if (is_last_dim_dynamic) {
+        for (const auto& dims : inMemBlockedDims) {
+            if ((dims.empty() ? 1 : dims.back()) != master_shape.back())
+                return false;
+        }
+    }
+
+    const size_t tensorRank = std::max(static_cast<size_t>(rank6D), master_shape.size());
+    parallel_exec_domain = master_shape;
+    const size_t loop_depth = linear_ir->get_config().m_loop_depth;
+    for (size_t i = 0; i < loop_depth; i++)
+        parallel_exec_domain[parallel_exec_domain.size() - 1 - i] = 1;
+    harnessWorkAmount = std::accumulate(parallel_exec_domain.begin(), parallel_exec_domain.end(), 1, std::multiplies<size_t>());
+    parallel_exec_domain = getNormalizedDimsBySize(parallel_exec_domain, tensorRank);
+
+    for (size_t i = 0; i < data_offsets.size(); i++) {
+        data_offsets[i] = config->io_data_offsets[i];
+        data_offsets[i].insert(data_offsets[i].begin(), tensorRank - 1 - data_offsets[i].size(), 0);
+    }
+
+    const auto& loop_descriptors = config->loop_descriptors;
+    loop_args.clear();
+    loop_args.resize(loop_descriptors.empty() ? 0 : loop_descriptors.rbegin()->first + 1);
+    for (const auto& loop : loop_descriptors) {
+        const auto& desc = loop.second;
+        loop_args[loop.first] = jit_snippets_call_args::loop_args_t(desc.work_amount, desc.ptr_increments, desc.finalization_offsets);
+    }
+    return true;
+}
+
+void Snippet::SnippetJitDynamicExecutor::exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+    if (schedule.lowering_result.compiled_snippet->empty()) {
+        OPENVINO_THROW("Snippet can't use Optimized implementation and can't fallback to reference");
+    }
+    for (size_t i = 0; i < numInput; i++) {
+        start_offset_in[i] =
+                static_cast<ptrdiff_t>(inMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i]);
+    }
+    for (size_t i = 0; i < numOutput; i++) {
+        start_offset_out[i] =
+                static_cast<ptrdiff_t>(outMemPtrs[i]->getDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i + numInput]);
+    }
+
+    const auto& work_size = parallel_exec_domain;
+    const auto& callable = schedule.get_callable<kernel>();
+#if defined(__linux__) && defined(OPENVINO_ARCH_X86_64) && defined(SNIPPETS_DEBUG_CAPS)
+    segfault_detector();
+#endif
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        jit_snippets_call_args call_args;
+        call_args.register_loops(loop_args);
+
+        size_t start = 0, end = 0;
+        splitter(harnessWorkAmount, nthr, ithr, start, end);
+
+        std::vector<size_t> indexes(work_size.size() - 1, 0);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            size_t tmp = iwork;
+            for (ptrdiff_t j = static_cast<ptrdiff_t>(work_size.size()) - 2; j >= 0; j--) {
+                indexes[j] = tmp % work_size[j];
+                tmp /= work_size[j];
+            }
+            // The shape-agnostic kernel doesn't calculate the data offsets, so the data pointers are shifted here
+            for (size_t i = 0; i < numInput; i++) {
+                auto ptr = inMemPtrs[i]->getDataAs<const uint8_t>() + start_offset_in[i];
+                for (size_t j = 0; j < indexes.size(); j++)
+                    ptr += indexes[j] * data_offsets[i][j];
+                call_args.src_ptrs[i] = ptr;
+            }
+            for (size_t i = 0; i < numOutput; i++) {
+                auto ptr = outMemPtrs[i]->getDataAs<uint8_t>() + start_offset_out[i];
+                for (size_t j = 0; j < indexes.size(); j++)
+                    ptr += indexes[j] * data_offsets[i + numInput][j];
+                call_args.dst_ptrs[i] = ptr;
+            }
+
+            callable(&call_args, nullptr);
+        }
+    });
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
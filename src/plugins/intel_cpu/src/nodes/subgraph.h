@@ -4,10 +4,18 @@
 
 #pragma once
 
-#include "emitters/snippets/x64/jit_kernel_emitter.hpp"
+#include "emitters/snippets/jit_snippets_call_args.hpp"
 #include "node.h"
 #include "onednn/dnnl.h"
 #include "snippets/op/subgraph.hpp"
+#include "snippets/runtime_configurator.hpp"
+#include "snippets_tuning_cache.h"
+
+#if defined(OPENVINO_ARCH_ARM64)
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#else
+#include "cpu/x64/cpu_isa_traits.hpp"
+#endif
 
 #include <array>
 
@@ -52,24 +60,37 @@ public:
         std::vector<ov::element::Type> outMemPrecs;
         // todo: used flag if we need extra shape infer, can be removed after [121670]
         bool has_non_planar_inputs;
+        // block sizes of the kernel loops selected by the autotuning
+        SnippetsTuningCache::Params tuningParams;
     };
 
 private:
     typedef void (*kernel)(const void *, const void *);
 
     static uint64_t get_body_hash(const std::shared_ptr<snippets::op::Subgraph>& snippet);
+    // Benchmarks the tuning candidates on the current shapes and selects the fastest one,
+    // the results are shared via the tuning cache of the compiled model
+    void tuneBlockingParams();
 
     size_t inputNum = 0;
     size_t outputNum = 0;
 
     // Holds ISA version used is codeGeneration target
+#if defined(OPENVINO_ARCH_ARM64)
+    dnnl::impl::cpu::aarch64::cpu_isa_t host_isa;
+#else
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
+#endif
 
     std::vector<MemoryPtr> srcMemPtrs = {};
     std::vector<MemoryPtr> dstMemPtrs = {};
 
     mutable SnippetAttrs snippetAttrs;
     bool is_dynamic = false;
+    // True if the single shape-agnostic kernel is used for all the input shapes
+    bool is_shape_agnostic = false;
+    // block sizes benchmarked by the autotuning, empty if the Subgraph isn't tuned
+    std::vector<SnippetsTuningCache::Params> tuningCandidates = {};
 
     class SnippetExecutor {
         public:
@@ -79,11 +100,20 @@ private:
             std::shared_ptr<IShapeInfer> shapeInference = nullptr;
 
         protected:
+            typedef void (*kernel)(const void *, const void *);
+
+            snippets::Schedule generate(const jit_snippets_compile_args*) const;
+#ifdef SNIPPETS_DEBUG_CAPS
+            inline void segfault_detector();
+#endif
+
             SnippetAttrs snippetAttrs;
             bool is_dynamic = false;
     };
 
     std::shared_ptr<SnippetExecutor> execPtr = nullptr;
+    // The shape-agnostic executor is not shared via the params cache, since its runtime parameters are updated per node
+    std::shared_ptr<SnippetExecutor> shapeAgnosticExecPtr = nullptr;
 
     class SnippetJitExecutor : public SnippetExecutor {
         public:
@@ -95,12 +125,9 @@ private:
         private:
             static const size_t rank6D {6};
 
-            typedef void (*kernel)(const void *, const void *);
-
             size_t numInput = 0;
             size_t numOutput = 0;
 
-            void generate(const jit_snippets_compile_args*);
             inline void update_ptrs(jit_snippets_call_args&, const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
             // Evaluates generated snippet using parallel backend
             void schedule_6d(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
@@ -125,10 +152,42 @@ private:
             // Buffer scratchpad
             std::vector<uint8_t> buffer_scratchpad = {};
             size_t buffer_scratchpad_size = 0;
+    };
 
-#ifdef SNIPPETS_DEBUG_CAPS
-            inline void segfault_detector();
-#endif
+    // Executes the kernel generated once for the undefined shapes: the work amounts of the loops and the data offsets
+    // are passed to the kernel at runtime, so there is no code generation on the input shapes change
+    class SnippetJitDynamicExecutor : public SnippetExecutor {
+        public:
+            SnippetJitDynamicExecutor(SnippetAttrs attrs,
+                                      const std::vector<VectorDims>& inTemplateDims,
+                                      const std::vector<VectorDims>& outTemplateDims);
+            void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) override;
+
+            // Returns false if the kernel can't process the input shapes,
+            // e.g. in the case of the runtime broadcasting by the last dimension
+            bool update(const std::vector<VectorDims>& inMemBlockedDims);
+            bool is_supported() const { return supported; }
+
+        private:
+            static const size_t rank6D {6};
+
+            size_t numInput = 0;
+            size_t numOutput = 0;
+            bool supported = true;
+            bool is_last_dim_dynamic = false;
+
+            snippets::Schedule schedule;
+            std::shared_ptr<snippets::RuntimeConfigurator> configurator = nullptr;
+
+            std::vector<size_t> parallel_exec_domain = {};
+            size_t harnessWorkAmount = 0;
+
+            std::vector<size_t> dataSize = {};
+            std::vector<ptrdiff_t> start_offset_in = {};
+            std::vector<ptrdiff_t> start_offset_out = {};
+            // byte offsets of the data pointers per each dimension of the parallel domain
+            std::vector<std::vector<size_t>> data_offsets = {};
+            std::vector<jit_snippets_call_args::loop_args_t> loop_args = {};
     };
 };
 
@@ -143,7 +143,7 @@ void Transpose::prepareParams() {
         auto dstMemPtr = getDstMemoryAtPort(0);
         auto dstDesc = dstMemPtr->getDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
         auto srcDesc = dnnl::memory::desc(dstDesc.get_dims(), dstDesc.get_data_type(), memory::format_tag::acdb);
-        auto result = getReorderPrim(context->getParamsCache(), getEngine(), srcDesc, dstDesc);
+        auto result = getReorderPrim(context->getSharedParamsCache(), getEngine(), srcDesc, dstDesc);
         if (!result) {
             OPENVINO_THROW("Reorder primitive descriptor was not found for Transpose node ", getName(), ".");
         }
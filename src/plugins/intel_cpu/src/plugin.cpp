@@ -11,6 +11,7 @@
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
+#include "scratch_pad_pool.h"
 #include "serialize.h"
 #include "transformations/transformation_pipeline.h"
 #include "transformations/utils/utils.hpp"
@@ -323,7 +324,9 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    auto compiled_model = std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    compiled_model->warm_up();
+    return compiled_model;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -415,6 +418,30 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
             engConfig.fcDynamicQuantizationGroupSize);
     } else if (name == ov::hint::kv_cache_precision) {
         return decltype(ov::hint::kv_cache_precision)::value_type(engConfig.kvCachePrecision);
+    } else if (name == ov::intel_cpu::kv_cache_page_size) {
+        return decltype(ov::intel_cpu::kv_cache_page_size)::value_type(engConfig.kvCachePageSize);
+    } else if (name == ov::intel_cpu::kv_cache_group_size) {
+        return decltype(ov::intel_cpu::kv_cache_group_size)::value_type(engConfig.kvCacheGroupSize);
+    } else if (name == ov::intel_cpu::dataflow_execution) {
+        return decltype(ov::intel_cpu::dataflow_execution)::value_type(engConfig.dataflowExecution);
+    } else if (name == ov::intel_cpu::execution_plan_replay) {
+        return decltype(ov::intel_cpu::execution_plan_replay)::value_type(engConfig.executionPlanReplay);
+    } else if (name == ov::intel_cpu::activation_memory_budget) {
+        return decltype(ov::intel_cpu::activation_memory_budget)::value_type(engConfig.activationMemoryBudget);
+    } else if (name == ov::intel_cpu::shared_scratchpad) {
+        return decltype(ov::intel_cpu::shared_scratchpad)::value_type(engConfig.sharedScratchPad);
+    } else if (name == ov::intel_cpu::cross_model_weights_sharing) {
+        return decltype(ov::intel_cpu::cross_model_weights_sharing)::value_type(engConfig.crossModelWeightsSharing);
+    } else if (name == ov::intel_cpu::snippets_autotuning) {
+        return decltype(ov::intel_cpu::snippets_autotuning)::value_type(engConfig.snippetsAutotuning);
+    } else if (name == ov::intel_cpu::shape_warm_up) {
+        return decltype(ov::intel_cpu::shape_warm_up)::value_type(engConfig.shapeWarmUp);
+    } else if (name == ov::cache_dir) {
+        return decltype(ov::cache_dir)::value_type(engConfig.cacheDir);
+    } else if (name == ov::cache_mode) {
+        return decltype(ov::cache_mode)::value_type(engConfig.cacheMode);
+    } else if (name == ov::weights_path) {
+        return decltype(ov::weights_path)::value_type(engConfig.weightsPath);
     }
     return get_ro_property(name, options);
 }
@@ -438,6 +465,8 @@ ov::Any Plugin::get_ro_property(const std::string& name, const ov::AnyMap& optio
             RO_property(ov::device::capabilities.name()),
             RO_property(ov::device::type.name()),
             RO_property(ov::device::architecture.name()),
+            RO_property(ov::intel_cpu::scratchpad_pool_size.name()),
+            RO_property(ov::intel_cpu::shared_weights_size.name()),
         };
         // the whole config is RW before model is loaded.
         std::vector<ov::PropertyName> rwProperties{
@@ -458,6 +487,18 @@ ov::Any Plugin::get_ro_property(const std::string& name, const ov::AnyMap& optio
             RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
             RW_property(ov::hint::dynamic_quantization_group_size.name()),
             RW_property(ov::hint::kv_cache_precision.name()),
+            RW_property(ov::intel_cpu::kv_cache_page_size.name()),
+            RW_property(ov::intel_cpu::kv_cache_group_size.name()),
+            RW_property(ov::intel_cpu::dataflow_execution.name()),
+            RW_property(ov::intel_cpu::execution_plan_replay.name()),
+            RW_property(ov::intel_cpu::activation_memory_budget.name()),
+            RW_property(ov::intel_cpu::shared_scratchpad.name()),
+            RW_property(ov::intel_cpu::cross_model_weights_sharing.name()),
+            RW_property(ov::intel_cpu::snippets_autotuning.name()),
+            RW_property(ov::intel_cpu::shape_warm_up.name()),
+            RW_property(ov::cache_dir.name()),
+            RW_property(ov::cache_mode.name()),
+            RW_property(ov::weights_path.name()),
         };
 
         OPENVINO_SUPPRESS_DEPRECATED_START
@@ -476,7 +517,8 @@ ov::Any Plugin::get_ro_property(const std::string& name, const ov::AnyMap& optio
             ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties_supported.name(),
-                             ov::PropertyMutability::RO}};
+                             ov::PropertyMutability::RO},
+            ov::PropertyName{ov::internal::caching_with_mmap.name(), ov::PropertyMutability::RO}};
     } else if (name == ov::device::full_name) {
         return decltype(ov::device::full_name)::value_type(deviceFullName);
     } else if (name == ov::available_devices) {
@@ -503,14 +545,21 @@ ov::Any Plugin::get_ro_property(const std::string& name, const ov::AnyMap& optio
         const std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         return decltype(ov::range_for_streams)::value_type(range);
     } else if (name == ov::internal::caching_properties) {
-        std::vector<ov::PropertyName> cachingProperties = {ov::device::full_name};
+        std::vector<ov::PropertyName> cachingProperties = {ov::device::full_name, ov::cache_mode};
         return decltype(ov::internal::caching_properties)::value_type(std::move(cachingProperties));
+    } else if (name == ov::internal::caching_with_mmap) {
+        return decltype(ov::internal::caching_with_mmap)::value_type(true);
     } else if (name == ov::intel_cpu::denormals_optimization) {
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(engConfig.denormalsOptMode ==
                                                                            Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(
             engConfig.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::scratchpad_pool_size) {
+        return decltype(ov::intel_cpu::scratchpad_pool_size)::value_type(ScratchPadPool::getInstance().getSize());
+    } else if (name == ov::intel_cpu::shared_weights_size) {
+        return decltype(ov::intel_cpu::shared_weights_size)::value_type(
+            SocketsWeights::getProcessWeights().getSize());
     } else if (name == ov::execution_devices) {
         return decltype(ov::execution_devices)::value_type{get_device_name()};
     } else if (name == ov::device::type) {
@@ -583,16 +632,6 @@ ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>&
 std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& networkModel, const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "import_model");
 
-    ModelDeserializer deserializer(networkModel, [this](const std::string& model, const ov::Tensor& weights) {
-        return get_core()->read_model(model, weights, true);
-    });
-
-    std::shared_ptr<ov::Model> model;
-    deserializer >> model;
-
-    Config conf = engConfig;
-    Config::ModelType modelType = getModelType(model);
-
     // check ov::loaded_from_cache property and erase it to avoid exception in readProperties.
     auto _config = config;
     const auto& it = _config.find(ov::loaded_from_cache.name());
@@ -601,11 +640,50 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& networkMo
         loaded_from_cache = it->second.as<bool>();
         _config.erase(it);
     }
+
+    // the memory mapped cache blob, the model constants are created as views into it
+    std::shared_ptr<ov::AlignedBuffer> model_buffer;
+    const auto& buffer_it = _config.find(ov::internal::cached_model_buffer.name());
+    if (buffer_it != _config.end()) {
+        model_buffer = buffer_it->second.as<std::shared_ptr<ov::AlignedBuffer>>();
+        _config.erase(buffer_it);
+    }
+
+    // the model exported without weights refers to the original weights file
+    std::string weights_path = engConfig.weightsPath;
+    const auto& weights_path_it = _config.find(ov::weights_path.name());
+    if (weights_path_it != _config.end()) {
+        weights_path = weights_path_it->second.as<std::string>();
+    }
+
+    // the results of the snippets autotuning are restored only if the autotuning is enabled for the imported model
+    bool snippets_autotuning = engConfig.snippetsAutotuning;
+    const auto& autotuning_it = _config.find(ov::intel_cpu::snippets_autotuning.name());
+    if (autotuning_it != _config.end()) {
+        snippets_autotuning = autotuning_it->second.as<bool>();
+    }
+    auto snippets_tuning_cache = snippets_autotuning ? std::make_shared<SnippetsTuningCache>() : nullptr;
+    ModelDeserializer deserializer(
+        networkModel,
+        [this](const std::string& model, const ov::Tensor& weights) {
+            return get_core()->read_model(model, weights, true);
+        },
+        std::move(model_buffer),
+        std::move(weights_path),
+        snippets_tuning_cache);
+
+    std::shared_ptr<ov::Model> model;
+    deserializer >> model;
+
+    Config conf = engConfig;
+    Config::ModelType modelType = getModelType(model);
     conf.readProperties(_config, modelType);
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model =
+        std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache, snippets_tuning_cache);
+    compiled_model->warm_up();
     return compiled_model;
 }
 }  // namespace intel_cpu
@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scratch_pad_pool.h"
+
+#include <algorithm>
+
+namespace ov {
+namespace intel_cpu {
+
+ScratchPadPool& ScratchPadPool::getInstance() {
+    static ScratchPadPool pool;
+    return pool;
+}
+
+ScratchPadPool::EntryPtr ScratchPadPool::get(const dnnl::engine& eng, int numaNode, std::vector<int> cpuIds) {
+    std::sort(cpuIds.begin(), cpuIds.end());
+    Key key{numaNode, std::move(cpuIds)};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->second.expired()) {
+            it = m_entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto& weakEntry = m_entries[key];
+    auto entry = weakEntry.lock();
+    if (!entry) {
+        entry = std::make_shared<Entry>(eng, numaNode);
+        weakEntry = entry;
+    }
+    return entry;
+}
+
+size_t ScratchPadPool::getSize() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t size = 0;
+    for (const auto& item : m_entries) {
+        if (auto entry = item.second.lock()) {
+            size += entry->scratchPad->getSize();
+        }
+    }
+    return size;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
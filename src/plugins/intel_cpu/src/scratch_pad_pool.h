@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "dnnl_scratch_pad.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Process level pool of the scratch pads shared by the streams bound to the same cores.
+ *
+ * The streams of the different compiled models pinned to the same set of cores of a NUMA node compete for these
+ * cores anyway, so they may take turns to use one scratch pad sized to the biggest one required instead of holding
+ * their own worst-case buffers. The scratch pad is released when the last graph using it is destroyed.
+ *
+ * @note The buffer may be reallocated by any of the sharing graphs when it creates a primitive with a bigger
+ * scratch pad, so a graph must hold the mutex of the entry while it creates the primitives or runs the inference.
+ */
+class ScratchPadPool {
+public:
+    struct Entry {
+        Entry(const dnnl::engine& eng, int numaNode)
+            : scratchPad(std::make_shared<DnnlScratchPad>(eng, numaNode)) {}
+
+        DnnlScratchPadPtr scratchPad;
+        std::mutex mutex;
+    };
+    using EntryPtr = std::shared_ptr<Entry>;
+
+    static ScratchPadPool& getInstance();
+
+    /**
+     * @brief Returns the scratch pad shared by the streams executed on the cores cpuIds of the NUMA node numaNode
+     */
+    EntryPtr get(const dnnl::engine& eng, int numaNode, std::vector<int> cpuIds);
+
+    /**
+     * @return the sum of the sizes in bytes of the scratch pads in use
+     */
+    size_t getSize() const;
+
+private:
+    using Key = std::pair<int, std::vector<int>>;
+
+    mutable std::mutex m_mutex;
+    std::map<Key, std::weak_ptr<Entry>> m_entries;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -3,14 +3,188 @@
 //
 #include "serialize.h"
 
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <pugixml.hpp>
 
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "transformations/rt_info/weightless_caching_attributes.hpp"
 #include "transformations/utils/utils.hpp"
+#include "utils/data_hash.hpp"
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+// The smaller constants are always stored in the blob. Their values may be required by the shape inference
+// when the model is read (e.g. the target shape of Reshape), while the weights are large.
+constexpr size_t weightlessMinByteSize = 4096;
+constexpr const char* weightlessNamePrefix = "weightless_const_";
+// the constants section starts at the cache line boundary of the blob, so the constants used in place from
+// the memory mapped blob keep the alignment of their offsets in the section
+constexpr size_t constsAlignment = 64;
+
+struct WeightlessConstant {
+    std::string name;
+    size_t offset;
+    size_t size;
+    uint64_t hash;
+};
+
+bool isWeightless(const std::shared_ptr<ov::op::v0::Constant>& constant) {
+    const auto& rtInfo = constant->get_rt_info();
+    const auto it = rtInfo.find(ov::WeightlessCacheAttribute::get_type_info_static());
+    if (it == rtInfo.end())
+        return false;
+    // the weights are real or low precision data, while the wide integers are usually shapes and indices
+    const auto& type = constant->get_element_type();
+    if (!type.is_real() && type.bitwidth() > 8)
+        return false;
+    const auto& attr = it->second.as<ov::WeightlessCacheAttribute>();
+    return attr.original_dtype == type && attr.original_size == constant->get_byte_size() &&
+           attr.original_size >= weightlessMinByteSize;
+}
+
+// Each constant loaded from the weights file is replaced with the broadcasted scalar of the same type and shape,
+// so the blob keeps only the reference to the constant data, which is restored on import.
+std::vector<WeightlessConstant> replaceWeightlessConstants(const std::shared_ptr<ov::Model>& model) {
+    std::vector<WeightlessConstant> constants;
+    for (const auto& op : model->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (!constant || !isWeightless(constant))
+            continue;
+
+        const auto& attr = constant->get_rt_info().at(ov::WeightlessCacheAttribute::get_type_info_static())
+                               .as<ov::WeightlessCacheAttribute>();
+        const auto& shape = constant->get_shape();
+        auto stub = std::make_shared<ov::op::v3::Broadcast>(
+            std::make_shared<ov::op::v0::Constant>(constant->get_element_type(), ov::Shape{}, 0),
+            ov::op::v0::Constant::create(ov::element::i64, ov::Shape{shape.size()}, shape));
+        stub->set_friendly_name(weightlessNamePrefix + std::to_string(constants.size()));
+        stub->get_rt_info() = constant->get_rt_info();
+        constant->output(0).replace(stub->output(0));
+
+        constants.push_back({constant->get_friendly_name(),
+                             attr.bin_offset,
+                             attr.original_size,
+                             hashData(constant->get_data_ptr(), attr.original_size)});
+    }
+    return constants;
+}
+
+void restoreWeightlessConstants(const pugi::xml_node& weightless,
+                                const std::string& weightsPath,
+                                const std::shared_ptr<ov::Model>& model) {
+    OPENVINO_ASSERT(!weightsPath.empty(), "The model is exported without weights, ov::weights_path is required");
+    const auto binSize = static_cast<int64_t>(weightless.attribute("bin_size").as_ullong());
+    OPENVINO_ASSERT(ov::util::file_size(weightsPath) == binSize,
+                    "The weights file ",
+                    weightsPath,
+                    " doesn't match the weights of the exported model");
+
+    std::unordered_map<std::string, pugi::xml_node> constants;
+    for (const auto& node : weightless.children("const")) {
+        constants.emplace(node.attribute("id").value(), node);
+    }
+
+    auto mmap = ov::load_mmap_object(weightsPath);
+    size_t restored = 0;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (!ov::is_type<ov::op::v3::Broadcast>(op))
+            continue;
+        const auto it = constants.find(op->get_friendly_name());
+        if (it == constants.end())
+            continue;
+
+        const size_t offset = it->second.attribute("offset").as_ullong();
+        const size_t size = it->second.attribute("size").as_ullong();
+        const auto& type = op->get_output_element_type(0);
+        const auto& shape = op->get_output_shape(0);
+        OPENVINO_ASSERT(offset <= mmap->size() && size <= mmap->size() - offset &&
+                            size == (ov::shape_size(shape) * type.bitwidth() + 7) / 8,
+                        "Incorrect weights reference of ",
+                        it->second.attribute("name").value());
+        // the file of the same size may be rewritten with the other weights (e.g. the fine-tuned model)
+        OPENVINO_ASSERT(hashData(mmap->data() + offset, size) == it->second.attribute("hash").as_ullong(),
+                        "The weights file ",
+                        weightsPath,
+                        " doesn't match the weights of the exported model: ",
+                        it->second.attribute("name").value(),
+                        " is changed");
+
+        auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mmap->data() + offset,
+                                                                                           size,
+                                                                                           mmap);
+        auto constant = std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
+        constant->set_friendly_name(it->second.attribute("name").value());
+        constant->get_rt_info() = op->get_rt_info();
+        constant->get_rt_info()[ov::WeightlessCacheAttribute::get_type_info_static()] =
+            ov::WeightlessCacheAttribute(size, offset, type);
+        op->output(0).replace(constant->output(0));
+        restored++;
+    }
+    OPENVINO_ASSERT(restored == constants.size(),
+                    "Failed to restore the weights of the model exported without weights");
+}
+}  // namespace
+
+// the records are stored as <snippets_tuning isa=""><kernel key="" m="" n="" k=""/>...</snippets_tuning>,
+// the block size 0 keeps the value selected by the heuristics
+static void storeTuningRecords(pugi::xml_node& root, const SnippetsTuningCache& cache) {
+    const auto records = cache.getRecords();
+    if (records.empty())
+        return;
+    pugi::xml_node tuning = root.append_child("snippets_tuning");
+    tuning.append_attribute("isa").set_value(static_cast<unsigned>(dnnl::get_effective_cpu_isa()));
+    for (const auto& record : records) {
+        auto kernel = tuning.append_child("kernel");
+        kernel.append_attribute("key").set_value(static_cast<unsigned long long>(record.first));
+        kernel.append_attribute("m").set_value(static_cast<unsigned long long>(record.second.blockM));
+        kernel.append_attribute("n").set_value(static_cast<unsigned long long>(record.second.blockN));
+        kernel.append_attribute("k").set_value(static_cast<unsigned long long>(record.second.blockK));
+    }
+}
+
+// pugixml returns 0 for the missing or malformed attribute, which is a valid block size,
+// so the value is parsed explicitly
+static bool readTuningAttribute(const pugi::xml_node& kernel, const char* name, uint64_t& value) {
+    const char* str = kernel.attribute(name).value();
+    if (!std::isdigit(static_cast<unsigned char>(str[0])))
+        return false;
+    char* end = nullptr;
+    errno = 0;
+    value = std::strtoull(str, &end, 10);
+    return errno == 0 && *end == '\0';
+}
+
+static void restoreTuningRecords(const pugi::xml_node& root, SnippetsTuningCache& cache) {
+    const pugi::xml_node tuning = root.child("snippets_tuning");
+    // the block sizes are measured with the kernels generated for the ISA of the exporting machine
+    const auto isa = tuning.attribute("isa");
+    if (!isa || isa.as_uint() != static_cast<unsigned>(dnnl::get_effective_cpu_isa()))
+        return;
+    for (const auto& kernel : tuning.children("kernel")) {
+        uint64_t key = 0, m = 0, n = 0, k = 0;
+        // the malformed record is skipped, the kernel is tuned again
+        if (!readTuningAttribute(kernel, "key", key) || !readTuningAttribute(kernel, "m", m) ||
+            !readTuningAttribute(kernel, "n", n) || !readTuningAttribute(kernel, "k", k))
+            continue;
+        SnippetsTuningCache::Params params;
+        params.blockM = m;
+        params.blockN = n;
+        params.blockK = k;
+        cache.record(key, params);
+    }
+}
+
 static void setInfo(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {
     pugi::xml_node outputs = root.child("outputs");
     auto nodes_it = outputs.children("out").begin();
@@ -24,9 +198,18 @@ static void setInfo(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {
     }
 }
 
-ModelSerializer::ModelSerializer(std::ostream& ostream) : _ostream(ostream) {}
+ModelSerializer::ModelSerializer(std::ostream& ostream, std::string weights_path, SnippetsTuningCache::Ptr tuning_cache)
+    : _ostream(ostream)
+    , _weights_path(std::move(weights_path))
+    , _tuning_cache(std::move(tuning_cache)) {}
 
 void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
+    auto clonedModel = model->clone();
+    std::vector<WeightlessConstant> weightlessConstants;
+    if (!_weights_path.empty() && ov::util::file_exists(_weights_path)) {
+        weightlessConstants = replaceWeightlessConstants(clonedModel);
+    }
+
     auto serializeInfo = [&](std::ostream& stream) {
         const std::string name = "cnndata";
         pugi::xml_document xml_doc;
@@ -37,16 +220,47 @@ void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
             const std::string name = ov::descriptor::get_ov_tensor_legacy_name(out->input_value(0).get_tensor());
             out_node.append_attribute("name").set_value(name.c_str());
         }
+        if (!weightlessConstants.empty()) {
+            pugi::xml_node weightless = root.append_child("weightless");
+            weightless.append_attribute("bin_size").set_value(
+                static_cast<unsigned long long>(ov::util::file_size(_weights_path)));
+            for (size_t i = 0; i < weightlessConstants.size(); i++) {
+                auto const_node = weightless.append_child("const");
+                const_node.append_attribute("id").set_value((weightlessNamePrefix + std::to_string(i)).c_str());
+                const_node.append_attribute("name").set_value(weightlessConstants[i].name.c_str());
+                const_node.append_attribute("offset").set_value(
+                    static_cast<unsigned long long>(weightlessConstants[i].offset));
+                const_node.append_attribute("size").set_value(
+                    static_cast<unsigned long long>(weightlessConstants[i].size));
+                const_node.append_attribute("hash").set_value(
+                    static_cast<unsigned long long>(weightlessConstants[i].hash));
+            }
+        }
+        if (_tuning_cache) {
+            storeTuningRecords(root, *_tuning_cache);
+        }
         xml_doc.save(stream);
+        // the custom data is followed by the constants, the padding is a trailing whitespace of the xml document
+        const auto pos = stream.tellp();
+        if (pos >= 0 && static_cast<size_t>(pos) % constsAlignment) {
+            stream << std::string(constsAlignment - static_cast<size_t>(pos) % constsAlignment, ' ');
+        }
     };
 
     ov::pass::StreamSerialize serializer(_ostream, serializeInfo);
-    serializer.run_on_model(std::const_pointer_cast<ov::Model>(model->clone()));
+    serializer.run_on_model(clonedModel);
 }
 
-ModelDeserializer::ModelDeserializer(std::istream & istream, model_builder fn)
+ModelDeserializer::ModelDeserializer(std::istream & istream,
+                                     model_builder fn,
+                                     std::shared_ptr<ov::AlignedBuffer> model_buffer,
+                                     std::string weights_path,
+                                     SnippetsTuningCache::Ptr tuning_cache)
     : _istream(istream)
-    , _model_builder(fn) {
+    , _model_builder(fn)
+    , _model_buffer(std::move(model_buffer))
+    , _weights_path(std::move(weights_path))
+    , _tuning_cache(std::move(tuning_cache)) {
 }
 
 void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
@@ -90,8 +304,19 @@ void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = ov::Tensor(ov::element::u8, ov::Shape({hdr.consts_size}));
-        _istream.read(static_cast<char *>(dataBlob.data(ov::element::u8)), hdr.consts_size);
+        if (_model_buffer) {
+            // the stream offsets are the offsets in the buffer, so the weights are used in place
+            // and the tensor keeps the buffer alive as long as the model constants refer to it
+            OPENVINO_ASSERT(hdr.consts_offset + hdr.consts_size <= _model_buffer->size(),
+                            "Failed to read CPU device blob: the constants are out of the model buffer");
+            auto view = ov::make_tensor(ov::element::u8,
+                                        ov::Shape({hdr.consts_size}),
+                                        _model_buffer->get_ptr<char>() + hdr.consts_offset);
+            dataBlob = ov::make_tensor(ov::SoPtr<ov::ITensor>{view, _model_buffer});
+        } else {
+            dataBlob = ov::Tensor(ov::element::u8, ov::Shape({hdr.consts_size}));
+            _istream.read(static_cast<char *>(dataBlob.data(ov::element::u8)), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -101,9 +326,23 @@ void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
 
     model = _model_builder(xmlString, std::move(dataBlob));
 
+    // the references to the blob data are meaningless outside of the blob
+    for (const auto& op : model->get_ordered_ops()) {
+        op->get_rt_info().erase(ov::WeightlessCacheAttribute::get_type_info_static());
+    }
+
     // Set Info
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
     setInfo(root, model);
+
+    pugi::xml_node weightless = root.child("weightless");
+    if (weightless) {
+        restoreWeightlessConstants(weightless, _weights_path, model);
+    }
+
+    if (_tuning_cache) {
+        restoreTuningRecords(root, *_tuning_cache);
+    }
 }
 
 }   // namespace intel_cpu
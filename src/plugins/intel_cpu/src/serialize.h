@@ -9,29 +9,53 @@
 #include <string>
 
 #include "openvino/core/model.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "snippets_tuning_cache.h"
 
 namespace ov {
 namespace intel_cpu {
 
 class ModelSerializer {
 public:
-    ModelSerializer(std::ostream& ostream);
+    /**
+     * @param weights_path optional path to the original weights file of the model, if it is passed the constants
+     * loaded from this file are stored as the references to the file data instead of the data itself
+     * @param tuning_cache optional results of the snippets autotuning, which are stored in the blob
+     */
+    ModelSerializer(std::ostream& ostream,
+                    std::string weights_path = {},
+                    SnippetsTuningCache::Ptr tuning_cache = nullptr);
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
 private:
     std::ostream& _ostream;
+    std::string _weights_path;
+    SnippetsTuningCache::Ptr _tuning_cache;
 };
 
 class ModelDeserializer {
 public:
     typedef std::function<std::shared_ptr<ov::Model>(const std::string&, const ov::Tensor&)> model_builder;
-    ModelDeserializer(std::istream& istream, model_builder fn);
+    /**
+     * @param model_buffer optional buffer the istream reads from (e.g. the memory mapped cache blob),
+     * if it is passed the model constants are created as views into the buffer instead of being read from the stream
+     * @param weights_path path to the original weights file, required to import the model exported without weights
+     * @param tuning_cache optional cache to restore the results of the snippets autotuning stored in the blob
+     */
+    ModelDeserializer(std::istream& istream,
+                      model_builder fn,
+                      std::shared_ptr<ov::AlignedBuffer> model_buffer = nullptr,
+                      std::string weights_path = {},
+                      SnippetsTuningCache::Ptr tuning_cache = nullptr);
     void operator>>(std::shared_ptr<ov::Model>& model);
 
 private:
     std::istream& _istream;
     model_builder _model_builder;
+    std::shared_ptr<ov::AlignedBuffer> _model_buffer;
+    std::string _weights_path;
+    SnippetsTuningCache::Ptr _tuning_cache;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,205 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_profile_cache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// the file contains one profile per line starting from the most recently used: inputs_number, then rank and dims
+// of each input shape
+constexpr const char* fileSignature = "CPU_SHAPE_PROFILES_V2";
+// the frequently added profiles are written to the file at most once per interval
+constexpr std::chrono::seconds minWriteInterval{1};
+
+int processId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return static_cast<int>(getpid());
+#endif
+}
+
+// the kernels depend on the shapes and the operations, not on the values of the weights, which are not hashed
+// to keep the compilation of the big models fast
+size_t topologyHash(const std::shared_ptr<const ov::Model>& model) {
+    std::unordered_map<const ov::Node*, size_t> ids;
+    std::vector<size_t> items;
+    for (const auto& node : model->get_ordered_ops()) {
+        const auto& typeInfo = node->get_type_info();
+        items.push_back(std::hash<std::string>{}(typeInfo.name));
+        items.push_back(std::hash<std::string>{}(typeInfo.version_id ? typeInfo.version_id : ""));
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            items.push_back(ids.at(source.get_node()));
+            items.push_back(source.get_index());
+        }
+        for (const auto& output : node->outputs()) {
+            const auto& shape = output.get_partial_shape();
+            items.push_back(output.get_element_type().hash());
+            items.push_back(shape.rank().is_static() ? shape.size() : SIZE_MAX);
+            if (shape.rank().is_dynamic())
+                continue;
+            for (const auto& dim : shape) {
+                items.push_back(static_cast<size_t>(dim.get_min_length()));
+                items.push_back(static_cast<size_t>(dim.get_max_length()));
+            }
+        }
+        ids.emplace(node.get(), ids.size());
+    }
+    return ov::util::hash_combine(items);
+}
+}  // namespace
+
+ShapeProfileCache::ShapeProfileCache(const std::string& cacheDir, const std::shared_ptr<const ov::Model>& model) {
+    ov::util::create_directory_recursive(cacheDir);
+    m_path = ov::util::path_join({cacheDir, std::to_string(topologyHash(model)) + ".cpu_shapes"});
+    load();
+}
+
+ShapeProfileCache::~ShapeProfileCache() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_one();
+    if (m_writer.joinable()) {
+        m_writer.join();
+    } else if (m_changed) {
+        save({m_profiles.begin(), m_profiles.end()});
+    }
+}
+
+void ShapeProfileCache::record(const Profile& profile) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = std::find(m_profiles.begin(), m_profiles.end(), profile);
+    if (it != m_profiles.end()) {
+        if (it != m_profiles.begin()) {
+            m_profiles.splice(m_profiles.begin(), m_profiles, it);
+            m_changed = true;
+        }
+        return;
+    }
+
+    if (m_profiles.size() >= maxProfiles)
+        m_profiles.pop_back();
+    m_profiles.push_front(profile);
+    m_changed = m_added = true;
+    if (!m_writer.joinable()) {
+        m_writer = std::thread(&ShapeProfileCache::writeLoop, this);
+    } else {
+        m_cond.notify_one();
+    }
+}
+
+std::vector<ShapeProfileCache::Profile> ShapeProfileCache::getProfiles() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {m_profiles.begin(), m_profiles.end()};
+}
+
+void ShapeProfileCache::writeLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cond.wait(lock, [&] {
+            return m_stop || m_added;
+        });
+        if (!m_changed)
+            return;
+        std::vector<Profile> profiles(m_profiles.begin(), m_profiles.end());
+        m_changed = m_added = false;
+        lock.unlock();
+        save(profiles);
+        lock.lock();
+        m_cond.wait_for(lock, minWriteInterval, [&] {
+            return m_stop;
+        });
+    }
+}
+
+void ShapeProfileCache::load() {
+    std::ifstream file(m_path);
+    if (!file.is_open())
+        return;
+
+    std::string signature;
+    if (!std::getline(file, signature) || signature != fileSignature) {
+        DEBUG_LOG("Ignore the shape profile cache ", m_path, " with unknown format");
+        return;
+    }
+
+    std::string line;
+    while (std::getline(file, line) && m_profiles.size() < maxProfiles) {
+        std::istringstream strm(line);
+        size_t inputs = 0;
+        if (!(strm >> inputs))
+            continue;
+        Profile profile(inputs);
+        bool valid = true;
+        for (auto& shape : profile) {
+            size_t rank = 0;
+            valid = valid && static_cast<bool>(strm >> rank);
+            shape.resize(valid ? rank : 0);
+            for (auto& dim : shape) {
+                valid = valid && static_cast<bool>(strm >> dim);
+            }
+        }
+        // a corrupted line (e.g. written by a process interrupted in the middle) is skipped
+        if (valid && std::find(m_profiles.begin(), m_profiles.end(), profile) == m_profiles.end())
+            m_profiles.push_back(std::move(profile));
+    }
+}
+
+void ShapeProfileCache::save(const std::vector<Profile>& profiles) const {
+    // the file is replaced atomically, so the concurrent processes never read a partially written cache,
+    // the temporary file name is unique for each write of all the processes sharing the cache directory
+    static std::atomic<uint64_t> writeCounter{0};
+    const auto tmpPath = m_path + ".tmp" + std::to_string(processId()) + "_" + std::to_string(writeCounter++);
+    {
+        std::ofstream file(tmpPath, std::ios::trunc);
+        if (!file.is_open()) {
+            DEBUG_LOG("Unable to store the shape profile cache ", m_path);
+            return;
+        }
+        file << fileSignature << "\n";
+        for (const auto& profile : profiles) {
+            file << profile.size();
+            for (const auto& shape : profile) {
+                file << " " << shape.size();
+                for (const auto dim : shape) {
+                    file << " " << dim;
+                }
+            }
+            file << "\n";
+        }
+    }
+    if (std::rename(tmpPath.c_str(), m_path.c_str()) != 0) {
+        // rename doesn't replace the existing file on some platforms
+        std::remove(m_path.c_str());
+        if (std::rename(tmpPath.c_str(), m_path.c_str()) != 0)
+            std::remove(tmpPath.c_str());
+    }
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/shape.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Persistent list of the input shapes the dynamic model was recently executed with.
+ *
+ * The CPU JIT kernels and oneDNN primitives can't be serialized, so instead of the kernels the cache keeps
+ * the shapes which triggered their compilation. The list is stored in the cache directory next to the model blobs
+ * and is used on the next start to warm up the graphs, so the kernels are compiled before the first request.
+ * The file is identified by the hash of the model topology and shapes, the weights are not hashed.
+ * The new shapes are written to the file by a background thread, so the inferences never wait for the file I/O.
+ *
+ * @note The class is thread safe.
+ */
+class ShapeProfileCache {
+public:
+    using Ptr = std::shared_ptr<ShapeProfileCache>;
+    // shapes of all the model inputs in the order of the model parameters
+    using Profile = std::vector<ov::Shape>;
+
+    // the least recently used profile is replaced by a new one when the limit is reached
+    static constexpr size_t maxProfiles = 64;
+
+    /**
+     * @brief Loads the profiles of the model from the cache directory
+     */
+    ShapeProfileCache(const std::string& cacheDir, const std::shared_ptr<const ov::Model>& model);
+    /**
+     * @brief Waits for the pending write of the cache file
+     */
+    ~ShapeProfileCache();
+
+    ShapeProfileCache(const ShapeProfileCache&) = delete;
+    ShapeProfileCache& operator=(const ShapeProfileCache&) = delete;
+
+    /**
+     * @brief Marks the profile as the most recently used one, a new profile is added to the cache and scheduled
+     * to be written to the cache file
+     */
+    void record(const Profile& profile);
+
+    /**
+     * @return profiles ordered from the most recently used one
+     */
+    std::vector<Profile> getProfiles() const;
+
+    const std::string& getPath() const {
+        return m_path;
+    }
+
+private:
+    void load();
+    void save(const std::vector<Profile>& profiles) const;
+    void writeLoop();
+
+    std::string m_path;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::list<Profile> m_profiles;
+    // the order of the profiles differs from the file, it's stored with the next write
+    bool m_changed = false;
+    // a new profile is added, the file must be written
+    bool m_added = false;
+    bool m_stop = false;
+    // started by the first new profile
+    std::thread m_writer;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets_tuning_cache.h"
+
+namespace ov {
+namespace intel_cpu {
+
+bool SnippetsTuningCache::find(uint64_t key, Params& params) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_records.find(key);
+    if (it == m_records.end())
+        return false;
+    params = it->second;
+    return true;
+}
+
+void SnippetsTuningCache::record(uint64_t key, const Params& params) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the streams may tune the same kernel concurrently, the first result is kept
+    m_records.emplace(key, params);
+}
+
+std::map<uint64_t, SnippetsTuningCache::Params> SnippetsTuningCache::getRecords() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_records;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
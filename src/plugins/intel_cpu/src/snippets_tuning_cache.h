@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Results of the snippets kernels autotuning.
+ *
+ * The Subgraph node benchmarks the candidate blocking parameters of its kernel and records the fastest ones
+ * by the key built from the body, the shapes, the precisions and the ISA of the kernel. The records are shared
+ * by the streams of the compiled model and are exported with it, so the model imported from the cache blob
+ * skips the search. The blob is identified by the model and its weights, so the records can't be applied
+ * to another model.
+ *
+ * @note The class is thread safe.
+ */
+class SnippetsTuningCache {
+public:
+    using Ptr = std::shared_ptr<SnippetsTuningCache>;
+
+    // block sizes of the Brgemm loops, zero keeps the value selected by the heuristics
+    struct Params {
+        size_t blockM = 0;
+        size_t blockN = 0;
+        size_t blockK = 0;
+
+        bool operator==(const Params& rhs) const {
+            return blockM == rhs.blockM && blockN == rhs.blockN && blockK == rhs.blockK;
+        }
+    };
+
+    /**
+     * @brief Returns true and the tuned parameters if the kernel with the key has been tuned already
+     */
+    bool find(uint64_t key, Params& params) const;
+
+    /**
+     * @brief Adds the tuned parameters to the cache, the parameters already recorded for the key are kept
+     */
+    void record(uint64_t key, const Params& params);
+
+    /**
+     * @return all the records to be exported with the compiled model
+     */
+    std::map<uint64_t, Params> getRecords() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::map<uint64_t, Params> m_records;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
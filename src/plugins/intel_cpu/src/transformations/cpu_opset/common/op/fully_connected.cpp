@@ -13,10 +13,26 @@ ov::intel_cpu::FullyConnectedNode::FullyConnectedNode(const ov::Output<Node>& A,
     validate_and_infer_types();
 }
 
+ov::intel_cpu::FullyConnectedNode::FullyConnectedNode(const ov::Output<Node>& A,
+                                                     const ov::Output<Node>& B,
+                                                     const ov::Output<Node>& lora_a,
+                                                     const ov::Output<Node>& lora_alpha,
+                                                     const ov::Output<Node>& lora_b,
+                                                     const ov::Rank& output_rank,
+                                                     const ov::element::Type output_type)
+    : Op({A, B, lora_a, lora_alpha, lora_b}), m_output_rank(output_rank), m_output_type(output_type) {
+    validate_and_infer_types();
+}
+
 std::shared_ptr<ov::Node> ov::intel_cpu::FullyConnectedNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
     INTERNAL_OP_SCOPE(FullyConnectedNode_clone_with_new_inputs);
     check_new_args_count(this, new_args);
 
+    if (new_args.size() == 5) {
+        return std::make_shared<ov::intel_cpu::FullyConnectedNode>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                                   new_args.at(3), new_args.at(4), m_output_rank,
+                                                                   m_output_type);
+    }
     return std::make_shared<ov::intel_cpu::FullyConnectedNode>(new_args.at(0), new_args.at(1), m_output_rank, m_output_type);
 }
 
@@ -24,10 +40,10 @@ void ov::intel_cpu::FullyConnectedNode::validate_and_infer_types() {
     INTERNAL_OP_SCOPE(FullyConnectedNode_validate_and_infer_types);
     const auto input_size = get_input_size();
     NODE_VALIDATION_CHECK(this,
-        input_size == 2,
+        input_size == 2 || input_size == 5,
         "Number of inputs is incorrect. Current value is: ",
         input_size,
-        ", expected: 2.");
+        ", expected: 2 or 5.");
 
     // Weights shape: [O, I1, ..., Im];
     // O - output channels dimensions, Ik - input channels dimensions
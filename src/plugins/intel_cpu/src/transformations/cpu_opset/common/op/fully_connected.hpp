@@ -21,6 +21,19 @@ public:
                        const ov::Rank& output_rank,
                        const ov::element::Type output_type = ov::element::undefined);
 
+    /**
+     * @brief FullyConnected with the low-rank adapter (LoRA) correction: A * B + lora_b * (lora_alpha * (lora_a * A))
+     * The adapter matrices are the runtime inputs, so they can be switched (e.g. via the states) without
+     * recompilation while the weights B stay the same.
+     */
+    FullyConnectedNode(const ov::Output<Node> &A,
+                       const ov::Output<Node> &B,
+                       const ov::Output<Node> &lora_a,
+                       const ov::Output<Node> &lora_alpha,
+                       const ov::Output<Node> &lora_b,
+                       const ov::Rank& output_rank,
+                       const ov::element::Type output_type = ov::element::undefined);
+
     bool visit_attributes(ov::AttributeVisitor &visitor) override;
 
     void validate_and_infer_types() override;
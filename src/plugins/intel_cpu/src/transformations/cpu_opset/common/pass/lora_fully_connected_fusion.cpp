@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/cpu_opset/common/op/fully_connected.hpp"
+#include "lora_fully_connected_fusion.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "utils/general_utils.h"
+
+#include "itt.hpp"
+
+ov::intel_cpu::LoraFullyConnectedFusion::LoraFullyConnectedFusion() {
+    MATCHER_SCOPE(LoraFullyConnectedFusion);
+    using namespace ov::pass::pattern;
+
+    auto data_m = any_input(has_static_rank());
+    auto fc_m = wrap_type<ov::intel_cpu::FullyConnectedNode>({data_m, any_input()}, consumers_count(1));
+
+    auto lora_a_m = any_input(rank_equals(2));
+    auto matmul_a_m = wrap_type<ov::op::v0::MatMul>({data_m, lora_a_m}, consumers_count(1));
+    auto lora_alpha_m = any_input(has_static_rank());
+    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul_a_m, lora_alpha_m}, consumers_count(1));
+    auto lora_b_m = any_input(rank_equals(2));
+    auto matmul_b_m = wrap_type<ov::op::v0::MatMul>({multiply_m, lora_b_m}, consumers_count(1));
+    auto add_m = wrap_type<ov::op::v1::Add>({fc_m, matmul_b_m});
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto fc = ov::as_type_ptr<ov::intel_cpu::FullyConnectedNode>(pattern_map.at(fc_m).get_node_shared_ptr());
+        const auto add = pattern_map.at(add_m).get_node_shared_ptr();
+        if (!fc || transformation_callback(fc))
+            return false;
+
+        // the correction is computed in f32 on top of the floating point FullyConnected output
+        const auto data_type = pattern_map.at(data_m).get_element_type();
+        if (!one_of(data_type, ov::element::f32, ov::element::bf16, ov::element::f16) ||
+            add->get_output_element_type(0) != fc->get_output_element_type(0) ||
+            add->get_output_partial_shape(0) != fc->get_output_partial_shape(0))
+            return false;
+
+        for (const auto& matmul_m : {matmul_a_m, matmul_b_m}) {
+            const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+            if (!matmul || matmul->get_transpose_a() || !matmul->get_transpose_b())
+                return false;
+        }
+
+        // alpha scales the rank dimension only: [1, ..., 1, rank], or all of it by a single value
+        const auto& alpha_shape = pattern_map.at(lora_alpha_m).get_partial_shape();
+        for (size_t i = 0; i + 1 < alpha_shape.size(); i++) {
+            if (alpha_shape[i] != 1)
+                return false;
+        }
+        const auto& rank = pattern_map.at(lora_a_m).get_partial_shape()[0];
+        if (alpha_shape.size() > 0 && !alpha_shape.rbegin()->compatible(rank) && *alpha_shape.rbegin() != 1)
+            return false;
+
+        const auto lora_fc = std::make_shared<ov::intel_cpu::FullyConnectedNode>(fc->input_value(0),
+                                                                                 fc->input_value(1),
+                                                                                 pattern_map.at(lora_a_m),
+                                                                                 pattern_map.at(lora_alpha_m),
+                                                                                 pattern_map.at(lora_b_m),
+                                                                                 fc->get_output_rank(),
+                                                                                 fc->get_output_type());
+        lora_fc->set_friendly_name(add->get_friendly_name());
+        ov::copy_runtime_info({fc,
+                               pattern_map.at(matmul_a_m).get_node_shared_ptr(),
+                               pattern_map.at(multiply_m).get_node_shared_ptr(),
+                               pattern_map.at(matmul_b_m).get_node_shared_ptr(),
+                               add},
+                              lora_fc);
+        ov::replace_node(add, lora_fc);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(add_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *      LoraFullyConnectedFusion fuses the low-rank adapter (LoRA) branch into the FullyConnected it is added to.
+ *      The adapter matrices become the runtime inputs of the FullyConnected, so the adapters may be switched
+ *      (e.g. by setting the states they are read from) without recompilation while the weights stay shared.
+ *
+ * Before:
+ *
+ *            X    LoRA_A
+ *          / |    /
+ *         |  MatMul(transpose_b)
+ *         |    |
+ *         |  Multiply -- LoRA_alpha
+ *     W   |    |
+ *      \  |  MatMul(transpose_b) -- LoRA_B
+ *       \ |    |
+ *  FullyConnected
+ *         |    |
+ *          Add
+ *
+ * After:
+ *
+ *         X   W   LoRA_A   LoRA_alpha   LoRA_B
+ *          \   \     |         /         /
+ *               FullyConnected
+ */
+class LoraFullyConnectedFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("LoraFullyConnectedFusion", "0");
+    LoraFullyConnectedFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -13,6 +13,7 @@
 #include "common/pass/convert_to_power_static.hpp"
 #include "common/pass/convert_to_leaky_relu.hpp"
 #include "common/pass/convert_to_swish_cpu.hpp"
+#include "common/pass/lora_fully_connected_fusion.hpp"
 #include "common/pass/move_fc_reshape_to_weights.hpp"
 #include "common/pass/split_fc.hpp"
 #include "transformations/convert_precision.hpp"
@@ -38,6 +39,7 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ov::Model> &nGraphFunc, in
         CPU_REGISTER_PASS_COMMON(manager, SplitFC, subStreamNum);
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
     }
+    CPU_REGISTER_PASS_COMMON(manager, LoraFullyConnectedFusion);
     CPU_REGISTER_PASS_COMMON(manager, AlignMatMulInputRanks);
     CPU_REGISTER_PASS_COMMON(manager, ConvertTileToSeqTiles);
     CPU_REGISTER_PASS_COMMON(manager, ConvertToPowerStatic);
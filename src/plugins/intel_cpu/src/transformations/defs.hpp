@@ -68,5 +68,21 @@ namespace intel_cpu {
 
 #endif // OPENVINO_ARCH_ARM || OPENVINO_ARCH_ARM64
 
+#if defined(OPENVINO_ARCH_ARM64)
+
+#define CPU_REGISTER_PASS_ARM64(MANAGER, PASS, ...) CPU_REGISTER_PASS_COMMON(MANAGER, PASS, __VA_ARGS__)
+#define CPU_DISABLE_PASS_ARM64(MANAGER, PASS) CPU_DISABLE_PASS_COMMON(MANAGER, PASS)
+#define CPU_ENABLE_PASS_ARM64(MANAGER, PASS) CPU_ENABLE_PASS_COMMON(MANAGER, PASS)
+#define CPU_SET_CALLBACK_ARM64(MANAGER, CALLBACK, ...) CPU_SET_CALLBACK_COMMON(MANAGER, CALLBACK, __VA_ARGS__)
+
+#else
+
+#define CPU_REGISTER_PASS_ARM64(MANAGER, PASS, ...)
+#define CPU_DISABLE_PASS_ARM64(MANAGER, PASS)
+#define CPU_ENABLE_PASS_ARM64(MANAGER, PASS)
+#define CPU_SET_CALLBACK_ARM64(MANAGER, CALLBACK, ...)
+
+#endif // OPENVINO_ARCH_ARM64
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -23,7 +23,8 @@ using LoopInfo = snippets::lowered::LoopInfo;
 using ExpressionPtr = ov::snippets::lowered::ExpressionPtr;
 using namespace ov::snippets::lowered::pass;
 
-BrgemmBlocking::BrgemmBlocking() : RangedPass() {}
+BrgemmBlocking::BrgemmBlocking(size_t m_block_size, size_t n_block_size, size_t k_block_size)
+    : RangedPass(), m_m_block_size(m_block_size), m_n_block_size(n_block_size), m_k_block_size(k_block_size) {}
 
 void BrgemmBlocking::move_new_memory_buffer(snippets::lowered::LinearIR& linear_ir, const snippets::lowered::LinearIR::constExprIt& brgemm_it) {
     const auto& brgemm_expr = brgemm_it->get();
@@ -75,13 +76,18 @@ bool BrgemmBlocking::run(LinearIR& linear_ir, LinearIR::constExprIt begin, Linea
         const auto& in_1_planar_dims = ov::snippets::utils::get_planar_vdims(in_1_desc->get_shape(), in_1_desc->get_layout());
         const auto& out_preordered_dims = ov::snippets::utils::get_preordered_vdims(out_desc->get_shape(), out_desc->get_layout());
 
+        const bool is_with_data_repacking = brgemm_cpu && brgemm_cpu->is_with_data_repacking();
+        auto get_block_size = [](size_t override_block_size, size_t block_size) {
+            return override_block_size != 0 ? override_block_size : block_size;
+        };
+
         auto in_0_subtensor = in_0_desc->get_subtensor();
         auto in_1_subtensor = in_1_desc->get_subtensor();
         auto out_subtensor = out_desc->get_subtensor();
 
         auto apply_m_blocking = [&]() {
             const auto& m = *(out_preordered_dims.rbegin() + 1);
-            const auto block_size_m = brgemm->get_m_block_size();
+            const auto block_size_m = get_block_size(m_m_block_size, brgemm->get_m_block_size());
             if (block_size_m >= m) {
                 *(in_0_subtensor.rbegin() + 1) = m;
                 *(out_subtensor.rbegin() + 1) = m;
@@ -107,7 +113,8 @@ bool BrgemmBlocking::run(LinearIR& linear_ir, LinearIR::constExprIt begin, Linea
 
         auto apply_n_blocking = [&]() {
             const auto& n = *out_preordered_dims.rbegin();
-            const auto block_size_n = brgemm->get_n_block_size();
+            const auto block_size_n = is_with_data_repacking ? brgemm->get_n_block_size()
+                                                             : get_block_size(m_n_block_size, brgemm->get_n_block_size());
             if (block_size_n >= n) {
                 *in_1_subtensor.rbegin() = n;
                 *out_subtensor.rbegin() = n;
@@ -134,7 +141,8 @@ bool BrgemmBlocking::run(LinearIR& linear_ir, LinearIR::constExprIt begin, Linea
         auto apply_k_blocking = [&]() {
             const auto& k = *in_0_planar_dims.rbegin();
             OPENVINO_ASSERT(k == *(in_1_planar_dims.rbegin() + 1), "Brgemm input descriptors have different K dimension value.");
-            const auto block_size_k = brgemm->get_k_block_size();
+            const auto block_size_k = is_with_data_repacking ? brgemm->get_k_block_size()
+                                                             : get_block_size(m_k_block_size, brgemm->get_k_block_size());
             if (block_size_k >= k) {
                 *in_0_subtensor.rbegin() = k;
                 *(in_1_subtensor.rbegin() + 1) = k;
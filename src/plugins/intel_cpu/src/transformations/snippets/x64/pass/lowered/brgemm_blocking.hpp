@@ -13,19 +13,26 @@ namespace pass {
 /**
  * @interface BrgemmBlocking
  * @brief Covers BrgemmCPU with blocking loops
+ * @param m_block_size, n_block_size, k_block_size - the block sizes overriding the ones set on the Brgemm operations
+ *        (e.g. by the autotuning), zero keeps the value of the operation. N and K blocks are overridden only
+ *        for the Brgemms without the data repacking, since the repacking kernel is blocked in the same way
  * @ingroup snippets
  */
 
 class BrgemmBlocking : public snippets::lowered::pass::RangedPass {
 public:
     OPENVINO_RTTI("BrgemmBlocking", "Pass")
-    BrgemmBlocking();
+    explicit BrgemmBlocking(size_t m_block_size = 0, size_t n_block_size = 0, size_t k_block_size = 0);
     bool run(snippets::lowered::LinearIR& linear_ir,
              snippets::lowered::LinearIR::constExprIt begin,
              snippets::lowered::LinearIR::constExprIt end) override;
 
 private:
     static void move_new_memory_buffer(snippets::lowered::LinearIR& linear_ir, const snippets::lowered::LinearIR::constExprIt& brgemm_it);
+
+    size_t m_m_block_size = 0;
+    size_t m_n_block_size = 0;
+    size_t m_k_block_size = 0;
 };
 
 }  // namespace pass
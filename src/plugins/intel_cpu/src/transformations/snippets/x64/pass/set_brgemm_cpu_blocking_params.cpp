@@ -77,5 +77,53 @@ pass::SetBrgemmCPUBlockingParams::SetBrgemmCPUBlockingParams() {
     auto m = std::make_shared<ov::pass::pattern::Matcher>(m_brgemm, matcher_name);
     register_matcher(m, callback);
 }
+
+std::vector<SnippetsTuningCache::Params> pass::SetBrgemmCPUBlockingParams::get_tuning_candidates(const std::shared_ptr<ov::Model>& body) {
+    size_t M = 0, N = 0, K = 0;
+    bool has_brgemm = false;
+    bool is_with_data_repacking = false;
+    for (const auto& op : body->get_ops()) {
+        const auto brgemm = ov::as_type_ptr<BrgemmCPU>(op);
+        if (!brgemm || brgemm->is_dynamic())
+            continue;
+        const auto brgemm_in0_dims = snippets::utils::get_planar_pshape(brgemm->input(0)).get_shape();
+        const auto brgemm_in1_dims = snippets::utils::get_planar_pshape(brgemm->input(1)).get_shape();
+        M = std::max(M, *(brgemm_in0_dims.rbegin() + 1));
+        K = std::max(K, *brgemm_in0_dims.rbegin());
+        N = std::max(N, *brgemm_in1_dims.rbegin());
+        is_with_data_repacking |= brgemm->is_with_data_repacking();
+        has_brgemm = true;
+    }
+    if (!has_brgemm)
+        return {};
+
+    // The heuristics select M block 32, N block 64 and K block up to 1024 for f32 (see the callback above).
+    // Zero keeps the value selected by the heuristics
+    std::vector<size_t> m_blocks{0}, n_blocks{0}, k_blocks{0};
+    if (M > 16)
+        m_blocks.push_back(16);
+    if (M > 32)
+        m_blocks.push_back(64);
+    // N and K blocks of the Brgemm with the data repacking must match the blocking of BrgemmCopyB
+    if (!is_with_data_repacking) {
+        if (N > 64)
+            n_blocks.push_back(128);
+        if (K > 256)
+            k_blocks.push_back(256);
+    }
+
+    // there is nothing to tune if the heuristics values are the only candidate
+    std::vector<SnippetsTuningCache::Params> candidates;
+    if (m_blocks.size() == 1 && n_blocks.size() == 1 && k_blocks.size() == 1)
+        return candidates;
+    for (const auto m_block : m_blocks) {
+        for (const auto n_block : n_blocks) {
+            for (const auto k_block : k_blocks) {
+                candidates.push_back({m_block, n_block, k_block});
+            }
+        }
+    }
+    return candidates;
+}
 } // namespace intel_cpu
 } // namespace ov
\ No newline at end of file
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "openvino/pass/graph_rewrite.hpp"
+#include "snippets_tuning_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -19,6 +20,12 @@ class SetBrgemmCPUBlockingParams: public ov::pass::MatcherPass {
 public:
     OPENVINO_RTTI("SetBrgemmCPUBlockingParams", "0");
     SetBrgemmCPUBlockingParams();
+
+    /**
+     * @brief Returns the candidate block sizes of the autotuning for the BrgemmCPU of the body processed by the pass.
+     *        The first candidate keeps the values selected by the pass, empty vector is returned if there is nothing to tune.
+     */
+    static std::vector<SnippetsTuningCache::Params> get_tuning_candidates(const std::shared_ptr<ov::Model>& body);
 };
 
 
@@ -4,6 +4,8 @@
 #include "snippets_mark_skipped.hpp"
 
 #include "snippets/pass/tokenization.hpp"
+#include "snippets/pass/fc_tokenization.hpp"
+#include "snippets/pass/split_dimension_m.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
 
@@ -15,6 +17,8 @@
 
 #include "itt.hpp"
 
+#include <numeric>
+
 
 namespace ov {
 namespace intel_cpu {
@@ -409,11 +413,44 @@ bool isSuitableChildForFusingSumActivation(const std::shared_ptr<const Node> &no
 bool isSuitableReduceChild(const std::shared_ptr<const Node> &node, const int channelAxis = DEFAULT_AXIS) {
     return node->get_output_element_type(0) == ov::element::f32 && isSuitableChildForFusingSimple(node, channelAxis);
 }
+// The FullyConnected gated by another FullyConnected with the same input is tokenized by Snippets
+// together with the activation and the gating Multiply, so the intermediate tensors aren't stored to memory.
+// The parallel domain of the Subgraph is the batch (or split M) dimension, so it must have enough work for all the threads
+bool isSuitableGatedFullyConnected(const std::shared_ptr<const Node> &node, const size_t concurrency) {
+    if (concurrency == 0 || !snippets::pass::TokenizeFCSnippets::get_gating_multiply(node))
+        return false;
+    const auto& shape = node->get_output_shape(0);
+    const size_t parallel_work_amount = std::accumulate(shape.rbegin() + 2, shape.rend(), size_t(1), std::multiplies<size_t>());
+    return parallel_work_amount >= concurrency || snippets::pass::SplitDimensionM::can_be_optimized(node, concurrency);
+}
 bool isSuitableMatMulWithConstantPath(const std::shared_ptr<Node>& node) {
     return ov::is_type<ov::opset1::MatMul>(node) &&
            !ov::is_type<ov::opset1::Constant>(node->get_input_node_shared_ptr(1)) &&
            ov::op::util::is_on_constant_path(node->input_value(1));
 }
+// The low-rank adapter branch added to the FullyConnected output is fused into FullyConnected by
+// LoraFullyConnectedFusion: Add(MatMul(X, W), MatMul(Multiply(MatMul(X, LoRA_A), LoRA_alpha), LoRA_B))
+// Returns the Multiply of the branch if the node is the Add of such pattern
+std::shared_ptr<Node> getLoraBranchMultiply(const std::shared_ptr<const Node> &node) {
+    if (!ov::is_type<ov::op::v1::Add>(node))
+        return nullptr;
+    for (size_t i = 0; i < 2; i++) {
+        const auto main_matmul = node->get_input_node_shared_ptr(i);
+        const auto matmul_b = node->get_input_node_shared_ptr(1 - i);
+        if (!isSuitableMatMulParent(main_matmul) || !isFullyConnected(main_matmul) ||
+            !ov::is_type<ov::op::v0::MatMul>(matmul_b))
+            continue;
+        const auto multiply = matmul_b->get_input_node_shared_ptr(0);
+        if (!ov::is_type<ov::op::v1::Multiply>(multiply))
+            continue;
+        for (const auto& input : multiply->input_values()) {
+            const auto matmul_a = input.get_node_shared_ptr();
+            if (ov::is_type<ov::op::v0::MatMul>(matmul_a) && matmul_a->input_value(0) == main_matmul->input_value(0))
+                return multiply;
+        }
+    }
+    return nullptr;
+}
 // Continue fusing chain of the passed type if the node has one child
 // Otherwise mark node as FusedTerminator (Fused, but fusing chain is interrupted)
 void PropagateIfHasOnlyChild(const std::shared_ptr<Node> &node, NodeFusingType nodeType) {
@@ -491,6 +528,10 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
             std::unordered_set<Node*> visited;
             ov::op::util::visit_constant_path(node->get_input_node_ptr(1), visited, markup_func);
         }
+        if (const auto lora_multiply = getLoraBranchMultiply(node)) {
+            SetSnippetsNodeType(lora_multiply, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+            SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+        }
         if (isSuitableConvolutionParent(node)) {
             // Initiate fusing chain
             SetNodeFusingType(node, NodeFusingType::FusedWithConvolution);
@@ -509,6 +550,8 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
                 channelAxis = DEFAULT_AXIS;
             }
             SetNodeFusingType(node, NodeFusingType::FusedWithMisc);
+        } else if (isSuitableGatedFullyConnected(node, fcConcurrency)) {
+            channelAxis = DEFAULT_AXIS;
         } else if (isSuitableMatMulParent(node)) {
             const bool is_fc = isFullyConnected(node);
             const bool is_i8 = canBeMatMulExecutedInInt8(node->get_input_element_type(0), node->get_input_element_type(1));
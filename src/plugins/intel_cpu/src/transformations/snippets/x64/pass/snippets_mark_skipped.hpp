@@ -13,14 +13,19 @@ namespace intel_cpu {
  * @interface SnippetsMarkSkipped
  * @brief Mark operations that should be ignored by snippets on tokenization stage. A typical example is eltwise operations
  * that will be fused into convolutions on plugin side.
+ * @param enableBF16 skip the Converts between bf16 Parameters/Results and f32 ops
+ * @param fcConcurrency if it's not zero, the gated FullyConnected (gate and up projections of LLM feed-forward layer)
+ *        with enough parallel work for this thread count are left to Snippets instead of the plugin fusings
  */
 class SnippetsMarkSkipped : public ov::pass::ModelPass {
 public:
     OPENVINO_RTTI("SnippetsMarkSkipped", "0");
-    SnippetsMarkSkipped(bool enableBF16 = false) : ModelPass(), enableBF16(enableBF16) {}
+    SnippetsMarkSkipped(bool enableBF16 = false, size_t fcConcurrency = 0)
+        : ModelPass(), enableBF16(enableBF16), fcConcurrency(fcConcurrency) {}
     bool run_on_model(const std::shared_ptr<ov::Model> &) override;
 private:
     bool enableBF16 = false;
+    size_t fcConcurrency = 0;
 };
 
 /*
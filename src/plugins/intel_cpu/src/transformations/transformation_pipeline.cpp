@@ -127,6 +127,9 @@
 // Snippets
 #include "snippets/pass/tokenization.hpp"
 #include "snippets/pass/mha_tokenization.hpp"
+#include "snippets/pass/norm_tokenization.hpp"
+#include "snippets/pass/gn_tokenization.hpp"
+#include "snippets/pass/fc_tokenization.hpp"
 #include "snippets/pass/collapse_subgraph.hpp"
 #include "snippets/pass/common_optimizations.hpp"
 #include "snippets/pass/split_dimension_m.hpp"
@@ -141,6 +144,9 @@
 #include "nodes/scaled_attn.h"
 #include "dnnl.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#if defined(OPENVINO_ARCH_ARM64)
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#endif
 #include "openvino/core/validation_util.hpp"
 
 namespace ov {
@@ -778,9 +784,26 @@ void Transformations::PostLpt() {
 }
 
 void Transformations::MainSnippets(void) {
-    if (snippetsMode == Config::SnippetsMode::Disable ||
-        !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) // snippets are implemented only for relevant platforms (avx2+ extensions)
+    auto is_supported_isa = [](){
+#if defined(OPENVINO_ARCH_X86_64)
+        return dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2);
+#elif defined(OPENVINO_ARCH_ARM64)
+        return dnnl::impl::cpu::aarch64::mayiuse(dnnl::impl::cpu::aarch64::asimd);
+#endif
+        return false;
+    };
+
+    // snippets are implemented only for relevant platforms (avx2+ extensions on x64, ASIMD on aarch64)
+    if (snippetsMode == Config::SnippetsMode::Disable || !is_supported_isa())
+        return;
+#if defined(OPENVINO_ARCH_ARM64)
+    // aarch64 snippets generator isn't validated on the hardware yet, so it is used only on demand
+    if (!config.snippetsArm64Tokenization)
+        return;
+    // aarch64 snippets generator computes in f32: the f16 data is converted in registers after the loads and before the stores
+    if (!one_of(inferencePrecision, ov::element::f32, ov::element::f16))
         return;
+#endif
 
     ov::snippets::pass::SnippetsTokenization::Config tokenization_config;
     // [111813]: At the moment Snippets supports Transpose on output of MHA pattern only if it is an one node between MatMul and Result.
@@ -798,12 +821,30 @@ void Transformations::MainSnippets(void) {
     tokenization_config.split_m_dimension = snippetsMode != Config::SnippetsMode::IgnoreCallback;
     // [122706] Some 3D MHA Patterns have perf regressions when Transpose op is tokenized
     tokenization_config.mha_supported_transpose_ranks = { 4 };
+    // x64 Snippets kernel keeps each data pointer of the Subgraph in a separate GPR,
+    // the other ones are reserved for the kernel arguments and the loop work amounts
+    tokenization_config.norm_data_ptr_count = 11;
+
+    // The gated FullyConnected are tokenized only on demand, since the gains over the plugin FullyConnected with
+    // the post-ops aren't measured yet. Only f32 is supported: bf16 Brgemm requires the repacking of the weights
+    // on each inference, while the plugin FullyConnected repacks the Constant weights once
+    const bool isFCSupported = config.snippetsFCTokenization &&
+            dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) && inferencePrecision == ov::element::f32;
 
     ov::pass::Manager snippetsManager;
     snippetsManager.set_per_pass_validation(false);
     if (snippetsMode != Config::SnippetsMode::IgnoreCallback)
-        CPU_REGISTER_PASS_X64(snippetsManager, SnippetsMarkSkipped, inferencePrecision != ov::element::f32);
+        CPU_REGISTER_PASS_X64(snippetsManager, SnippetsMarkSkipped, inferencePrecision != ov::element::f32,
+                              isFCSupported ? tokenization_config.concurrency : 0);
     CPU_REGISTER_PASS_X64(snippetsManager, snippets::pass::SnippetsTokenization, tokenization_config);
+    CPU_REGISTER_PASS_ARM64(snippetsManager, snippets::pass::SnippetsTokenization, tokenization_config);
+    // aarch64 generator doesn't have Brgemm emitters yet and the normalizations require the emitters for Sqrt,
+    // so only the general eltwise subgraphs with the reductions by the last dimension are tokenized
+    CPU_DISABLE_PASS_ARM64(snippetsManager, snippets::pass::TokenizeMHASnippets);
+    CPU_DISABLE_PASS_ARM64(snippetsManager, snippets::pass::ExtractReshapesFromMHA);
+    CPU_DISABLE_PASS_ARM64(snippetsManager, snippets::pass::TokenizeGNSnippets);
+    CPU_DISABLE_PASS_ARM64(snippetsManager, snippets::pass::TokenizeNormSnippets);
+    CPU_DISABLE_PASS_ARM64(snippetsManager, snippets::pass::TokenizeFCSnippets);
 
     // - MHA has BRGEMM that is supported only on AVX512 platforms
     // - CPU Plugin Subgraph supports only f32, bf16 (and quantized) BRGEMM
@@ -815,6 +856,9 @@ void Transformations::MainSnippets(void) {
         CPU_DISABLE_PASS_X64(snippetsManager, snippets::pass::TokenizeMHASnippets);
         CPU_DISABLE_PASS_X64(snippetsManager, snippets::pass::ExtractReshapesFromMHA);
     }
+    if (!isFCSupported) {
+        CPU_DISABLE_PASS_X64(snippetsManager, snippets::pass::TokenizeFCSnippets);
+    }
 
 #if defined(OPENVINO_ARCH_X86_64)
     auto is_supported_matmul = [this](const std::shared_ptr<const ov::Node>& n) {
@@ -874,6 +918,32 @@ void Transformations::MainSnippets(void) {
         CPU_SET_CALLBACK_X64(snippetsManager, [&](const std::shared_ptr<const ov::Node>& n) -> bool {
             return !is_supported_matmul(n) || is_unsupported_parallel_work_amount(n, n->get_output_shape(0));
         }, snippets::pass::ExtractReshapesFromMHA);
+        CPU_SET_CALLBACK_X64(snippetsManager, [&](const std::shared_ptr<const ov::Node>& n) -> bool {
+            // Transformation callback is called on MVN or ReduceMean of RMSNorm
+            if (n->is_dynamic() || n->get_input_shape(0).empty() || inferencePrecision != ov::element::f32)
+                return true;
+            // MVN node supports scale, bias and quantization as post ops, so the Subgraph is profitable
+            // only if the residual Add is fused as well
+            if (ov::is_type<const ov::op::v6::MVN>(n)) {
+                const auto residual = n->get_input_node_shared_ptr(0);
+                if (!ov::is_type<const ov::op::v1::Add>(residual) ||
+                    snippets::pass::GetSnippetsNodeType(residual) == snippets::pass::SnippetsNodeType::SkippedByPlugin)
+                    return true;
+            }
+            // The rows are normalized in parallel, each row is read several times by the reductions
+            // so it should stay in cache between the passes
+            const auto& shape = n->get_input_shape(0);
+            const size_t row_size = shape.back() * n->get_input_element_type(0).size();
+            const size_t rows = std::accumulate(shape.begin(), shape.end() - 1, size_t(1), std::multiplies<size_t>());
+            return rows < tokenization_config.concurrency ||
+                   row_size > static_cast<size_t>(dnnl::utils::get_cache_size(2, true));
+        }, snippets::pass::TokenizeNormSnippets);
+        CPU_SET_CALLBACK_X64(snippetsManager, [&](const std::shared_ptr<const ov::Node>& n) -> bool {
+            // Transformation callback is called on MatMul. SnippetsMarkSkipped leaves to Snippets only the gated FullyConnected,
+            // the other ones are executed by the plugin with the post-ops
+            return !is_supported_matmul(n) ||
+                   snippets::pass::GetSnippetsNodeType(n) == snippets::pass::SnippetsNodeType::SkippedByPlugin;
+        }, snippets::pass::TokenizeFCSnippets);
         CPU_SET_CALLBACK_X64(snippetsManager,
             [](const std::shared_ptr<const ov::Node>& n) -> bool {
                 if (n->is_dynamic())
@@ -927,6 +997,77 @@ void Transformations::MainSnippets(void) {
                 return false;
             },
             snippets::pass::TokenizeSnippets);
+        CPU_SET_CALLBACK_ARM64(snippetsManager,
+            [](const std::shared_ptr<const ov::Node>& n) -> bool {
+                if (n->is_dynamic())
+                    return true;
+                const bool is_reduce = ov::is_type<const ov::op::v1::ReduceMax>(n) ||
+                                       ov::is_type<const ov::op::v1::ReduceSum>(n);
+                // aarch64 emitters convert only between f16 and f32, so the data inputs and outputs of the op
+                // must have the same floating-point type. The axis of the reduction is a constant, it isn't loaded
+                const auto& inputs = n->inputs();
+                const auto& outputs = n->outputs();
+                const auto data_type = n->get_output_element_type(0);
+                const bool has_supported_types =
+                    one_of(data_type, ov::element::f32, ov::element::f16) &&
+                    std::all_of(inputs.begin(), inputs.end(), [&](const ov::Input<const ov::Node>& in) {
+                        return (is_reduce && in.get_index() == 1) || in.get_element_type() == data_type;
+                    }) &&
+                    std::all_of(outputs.begin(), outputs.end(), [&](const ov::Output<const ov::Node>& out) {
+                        return out.get_element_type() == data_type;
+                    });
+                if (!has_supported_types)
+                    return true;
+                // PowerStatic is the only Power supported by the emitters
+                if (ov::is_type<const ov::op::v1::Power>(n)) {
+                    const auto exponent = ov::as_type_ptr<const ov::op::v0::Constant>(n->get_input_node_shared_ptr(1));
+                    return !exponent || ov::shape_size(exponent->get_shape()) != 1;
+                }
+                // Softmax is decomposed to the reductions, which are supported by the last dimension only:
+                // TokenizeSnippets checks the axes of all of them
+                const bool is_supported_op = ov::is_type<const ov::op::v1::Add>(n) ||
+                                             ov::is_type<const ov::op::v1::Subtract>(n) ||
+                                             ov::is_type<const ov::op::v1::Multiply>(n) ||
+                                             ov::is_type<const ov::op::v1::Divide>(n) ||
+                                             ov::is_type<const ov::op::v1::Maximum>(n) ||
+                                             ov::is_type<const ov::op::v1::ReduceMax>(n) ||
+                                             ov::is_type<const ov::op::v1::ReduceSum>(n) ||
+                                             ov::is_type<const ov::op::v1::Softmax>(n) ||
+                                             ov::is_type<const ov::op::v8::Softmax>(n) ||
+                                             ov::is_type<const ov::op::v0::PRelu>(n) ||
+                                             ov::is_type<const ov::op::v0::Abs>(n) ||
+                                             ov::is_type<const ov::op::v0::Clamp>(n) ||
+                                             ov::is_type<const ov::op::v0::Exp>(n) ||
+                                             ov::is_type<const ov::op::v0::Relu>(n) ||
+                                             ov::is_type<const ov::op::v0::Sigmoid>(n) ||
+                                             ov::is_type<const ov::op::v0::Tanh>(n);
+                if (!is_supported_op)
+                    return true;
+                const bool has_only_const_inputs = std::all_of(inputs.begin(), inputs.end(),
+                                                               [](const ov::Input<const ov::Node>& in) {
+                                                                   return ov::is_type<ov::op::v0::Constant>(
+                                                                           in.get_source_output().get_node_shared_ptr());
+                                                               });
+                if (has_only_const_inputs)
+                    return true;
+                // Eltwise after Convolution and MatMul are fused by ACL executors as post ops
+                const bool is_post_op = std::any_of(inputs.begin(), inputs.end(), [](const ov::Input<const ov::Node>& in) {
+                    const auto parent = in.get_source_output().get_node_shared_ptr();
+                    return ov::is_type<ov::op::v1::Convolution>(parent) ||
+                           ov::is_type<ov::op::v1::GroupConvolution>(parent) ||
+                           ov::is_type<ov::op::v0::MatMul>(parent);
+                });
+                if (is_post_op)
+                    return true;
+                auto rank_is_too_large = [](const ov::descriptor::Tensor& t) {
+                    return t.get_partial_shape().rank().get_length() > 6;
+                };
+                return std::any_of(inputs.begin(), inputs.end(),
+                                   [&](const ov::Input<const ov::Node>& in) { return rank_is_too_large(in.get_tensor()); }) ||
+                       std::any_of(outputs.begin(), outputs.end(),
+                                   [&](const ov::Output<const ov::Node>& out) { return rank_is_too_large(out.get_tensor()); });
+            },
+            snippets::pass::TokenizeSnippets);
     }
     snippetsManager.run_passes(model);
 }
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "data_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr size_t chunkSize = size_t(1) << 20;
+constexpr uint64_t prime = 0x9e3779b97f4a7c15ull;
+
+// the finalizer of MurmurHash3, each bit of the input affects all the bits of the result
+uint64_t mix(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ull;
+    value ^= value >> 33;
+    return value;
+}
+
+uint64_t hashChunk(const uint8_t* data, size_t size) {
+    // the independent lanes hide the latency of the multiplications
+    uint64_t lanes[4] = {prime, prime * 2, prime * 3, prime * 4};
+    size_t i = 0;
+    for (; i + 4 * sizeof(uint64_t) <= size; i += 4 * sizeof(uint64_t)) {
+        uint64_t words[4];
+        std::memcpy(words, data + i, sizeof(words));
+        for (size_t l = 0; l < 4; l++) {
+            lanes[l] = (lanes[l] ^ mix(words[l])) * prime;
+        }
+    }
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        lanes[0] = (lanes[0] ^ mix(word)) * prime;
+    }
+    uint64_t tail = 0;
+    for (size_t shift = 0; i < size; i++, shift += 8) {
+        tail |= static_cast<uint64_t>(data[i]) << shift;
+    }
+    uint64_t hash = mix(size) ^ mix(tail);
+    for (const auto lane : lanes) {
+        hash = mix(hash ^ lane) * prime;
+    }
+    return hash;
+}
+}  // namespace
+
+uint64_t hashData(const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    const size_t chunks = (size + chunkSize - 1) / chunkSize;
+    std::vector<uint64_t> hashes(chunks);
+    ov::parallel_for(chunks, [&](size_t i) {
+        const auto offset = i * chunkSize;
+        hashes[i] = hashChunk(bytes + offset, std::min(chunkSize, size - offset));
+    });
+
+    uint64_t hash = mix(size);
+    for (const auto chunkHash : hashes) {
+        hash = mix(hash ^ chunkHash) * prime;
+    }
+    return hash;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Computes 64-bit hash of the data. The data is split into the chunks of 1 MiB hashed in parallel
+ * by the 8 byte words, so the hashing of the weights is much faster than the byte serial SimpleDataHash.
+ * The value depends only on the data, so it may be stored (e.g. in the cache blob) and compared later
+ * on the machine with the same byte order.
+ */
+uint64_t hashData(const void* data, size_t size);
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -3,8 +3,14 @@
 //
 
 #include "weights_cache.hpp"
+#include "memory_desc/cpu_memory_desc_utils.h"
 #include "openvino/runtime/system_conf.hpp"
+#include "utils/data_hash.hpp"
 
+#include "common/primitive_hashing_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 namespace ov {
@@ -48,6 +54,18 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
             newPtr = create();
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
+            // the cache may live as long as the process, so the entries of the released objects are dropped
+            // each time their number doubles
+            if (sharedWeights.size() >= cleanupThreshold) {
+                for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+                    if (it->second->sharedMemory.expired()) {
+                        it = sharedWeights.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+                cleanupThreshold = std::max(cleanupThreshold, 2 * sharedWeights.size());
+            }
         }
     }
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
@@ -71,6 +89,42 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+MemoryPtr WeightsSharing::findOrCreateByContent(const std::string& key, std::function<MemoryPtr(void)> create) {
+    MemoryPtr created;
+    MemoryPtr cached = *findOrCreate(key, [&]() {
+        created = create();
+        return created;
+    });
+    if (cached == created)
+        return cached;
+
+    auto candidate = create();
+    if (candidate->getSize() == cached->getSize() &&
+        std::memcmp(candidate->getData(), cached->getData(), cached->getSize()) == 0)
+        return cached;
+    return candidate;
+}
+
+size_t WeightsSharing::getSize() const {
+    std::lock_guard<std::mutex> lock(guard);
+    size_t size = 0;
+    for (const auto& item : sharedWeights) {
+        if (auto memory = item.second->sharedMemory.lock()) {
+            size += memory->getSize();
+        }
+    }
+    return size;
+}
+
+std::string WeightsSharing::descKey(const MemoryDescPtr& desc) {
+    const auto dnnlDesc = MemoryDescUtils::convertToDnnlMemoryDesc(desc);
+    return std::to_string(dnnl::impl::primitive_hashing::get_md_hash(*dnnlDesc->getDnnlDesc().get()));
+}
+
+std::string WeightsSharing::dataKey(const void* data, size_t size) {
+    return std::to_string(size) + "_" + std::to_string(hashData(data, size));
+}
+
 SocketsWeights::SocketsWeights() {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++)
@@ -91,5 +145,17 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
+size_t SocketsWeights::getSize() const {
+    size_t size = 0;
+    for (const auto& item : _cache_map)
+        size += item.second->getSize();
+    return size;
+}
+
+SocketsWeights& SocketsWeights::getProcessWeights() {
+    static SocketsWeights processWeights;
+    return processWeights;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
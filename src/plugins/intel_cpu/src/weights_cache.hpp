@@ -94,11 +94,32 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Returns the object shared by a key built with dataKey(). Such a key identifies the data only by its hash,
+     * so on a hit the object is created again and compared byte by byte with the cached one: in case of a hash
+     * collision the new object is returned and it isn't cached.
+     */
+    MemoryPtr findOrCreateByContent(const std::string& key, std::function<MemoryPtr(void)> create);
+
+    /**
+     * @return the sum of the sizes in bytes of the cached objects which are still in use
+     */
+    size_t getSize() const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    /**
+     * The keys below identify the repacked weights across the compiled models, where neither the node names
+     * nor the data pointers are unique: the descriptors are hashed as a whole and the data by its content
+     */
+    static std::string descKey(const MemoryDescPtr& desc);
+    static std::string dataKey(const void* data, size_t size);
+
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    // the number of the entries which triggers the removal of the released ones
+    size_t cleanupThreshold = 64;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -114,6 +135,14 @@ public:
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    size_t getSize() const;
+
+    /**
+     * @brief The process level store of the repacked weights shared by all the compiled models. The replicas
+     * of the weights are kept per socket and released with the last graph using them.
+     */
+    static SocketsWeights& getProcessWeights();
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Compares the inference time of a model with wide independent branches in the ov::intel_cpu::dataflow_execution
+// mode against the default sequential execution, both in a single stream with the latency hint.
+//
+// Usage: ov_cpu_dataflow_execution_benchmark [branches] [iterations]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "openvino/opsets/opset13.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+namespace {
+
+constexpr size_t batch = 16;
+constexpr size_t channels = 512;
+
+std::vector<float> random_values(size_t size, std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> values(size);
+    for (auto& value : values)
+        value = distribution(generator);
+    return values;
+}
+
+// Independent MatMul -> Relu -> MatMul -> Sigmoid branches joined by Concat
+std::shared_ptr<ov::Model> make_model(size_t branches) {
+    std::mt19937 generator(1);
+    auto param = std::make_shared<ov::opset13::Parameter>(ov::element::f32, ov::Shape{batch, channels});
+    ov::OutputVector concat_inputs;
+    for (size_t i = 0; i < branches; i++) {
+        auto weights0 = ov::opset13::Constant::create(ov::element::f32,
+                                                      ov::Shape{channels, channels},
+                                                      random_values(channels * channels, generator));
+        auto matmul0 = std::make_shared<ov::opset13::MatMul>(param, weights0);
+        auto relu = std::make_shared<ov::opset13::Relu>(matmul0);
+        auto weights1 = ov::opset13::Constant::create(ov::element::f32,
+                                                      ov::Shape{channels, channels},
+                                                      random_values(channels * channels, generator));
+        auto matmul1 = std::make_shared<ov::opset13::MatMul>(relu, weights1);
+        concat_inputs.push_back(std::make_shared<ov::opset13::Sigmoid>(matmul1));
+    }
+    auto concat = std::make_shared<ov::opset13::Concat>(concat_inputs, 0);
+    auto result = std::make_shared<ov::opset13::Result>(concat);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "DataflowBenchmark");
+}
+
+// Returns the sorted inference times in ms
+std::vector<double> measure(ov::InferRequest& request, size_t iterations) {
+    request.infer();  // warm up
+    std::vector<double> times;
+    for (size_t i = 0; i < iterations; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        request.infer();
+        const auto stop = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t branches = argc > 1 ? std::max(1, std::atoi(argv[1])) : 8;
+    const size_t iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 50;
+
+    try {
+        ov::Core core;
+        const auto model = make_model(branches);
+        std::mt19937 generator(2);
+        const auto input_values = random_values(batch * channels, generator);
+        ov::Tensor input(ov::element::f32, ov::Shape{batch, channels});
+        std::copy(input_values.begin(), input_values.end(), input.data<float>());
+
+        std::cout << branches << " branches, " << iterations << " iterations" << std::endl;
+        std::vector<std::vector<float>> outputs;
+        for (const bool dataflow : {false, true}) {
+            auto compiled = core.compile_model(model,
+                                               "CPU",
+                                               ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY),
+                                               ov::num_streams(1),
+                                               ov::intel_cpu::dataflow_execution(dataflow));
+            if (dataflow && !compiled.get_property(ov::intel_cpu::dataflow_execution)) {
+                std::cerr << "The graph falls back to the sequential execution" << std::endl;
+                return 1;
+            }
+            auto request = compiled.create_infer_request();
+            request.set_input_tensor(input);
+            const auto times = measure(request, iterations);
+            std::cout << (dataflow ? "dataflow" : "sequential") << ": min " << times.front() << " ms, median "
+                      << times[times.size() / 2] << " ms" << std::endl;
+
+            const auto output = request.get_output_tensor(0);
+            outputs.emplace_back(output.data<float>(), output.data<float>() + output.get_size());
+        }
+
+        // the results do not depend on the execution order
+        for (size_t i = 0; i < outputs[0].size(); ++i) {
+            if (std::abs(outputs[0][i] - outputs[1][i]) > 1e-5f) {
+                std::cerr << "The outputs differ at " << i << ": " << outputs[0][i] << " vs " << outputs[1][i]
+                          << std::endl;
+                return 1;
+            }
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Measures the per inference overhead of a tiny static model with and without the
+// ov::intel_cpu::execution_plan_replay, both with the same input tensor on every inference and with the input
+// tensor rebound before each of them.
+//
+// Usage: ov_cpu_execution_plan_benchmark [iterations]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "openvino/opsets/opset13.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+namespace {
+
+constexpr size_t batch = 1;
+constexpr size_t channels = 8;
+constexpr size_t rounds = 5;
+
+std::vector<float> random_values(size_t size, std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> values(size);
+    for (auto& value : values)
+        value = distribution(generator);
+    return values;
+}
+
+ov::Tensor make_input(std::mt19937& generator) {
+    const auto values = random_values(batch * channels, generator);
+    ov::Tensor input(ov::element::f32, ov::Shape{batch, channels});
+    std::copy(values.begin(), values.end(), input.data<float>());
+    return input;
+}
+
+// MatMul -> Relu -> MatMul -> Softmax, the execution time is dominated by the per inference overhead
+std::shared_ptr<ov::Model> make_model() {
+    std::mt19937 generator(1);
+    auto param = std::make_shared<ov::opset13::Parameter>(ov::element::f32, ov::Shape{batch, channels});
+    auto weights0 = ov::opset13::Constant::create(ov::element::f32,
+                                                  ov::Shape{channels, channels},
+                                                  random_values(channels * channels, generator));
+    auto matmul0 = std::make_shared<ov::opset13::MatMul>(param, weights0);
+    auto relu = std::make_shared<ov::opset13::Relu>(matmul0);
+    auto weights1 = ov::opset13::Constant::create(ov::element::f32,
+                                                  ov::Shape{channels, channels},
+                                                  random_values(channels * channels, generator));
+    auto matmul1 = std::make_shared<ov::opset13::MatMul>(relu, weights1);
+    auto softmax = std::make_shared<ov::opset13::Softmax>(matmul1, 1);
+    auto result = std::make_shared<ov::opset13::Result>(softmax);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "ExecutionPlanBenchmark");
+}
+
+// Returns the median over the rounds of the mean time of a single inference in us
+double measure(ov::InferRequest& request, const std::vector<ov::Tensor>& inputs, bool rebind, size_t iterations) {
+    request.set_input_tensor(inputs[0]);
+    request.infer();  // warm up, builds the plan
+    std::vector<double> means;
+    for (size_t round = 0; round < rounds; ++round) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            if (rebind)
+                request.set_input_tensor(inputs[i % inputs.size()]);
+            request.infer();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        means.push_back(std::chrono::duration<double, std::micro>(stop - start).count() / iterations);
+    }
+    std::sort(means.begin(), means.end());
+    return means[means.size() / 2];
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 10000;
+
+    try {
+        ov::Core core;
+        const auto model = make_model();
+        std::mt19937 generator(2);
+        const std::vector<ov::Tensor> inputs{make_input(generator), make_input(generator)};
+
+        std::cout << "per inference time, " << rounds << " rounds of " << iterations << " iterations" << std::endl;
+        std::vector<std::vector<float>> outputs;
+        for (const bool replay : {false, true}) {
+            auto compiled = core.compile_model(model,
+                                               "CPU",
+                                               ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY),
+                                               ov::num_streams(1),
+                                               ov::intel_cpu::execution_plan_replay(replay));
+            if (replay && !compiled.get_property(ov::intel_cpu::execution_plan_replay)) {
+                std::cerr << "The compiled model doesn't enable the execution plan replay" << std::endl;
+                return 1;
+            }
+            auto request = compiled.create_infer_request();
+            const auto same_tensors = measure(request, inputs, false, iterations);
+            const auto rebound_tensors = measure(request, inputs, true, iterations);
+            std::cout << (replay ? "replay" : "default") << ": " << same_tensors << " us, with the input rebound "
+                      << rebound_tensors << " us" << std::endl;
+
+            request.set_input_tensor(inputs[0]);
+            request.infer();
+            const auto output = request.get_output_tensor(0);
+            outputs.emplace_back(output.data<float>(), output.data<float>() + output.get_size());
+        }
+
+        for (size_t i = 0; i < outputs[0].size(); ++i) {
+            if (std::abs(outputs[0][i] - outputs[1][i]) > 1e-6f) {
+                std::cerr << "The outputs differ at " << i << ": " << outputs[0][i] << " vs " << outputs[1][i]
+                          << std::endl;
+                return 1;
+            }
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -4,10 +4,23 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
 #include "utils/properties_test.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/softmax.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 
@@ -41,6 +54,19 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
         RO_property(ov::hint::dynamic_quantization_group_size.name()),
         RO_property(ov::hint::kv_cache_precision.name()),
+        RO_property(ov::intel_cpu::kv_cache_page_size.name()),
+        RO_property(ov::intel_cpu::kv_cache_group_size.name()),
+        RO_property(ov::intel_cpu::dataflow_execution.name()),
+        RO_property(ov::intel_cpu::execution_plan_replay.name()),
+        RO_property(ov::intel_cpu::activation_memory_budget.name()),
+        RO_property(ov::intel_cpu::shared_scratchpad.name()),
+        RO_property(ov::intel_cpu::cross_model_weights_sharing.name()),
+        RO_property(ov::intel_cpu::snippets_autotuning.name()),
+        RO_property(ov::intel_cpu::shape_warm_up.name()),
+        RO_property(ov::intel_cpu::kv_cache_pool_used_size.name()),
+        RO_property(ov::intel_cpu::kv_cache_pool_allocated_size.name()),
+        RO_property(ov::intel_cpu::peak_activation_memory_size.name()),
+        RO_property(ov::intel_cpu::primitive_cache_statistics.name()),
     };
 
     ov::Core ie;
@@ -183,6 +209,345 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckKVCachePrecision) {
     ASSERT_EQ(kv_cache_precision_value, ov::element::f32);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckKVCachePageSize) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::intel_cpu::kv_cache_page_size(32));
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+
+    uint64_t page_size = 0;
+    ASSERT_NO_THROW(page_size = compiledModel.get_property(ov::intel_cpu::kv_cache_page_size));
+    ASSERT_EQ(page_size, 32);
+    uint64_t used_size = 1;
+    ASSERT_NO_THROW(used_size = compiledModel.get_property(ov::intel_cpu::kv_cache_pool_used_size));
+    ASSERT_EQ(used_size, 0);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckKVCacheGroupSize) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::hint::kv_cache_precision(ov::element::u4));
+    core.set_property(deviceName, ov::intel_cpu::kv_cache_group_size(32));
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+
+    auto kv_cache_precision_value = ov::element::undefined;
+    ASSERT_NO_THROW(kv_cache_precision_value = compiledModel.get_property(ov::hint::kv_cache_precision));
+    ASSERT_EQ(kv_cache_precision_value, ov::element::u4);
+    uint64_t group_size = 0;
+    ASSERT_NO_THROW(group_size = compiledModel.get_property(ov::intel_cpu::kv_cache_group_size));
+    ASSERT_EQ(group_size, 32);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckActivationMemoryBudget) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::num_streams(1));
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+
+    // the planned size is reported right after the compilation
+    uint64_t planned_size = 0;
+    ASSERT_NO_THROW(planned_size = compiledModel.get_property(ov::intel_cpu::peak_activation_memory_size));
+    ASSERT_GT(planned_size, 0);
+
+    ASSERT_NO_THROW(compiledModel =
+                        core.compile_model(model, deviceName, ov::intel_cpu::activation_memory_budget(planned_size)));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::activation_memory_budget), planned_size);
+    ASSERT_THROW(core.compile_model(model, deviceName, ov::intel_cpu::activation_memory_budget(planned_size - 1)),
+                 ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSharedScratchPad) {
+    ov::Core core;
+
+    const ov::AnyMap config = {ov::num_streams(2),
+                               ov::hint::enable_cpu_pinning(true),
+                               ov::intel_cpu::shared_scratchpad(true)};
+    // the streams of both models are bound to the same cores, so they share the pooled scratch pads
+    ov::CompiledModel compiledModel0 = core.compile_model(model, deviceName, config);
+    ov::CompiledModel compiledModel1 = core.compile_model(model, deviceName, config);
+    ASSERT_EQ(compiledModel0.get_property(ov::intel_cpu::shared_scratchpad), true);
+
+    auto request0 = compiledModel0.create_infer_request();
+    auto request1 = compiledModel1.create_infer_request();
+    request0.start_async();
+    request1.start_async();
+    ASSERT_NO_THROW(request0.wait());
+    ASSERT_NO_THROW(request1.wait());
+
+    ASSERT_NO_THROW(core.get_property(deviceName, ov::intel_cpu::scratchpad_pool_size));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCrossModelWeightsSharing) {
+    ov::Core core;
+
+    const ov::AnyMap config = {ov::num_streams(1), ov::intel_cpu::cross_model_weights_sharing(true)};
+    ov::CompiledModel compiledModel0 = core.compile_model(model, deviceName, config);
+    ASSERT_EQ(compiledModel0.get_property(ov::intel_cpu::cross_model_weights_sharing), true);
+    uint64_t shared_size = 0;
+    ASSERT_NO_THROW(shared_size = core.get_property(deviceName, ov::intel_cpu::shared_weights_size));
+
+    // the variant with the same weights reuses the repacked copies of the first model
+    ov::CompiledModel compiledModel1 = core.compile_model(model->clone(), deviceName, config);
+    ASSERT_EQ(core.get_property(deviceName, ov::intel_cpu::shared_weights_size), shared_size);
+
+    auto request0 = compiledModel0.create_infer_request();
+    auto request1 = compiledModel1.create_infer_request();
+    ASSERT_NO_THROW(request0.infer());
+    ASSERT_NO_THROW(request1.infer());
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSnippetsAutotuning) {
+    ov::Core core;
+
+    ov::CompiledModel compiledModel;
+    ASSERT_NO_THROW(compiledModel = core.compile_model(model, deviceName, ov::intel_cpu::snippets_autotuning(true)));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::snippets_autotuning), true);
+
+    auto request = compiledModel.create_infer_request();
+    ASSERT_NO_THROW(request.infer());
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSnippetsAutotuningCache) {
+    if (!ov::with_cpu_x86_avx512_core())
+        GTEST_SKIP() << "The snippets MHA requires avx512_core";
+
+    const std::string cacheDir = "smoke_CpuExecNetworkSnippetsAutotuningCache";
+    const ov::Shape shape{1, 2, 128, 64};
+    ov::ParameterVector params;
+    for (size_t i = 0; i < 3; i++) {
+        params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+    }
+    auto qk = std::make_shared<ov::op::v0::MatMul>(params[0], params[1], false, true);
+    auto softmax = std::make_shared<ov::op::v8::Softmax>(qk, -1);
+    auto qkv = std::make_shared<ov::op::v0::MatMul>(softmax, params[2]);
+    auto mhaModel = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(qkv)}, params);
+
+    auto infer = [&](ov::CompiledModel& compiledModel) {
+        auto request = compiledModel.create_infer_request();
+        for (size_t i = 0; i < params.size(); i++) {
+            auto input = request.get_input_tensor(i);
+            auto data = input.data<float>();
+            for (size_t j = 0; j < input.get_size(); j++) {
+                data[j] = static_cast<float>((j + i) % 11) / 11.f - 0.5f;
+            }
+        }
+        request.infer();
+        auto output = request.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    };
+
+    std::vector<float> expected;
+    {
+        ov::Core core;
+        ov::CompiledModel compiledModel =
+            core.compile_model(mhaModel, deviceName, ov::hint::inference_precision(ov::element::f32));
+        expected = infer(compiledModel);
+    }
+
+    ov::Core core;
+    core.set_property(ov::cache_dir(cacheDir));
+    const ov::AnyMap config = {ov::intel_cpu::snippets_autotuning(true), ov::hint::inference_precision(ov::element::f32)};
+    std::vector<float> tuned;
+    {
+        ov::CompiledModel compiledModel = core.compile_model(mhaModel, deviceName, config);
+        ASSERT_FALSE(compiledModel.get_property(ov::loaded_from_cache));
+        // MHA is executed by the snippets kernel, which is tuned
+        const auto runtimeOps = compiledModel.get_runtime_model()->get_ops();
+        ASSERT_TRUE(std::any_of(runtimeOps.begin(), runtimeOps.end(), [](const std::shared_ptr<ov::Node>& op) {
+            return op->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>() == "Subgraph";
+        }));
+        tuned = infer(compiledModel);
+    }
+    ASSERT_EQ(tuned.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], tuned[i], 1e-5f) << "output " << i;
+    }
+
+    // the results of the tuning are stored in the blob
+    auto blobs = ov::test::utils::listFilesWithExt(cacheDir, "blob");
+    ASSERT_EQ(blobs.size(), 1);
+    {
+        std::ifstream blob(blobs.front(), std::ios::binary);
+        const std::string content{std::istreambuf_iterator<char>(blob), std::istreambuf_iterator<char>()};
+        ASSERT_NE(content.find("<snippets_tuning isa="), std::string::npos);
+    }
+
+    // the imported model uses the stored block sizes instead of the search, so the results are the same
+    {
+        ov::CompiledModel compiledModel = core.compile_model(mhaModel, deviceName, config);
+        ASSERT_TRUE(compiledModel.get_property(ov::loaded_from_cache));
+        ASSERT_EQ(tuned, infer(compiledModel));
+    }
+
+    ov::test::utils::removeFilesWithExt(cacheDir, "blob");
+    ov::test::utils::removeDir(cacheDir);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckPrimitiveCacheStatistics) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::num_streams(2));
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+
+    std::map<std::string, uint64_t> statistics;
+    ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::primitive_cache_statistics));
+    ASSERT_EQ(statistics.size(), 3);
+    ASSERT_EQ(statistics.count("hits"), 1);
+    ASSERT_EQ(statistics.count("misses"), 1);
+    ASSERT_EQ(statistics.count("evictions"), 1);
+    // the convolution and pooling primitives of both streams are looked up in the shared cache
+    ASSERT_GT(statistics["hits"] + statistics["misses"], 0);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkShapeProfileCache) {
+    const std::string cacheDir = "smoke_CpuExecNetworkShapeProfileCache";
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto dynamicModel = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(relu)},
+                                                    ov::ParameterVector{param});
+
+    ov::Core core;
+    // the shapes are not stored unless the warm up is requested explicitly
+    {
+        ov::CompiledModel compiledModel = core.compile_model(dynamicModel, deviceName, ov::cache_dir(cacheDir));
+        ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::shape_warm_up), false);
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(ov::Tensor(ov::element::f32, {2, 16}));
+        ASSERT_NO_THROW(request.infer());
+    }
+    ASSERT_TRUE(ov::test::utils::listFilesWithExt(cacheDir, "cpu_shapes").empty());
+
+    const ov::AnyMap config = {ov::cache_dir(cacheDir), ov::intel_cpu::shape_warm_up(true)};
+    {
+        ov::CompiledModel compiledModel = core.compile_model(dynamicModel, deviceName, config);
+        auto request = compiledModel.create_infer_request();
+        for (size_t batch : {2, 3, 2}) {
+            request.set_input_tensor(ov::Tensor(ov::element::f32, {batch, 16}));
+            ASSERT_NO_THROW(request.infer());
+        }
+    }
+    // the file is written in background, the pending write is finished when the compiled model is released
+    ASSERT_EQ(ov::test::utils::listFilesWithExt(cacheDir, "cpu_shapes").size(), 1);
+
+    // the second compilation warms up the graph with the recorded shapes
+    ov::CompiledModel compiledModel;
+    ASSERT_NO_THROW(compiledModel = core.compile_model(dynamicModel, deviceName, config));
+    auto request = compiledModel.create_infer_request();
+    request.set_input_tensor(ov::Tensor(ov::element::f32, {3, 16}));
+    ASSERT_NO_THROW(request.infer());
+
+    ov::test::utils::removeFilesWithExt(cacheDir, "cpu_shapes");
+    ov::test::utils::removeFilesWithExt(cacheDir, "blob");
+    ov::test::utils::removeDir(cacheDir);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkImportFromMmapCache) {
+    const std::string cacheDir = "smoke_CpuExecNetworkImportFromMmapCache";
+    ov::Core core;
+    core.set_property(ov::enable_mmap(true));
+    core.set_property(ov::cache_dir(cacheDir));
+
+    auto infer = [&](ov::CompiledModel& compiledModel) {
+        auto request = compiledModel.create_infer_request();
+        auto input = request.get_input_tensor();
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++) {
+            data[i] = static_cast<float>(i % 17) - 8.f;
+        }
+        request.infer();
+        auto output = request.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    };
+
+    std::vector<float> expected;
+    {
+        ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+        ASSERT_FALSE(compiledModel.get_property(ov::loaded_from_cache));
+        expected = infer(compiledModel);
+    }
+
+    // the weights of the imported model refer to the mapped blob, which must stay valid while the model is alive
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+    ASSERT_TRUE(compiledModel.get_property(ov::loaded_from_cache));
+    ASSERT_EQ(expected, infer(compiledModel));
+    compiledModel = {};
+
+    ov::test::utils::removeFilesWithExt(cacheDir, "blob");
+    ov::test::utils::removeDir(cacheDir);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkWeightlessCache) {
+    const std::string cacheDir = "smoke_CpuExecNetworkWeightlessCache";
+    const std::string xmlPath = cacheDir + "_model.xml";
+    const std::string binPath = cacheDir + "_model.bin";
+    {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 64});
+        std::vector<float> weightsData(64 * 64);
+        for (size_t i = 0; i < weightsData.size(); i++) {
+            weightsData[i] = static_cast<float>(i % 13) / 13.f;
+        }
+        auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{64, 64}, weightsData);
+        // the transposed weights are used by FullyConnected as is, so they are not changed by the transformations
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(param, weights, false, true);
+        auto weightsModel = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(matmul)},
+                                                        ov::ParameterVector{param});
+        ov::save_model(weightsModel, xmlPath, false);
+    }
+
+    ov::Core core;
+    core.set_property(ov::cache_dir(cacheDir));
+    auto infer = [&](ov::CompiledModel& compiledModel) {
+        auto request = compiledModel.create_infer_request();
+        auto input = request.get_input_tensor();
+        std::fill_n(input.data<float>(), input.get_size(), 0.5f);
+        request.infer();
+        auto output = request.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    };
+
+    std::vector<float> expected;
+    {
+        ov::CompiledModel compiledModel =
+            core.compile_model(xmlPath, deviceName, ov::cache_mode(ov::CacheMode::OPTIMIZE_SIZE));
+        ASSERT_FALSE(compiledModel.get_property(ov::loaded_from_cache));
+        expected = infer(compiledModel);
+    }
+    // the blob refers to the weights in the .bin file instead of storing them
+    auto blobs = ov::test::utils::listFilesWithExt(cacheDir, "blob");
+    ASSERT_EQ(blobs.size(), 1);
+    ASSERT_LT(ov::test::utils::fileSize(blobs.front()), ov::test::utils::fileSize(binPath));
+
+    {
+        ov::CompiledModel compiledModel =
+            core.compile_model(xmlPath, deviceName, ov::cache_mode(ov::CacheMode::OPTIMIZE_SIZE));
+        ASSERT_TRUE(compiledModel.get_property(ov::loaded_from_cache));
+        ASSERT_EQ(expected, infer(compiledModel));
+    }
+
+    // the blob is not used when the weights file is rewritten with the other weights of the same size
+    {
+        std::fstream bin(binPath, std::ios::in | std::ios::out | std::ios::binary);
+        std::vector<float> weightsData(64 * 64);
+        bin.read(reinterpret_cast<char*>(weightsData.data()), weightsData.size() * sizeof(float));
+        ASSERT_TRUE(bin.good());
+        for (auto& weight : weightsData) {
+            weight *= 2.f;
+        }
+        bin.seekp(0);
+        bin.write(reinterpret_cast<const char*>(weightsData.data()), weightsData.size() * sizeof(float));
+    }
+    {
+        ov::CompiledModel compiledModel =
+            core.compile_model(xmlPath, deviceName, ov::cache_mode(ov::CacheMode::OPTIMIZE_SIZE));
+        ASSERT_FALSE(compiledModel.get_property(ov::loaded_from_cache));
+        ASSERT_NE(expected, infer(compiledModel));
+    }
+
+    ov::test::utils::removeFilesWithExt(cacheDir, "blob");
+    ov::test::utils::removeDir(cacheDir);
+    ov::test::utils::removeIRFiles(xmlPath, binPath);
+}
+
 const auto bf16_if_can_be_emulated = ov::with_cpu_x86_avx512_core() ? ov::element::bf16 : ov::element::f32;
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecutionModeIsAvailableInCoreAndModel) {
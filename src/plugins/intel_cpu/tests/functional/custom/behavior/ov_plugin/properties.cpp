@@ -37,6 +37,8 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RO_property(ov::device::capabilities.name()),
         RO_property(ov::device::type.name()),
         RO_property(ov::device::architecture.name()),
+        RO_property(ov::intel_cpu::scratchpad_pool_size.name()),
+        RO_property(ov::intel_cpu::shared_weights_size.name()),
         // read write
         RW_property(ov::num_streams.name()),
         RW_property(ov::affinity.name()),
@@ -56,6 +58,18 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
         RW_property(ov::hint::dynamic_quantization_group_size.name()),
         RW_property(ov::hint::kv_cache_precision.name()),
+        RW_property(ov::intel_cpu::kv_cache_page_size.name()),
+        RW_property(ov::intel_cpu::kv_cache_group_size.name()),
+        RW_property(ov::intel_cpu::dataflow_execution.name()),
+        RW_property(ov::intel_cpu::execution_plan_replay.name()),
+        RW_property(ov::intel_cpu::activation_memory_budget.name()),
+        RW_property(ov::intel_cpu::shared_scratchpad.name()),
+        RW_property(ov::intel_cpu::cross_model_weights_sharing.name()),
+        RW_property(ov::intel_cpu::snippets_autotuning.name()),
+        RW_property(ov::intel_cpu::shape_warm_up.name()),
+        RW_property(ov::cache_dir.name()),
+        RW_property(ov::cache_mode.name()),
+        RW_property(ov::weights_path.name()),
     };
 
     ov::Core ie;
@@ -3,6 +3,7 @@
 //
 #include "openvino/opsets/opset13.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "transformations/op_conversions/scaled_dot_product_attention_decomposition.hpp"
 
 #include "shared_test_classes/base/ov_subgraph.hpp"
@@ -217,6 +218,71 @@ TEST_P(ConcatSDPTest, CompareWithRefs) {
     }
 }
 
+TEST_P(ConcatSDPTest, ForkPagedKVCache) {
+    auto model = function;
+    auto expectedOutputs = run_test(functionRefs);
+    function = model;
+    // small pages to make the forked prefix end in the middle of a page
+    configuration.insert({ov::intel_cpu::kv_cache_page_size.name(), "4"});
+    prepare();
+    auto source = inferRequest;
+    auto forked = compiledModel.create_infer_request();
+    auto infer = [this](ov::InferRequest& request, size_t idx) {
+        generate(static_cast<int>(idx), targetStaticShapes[idx]);
+        for (const auto& input : inputs) {
+            request.set_tensor(input.first, input.second);
+        }
+        request.infer();
+        return request.get_output_tensor(0);
+    };
+    ov::test::utils::compare(expectedOutputs[0], infer(source, 0), abs_threshold, rel_threshold);
+    for (auto&& state : forked.query_state()) {
+        for (auto&& source_state : source.query_state()) {
+            if (source_state.get_name() == state.get_name()) {
+                state.fork(source_state, source_state.get_state().get_shape()[2]);
+            }
+        }
+    }
+    // both requests continue from the shared prefix and must not affect each other
+    for (size_t i = 1; i < targetStaticShapes.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], infer(source, i), abs_threshold, rel_threshold);
+        ov::test::utils::compare(expectedOutputs[i], infer(forked, i), abs_threshold, rel_threshold);
+    }
+}
+
+TEST_P(ConcatSDPTest, GroupedQuantizedKVCache) {
+    auto model = function;
+    auto expectedOutputs = run_test(functionRefs);
+    // 2 groups per head, u8 for the contiguous kv cache and u4 for the paged one
+    configuration.insert({ov::intel_cpu::kv_cache_group_size.name(), "32"});
+    for (auto&& precision : {ov::element::u8, ov::element::u4}) {
+        function = model;
+        configuration[ov::hint::kv_cache_precision.name()] = precision.get_type_name();
+        configuration[ov::intel_cpu::kv_cache_page_size.name()] = precision == ov::element::u4 ? "4" : "0";
+        auto actualOutputs = run_test(function);
+        // u4 keeps 16 levels per group
+        auto threshold = precision == ov::element::u4 ? 0.25f : 0.05f;
+        for (size_t i = 0; i < actualOutputs.size(); i++) {
+            ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], threshold, threshold);
+        }
+    }
+}
+
+TEST_P(ConcatSDPTest, TensorParallel) {
+    auto model = function;
+    auto expectedOutputs = run_test(functionRefs);
+    // on the multi-socket machines the decoding heads are split across the sockets, otherwise it's the common path
+    function = model;
+    configuration.insert({ov::hint::performance_mode.name(), ov::hint::PerformanceMode::LATENCY});
+    configuration.insert({ov::hint::model_distribution_policy.name(),
+                          std::set<ov::hint::ModelDistributionPolicy>{ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL}});
+    auto actualOutputs = run_test(function);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
 namespace {
 const std::vector<std::vector<InputShape>> inputShapes = {
     // greedy search
@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/opsets/opset13.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                              param
+                 ____________/  |  \____________
+                /               |               \
+             MatMul           MatMul   ...     Reshape
+               |                |                 |
+              Relu             Relu            Reshape
+               |                |                 |
+             MatMul           MatMul             Add
+               |                |                 |
+            Sigmoid  Result  Sigmoid              |
+                \____________   |   _____________/
+                             \  |  /
+                              Concat
+                                |
+                              Result
+
+The branches are independent, so they are executed concurrently in the dataflow mode. The in-place Reshape
+branch and the extra Result check that the memory shared by the edges is not accessed out of the order.
+*/
+
+namespace ov {
+namespace test {
+
+class DataflowExecutionTest : public testing::WithParamInterface<size_t>, virtual public SubgraphBaseStaticTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<size_t>& obj) {
+        std::ostringstream result;
+        result << "branches=" << obj.param;
+        return result.str();
+    }
+
+    static std::shared_ptr<ov::Model> makeModel(size_t branches, size_t batch, size_t channels) {
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::opset13::Parameter>(precision, ov::Shape{batch, channels});
+
+        const ov::test::utils::InputGenerateData weightsData(-1, 2, 1000);
+        ov::OutputVector concatInputs;
+        ov::ResultVector results;
+        for (size_t i = 0; i < branches; i++) {
+            auto weights0 = ov::test::utils::make_constant(precision, ov::Shape{channels, channels}, weightsData);
+            auto matmul0 = std::make_shared<ov::opset13::MatMul>(param, weights0);
+            auto relu = std::make_shared<ov::opset13::Relu>(matmul0);
+            auto weights1 = ov::test::utils::make_constant(precision, ov::Shape{channels, channels}, weightsData);
+            auto matmul1 = std::make_shared<ov::opset13::MatMul>(relu, weights1);
+            auto sigmoid = std::make_shared<ov::opset13::Sigmoid>(matmul1);
+            concatInputs.push_back(sigmoid);
+            if (i == 0) {
+                results.push_back(std::make_shared<ov::opset13::Result>(relu));
+            }
+        }
+
+        auto shape0 = ov::opset13::Constant::create(ov::element::i64, {3}, std::vector<size_t>{batch, channels / 2, 2});
+        auto reshape0 = std::make_shared<ov::opset13::Reshape>(param, shape0, false);
+        auto shape1 = ov::opset13::Constant::create(ov::element::i64, {2}, std::vector<size_t>{batch, channels});
+        auto reshape1 = std::make_shared<ov::opset13::Reshape>(reshape0, shape1, false);
+        auto add = std::make_shared<ov::opset13::Add>(reshape1, ov::opset13::Constant::create(precision, {1}, {1.f}));
+        concatInputs.push_back(add);
+
+        auto concat = std::make_shared<ov::opset13::Concat>(concatInputs, 0);
+        results.insert(results.begin(), std::make_shared<ov::opset13::Result>(concat));
+        return std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "DataflowExecution");
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const size_t batch = 4, channels = 64;
+        init_input_shapes(static_shapes_to_test_representation({ov::Shape{batch, channels}}));
+        function = makeModel(GetParam(), batch, channels);
+        configuration.insert(ov::intel_cpu::dataflow_execution(true));
+    }
+};
+
+TEST_P(DataflowExecutionTest, CompareWithRefs) {
+    run();
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::dataflow_execution));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_DataflowExecution,
+                         DataflowExecutionTest,
+                         ::testing::Values(1, 4, 16),
+                         DataflowExecutionTest::getTestCaseName);
+
+// The independent branches are serialized when the concurrent execution doesn't fit into the memory budget
+TEST(DataflowExecutionBudget, serialize_branches) {
+    ov::Core core;
+    auto model = DataflowExecutionTest::makeModel(8, 16, 64);
+    auto compiled = core.compile_model(model,
+                                       ov::test::utils::DEVICE_CPU,
+                                       ov::num_streams(1),
+                                       ov::intel_cpu::dataflow_execution(true));
+    const uint64_t plannedSize = compiled.get_property(ov::intel_cpu::peak_activation_memory_size);
+    const uint64_t sequentialSize = core.compile_model(model, ov::test::utils::DEVICE_CPU, ov::num_streams(1))
+                                        .get_property(ov::intel_cpu::peak_activation_memory_size);
+    if (sequentialSize >= plannedSize) {
+        GTEST_SKIP() << "The dataflow execution is not applicable";
+    }
+
+    ASSERT_NO_THROW(compiled = core.compile_model(model,
+                                                  ov::test::utils::DEVICE_CPU,
+                                                  ov::num_streams(1),
+                                                  ov::intel_cpu::dataflow_execution(true),
+                                                  ov::intel_cpu::activation_memory_budget(plannedSize - 1)));
+    ASSERT_LT(compiled.get_property(ov::intel_cpu::peak_activation_memory_size), plannedSize);
+
+    auto request = compiled.create_infer_request();
+    request.set_input_tensor(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{16, 64}));
+    ASSERT_NO_THROW(request.infer());
+}
+
+// The compiled model reports the execution mode the graph has actually chosen
+TEST(DataflowExecutionFallback, dynamic_model) {
+    ov::Core core;
+    auto model = DataflowExecutionTest::makeModel(4, 4, 64);
+    model->reshape(ov::PartialShape{ov::Dimension::dynamic(), 64});
+    auto compiled = core.compile_model(model,
+                                       ov::test::utils::DEVICE_CPU,
+                                       ov::num_streams(1),
+                                       ov::intel_cpu::dataflow_execution(true));
+    ASSERT_FALSE(compiled.get_property(ov::intel_cpu::dataflow_execution));
+
+    auto request = compiled.create_infer_request();
+    request.set_input_tensor(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{4, 64}));
+    ASSERT_NO_THROW(request.infer());
+}
+
+}  // namespace test
+}  // namespace ov
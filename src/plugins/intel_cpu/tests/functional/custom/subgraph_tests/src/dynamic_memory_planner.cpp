@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/opsets/opset13.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+          param
+            |
+          MatMul
+            |
+          Relu
+            |    \
+          MatMul  |
+            |    /
+           Add
+            |
+         Sigmoid
+            |
+          Result
+
+The intermediate tensors of the dynamic shape model are placed to the arena of the dynamic memory planner. The
+shapes grow and shrink between the inferences, so the tensors are moved to the overflow buffers and back to the
+re-solved arena slots.
+*/
+
+namespace ov {
+namespace test {
+
+class DynamicMemoryPlannerTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const size_t channels = 32;
+        InputShape inputShape{{-1, channels},
+                              {{1, channels}, {16, channels}, {4, channels}, {64, channels}, {2, channels}}};
+        init_input_shapes({inputShape});
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::opset13::Parameter>(precision, inputDynamicShapes.front());
+        const ov::test::utils::InputGenerateData weightsData(-1, 2, 1000);
+        auto weights0 = ov::test::utils::make_constant(precision, ov::Shape{channels, channels}, weightsData);
+        auto matmul0 = std::make_shared<ov::opset13::MatMul>(param, weights0);
+        auto relu = std::make_shared<ov::opset13::Relu>(matmul0);
+        auto weights1 = ov::test::utils::make_constant(precision, ov::Shape{channels, channels}, weightsData);
+        auto matmul1 = std::make_shared<ov::opset13::MatMul>(relu, weights1);
+        auto add = std::make_shared<ov::opset13::Add>(matmul1, relu);
+        auto sigmoid = std::make_shared<ov::opset13::Sigmoid>(add);
+        auto result = std::make_shared<ov::opset13::Result>(sigmoid);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "DynamicMemory");
+    }
+};
+
+TEST_F(DynamicMemoryPlannerTest, smoke_CompareWithRefs) {
+    run();
+    // at least the biggest intermediate tensor has been allocated
+    const uint64_t peakSize = compiledModel.get_property(ov::intel_cpu::peak_activation_memory_size);
+    ASSERT_GE(peakSize, 64 * 32 * sizeof(float));
+}
+
+// The growing shape doesn't fit into the budget next to the arena solved for the small shape, so the inference is
+// repeated with the re-solved arena instead of failing
+TEST_F(DynamicMemoryPlannerTest, smoke_BudgetResolve) {
+    ov::Core core;
+    const auto bigShape = ov::Shape{64, 32}, smallShape = ov::Shape{1, 32};
+    auto infer = [&](ov::CompiledModel& compiled, const std::vector<ov::Shape>& shapes) {
+        auto request = compiled.create_infer_request();
+        for (const auto& shape : shapes) {
+            request.set_input_tensor(ov::test::utils::create_and_fill_tensor(ov::element::f32, shape));
+            request.infer();
+        }
+    };
+
+    auto compiled = core.compile_model(function, ov::test::utils::DEVICE_CPU, ov::num_streams(1));
+    infer(compiled, {bigShape, bigShape});
+    const uint64_t budget = compiled.get_property(ov::intel_cpu::peak_activation_memory_size);
+
+    compiled = core.compile_model(function,
+                                  ov::test::utils::DEVICE_CPU,
+                                  ov::num_streams(1),
+                                  ov::intel_cpu::activation_memory_budget(budget));
+    ASSERT_NO_THROW(infer(compiled, {smallShape, bigShape, smallShape, bigShape}));
+    ASSERT_LE(compiled.get_property(ov::intel_cpu::peak_activation_memory_size), budget);
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/opsets/opset13.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+          param
+            |
+          MatMul
+            |
+          Relu
+            |
+          MatMul
+            |
+         Softmax
+            |
+          Result
+
+The small model is dominated by the per inference overhead, which is reduced by the execution plan replay.
+*/
+
+namespace ov {
+namespace test {
+
+class ExecutionPlanTest : public testing::WithParamInterface<bool>, virtual public SubgraphBaseStaticTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<bool>& obj) {
+        std::ostringstream result;
+        result << "replay=" << obj.param;
+        return result.str();
+    }
+
+    static std::shared_ptr<ov::Model> makeModel(size_t batch, size_t channels) {
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::opset13::Parameter>(precision, ov::Shape{batch, channels});
+
+        const ov::test::utils::InputGenerateData weightsData(-1, 2, 1000);
+        auto weights0 = ov::test::utils::make_constant(precision, ov::Shape{channels, channels}, weightsData);
+        auto matmul0 = std::make_shared<ov::opset13::MatMul>(param, weights0);
+        auto relu = std::make_shared<ov::opset13::Relu>(matmul0);
+        auto weights1 = ov::test::utils::make_constant(precision, ov::Shape{channels, channels}, weightsData);
+        auto matmul1 = std::make_shared<ov::opset13::MatMul>(relu, weights1);
+        auto softmax = std::make_shared<ov::opset13::Softmax>(matmul1, 1);
+        auto result = std::make_shared<ov::opset13::Result>(softmax);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "ExecutionPlan");
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes(static_shapes_to_test_representation({ov::Shape{batch, channels}}));
+        function = makeModel(batch, channels);
+        configuration.insert(ov::intel_cpu::execution_plan_replay(GetParam()));
+    }
+
+    static constexpr size_t batch = 2;
+    static constexpr size_t channels = 16;
+};
+
+// The plan is built by the first inference, the following ones replay it with the new input and output tensors
+TEST_P(ExecutionPlanTest, CompareWithRefsRebindTensors) {
+    compile_model();
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::execution_plan_replay), GetParam());
+    inferRequest = compiledModel.create_infer_request();
+    for (size_t i = 0; i < 3; i++) {
+        generate_inputs(targetStaticShapes.front());
+        for (const auto& input : inputs) {
+            inferRequest.set_tensor(input.first, input.second);
+        }
+        inferRequest.set_output_tensor(0, ov::Tensor(ov::element::f32, ov::Shape{batch, channels}));
+        inferRequest.infer();
+        validate();
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ExecutionPlan,
+                         ExecutionPlanTest,
+                         ::testing::Values(true, false),
+                         ExecutionPlanTest::getTestCaseName);
+
+// The replay is disabled by default and doesn't hide the nodes from the performance counters
+TEST(ExecutionPlanPerfCounters, profiling_with_replay) {
+    ov::Core core;
+    // the nodes of the bigger model take more than the microsecond resolution of the counters
+    auto model = ExecutionPlanTest::makeModel(64, 256);
+    ASSERT_FALSE(core.compile_model(model, ov::test::utils::DEVICE_CPU)
+                     .get_property(ov::intel_cpu::execution_plan_replay));
+
+    auto compiled = core.compile_model(model,
+                                       ov::test::utils::DEVICE_CPU,
+                                       ov::enable_profiling(true),
+                                       ov::intel_cpu::execution_plan_replay(true));
+    auto request = compiled.create_infer_request();
+    request.set_input_tensor(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{64, 256}));
+    for (size_t i = 0; i < 2; i++) {
+        request.infer();
+    }
+    const auto profiling = request.get_profiling_info();
+    ASSERT_TRUE(std::any_of(profiling.begin(), profiling.end(), [](const ov::ProfilingInfo& info) {
+        return info.status == ov::ProfilingInfo::Status::EXECUTED && info.real_time.count() > 0;
+    }));
+}
+
+}  // namespace test
+}  // namespace ov
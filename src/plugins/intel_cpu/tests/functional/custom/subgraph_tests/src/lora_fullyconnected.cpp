@@ -0,0 +1,176 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/opsets/opset13.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+/*This test runs the following subgraph:
+
+                  param   ReadValue(A)
+                  |   \    /
+                  |   MatMul
+                  |     |
+                  |   Multiply -- ReadValue(alpha)
+       weights    |     |
+            \     |   MatMul -- ReadValue(B)
+             \    |     |
+              MatMul    |
+                  \     |
+                    Add
+                     |
+                   Result
+
+The low-rank adapter branch is fused into the FullyConnected node, the adapters read from the states are switched
+by set_state() between the inferences without recompilation.
+*/
+
+namespace ov {
+namespace test {
+
+namespace {
+constexpr size_t M = 8;
+constexpr size_t K = 32;
+constexpr size_t N = 24;
+
+// the alpha is read from the state if it's not set
+std::shared_ptr<ov::Model> makeLoraModel(const ov::Tensor& weights, const ov::Tensor& alpha = {}) {
+    const auto precision = ov::element::f32;
+    auto param = std::make_shared<ov::opset13::Parameter>(precision, ov::Shape{1, M, K});
+
+    ov::SinkVector assigns;
+    auto makeState = [&](const ov::PartialShape& shape, const std::string& name) {
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, precision, name});
+        auto readValue = std::make_shared<ov::op::v6::ReadValue>(variable);
+        assigns.push_back(std::make_shared<ov::op::v6::Assign>(readValue, variable));
+        return readValue;
+    };
+    auto loraA = makeState({-1, K}, "lora_A");
+    ov::Output<ov::Node> loraAlpha = alpha ? std::make_shared<ov::opset13::Constant>(alpha)->output(0)
+                                           : makeState({1, -1}, "lora_alpha")->output(0);
+    auto loraB = makeState({N, -1}, "lora_B");
+
+    auto matmulA = std::make_shared<ov::opset13::MatMul>(param, loraA, false, true);
+    auto multiply = std::make_shared<ov::opset13::Multiply>(matmulA, loraAlpha);
+    auto matmulB = std::make_shared<ov::opset13::MatMul>(multiply, loraB, false, true);
+
+    auto weightsConst = std::make_shared<ov::opset13::Constant>(weights);
+    auto matmul = std::make_shared<ov::opset13::MatMul>(param, weightsConst, false, true);
+    auto add = std::make_shared<ov::opset13::Add>(matmul, matmulB);
+    auto result = std::make_shared<ov::opset13::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, assigns, ov::ParameterVector{param}, "Lora");
+}
+
+// W * x + B * (alpha * (A * x))
+ov::Tensor loraReference(const ov::Tensor& input,
+                         const ov::Tensor& weights,
+                         const ov::Tensor& loraA,
+                         const ov::Tensor& loraAlpha,
+                         const ov::Tensor& loraB) {
+    const size_t rank = loraA.get_shape()[0];
+    const auto x = input.data<const float>();
+    const auto w = weights.data<const float>();
+    ov::Tensor output(ov::element::f32, ov::Shape{1, M, N});
+    auto y = output.data<float>();
+    for (size_t m = 0; m < M; m++) {
+        std::vector<float> hidden(rank);
+        for (size_t r = 0; r < rank; r++) {
+            for (size_t k = 0; k < K; k++)
+                hidden[r] += x[m * K + k] * loraA.data<const float>()[r * K + k];
+            hidden[r] *= loraAlpha.data<const float>()[loraAlpha.get_size() == 1 ? 0 : r];
+        }
+        for (size_t n = 0; n < N; n++) {
+            float acc = 0.f;
+            for (size_t k = 0; k < K; k++)
+                acc += x[m * K + k] * w[n * K + k];
+            for (size_t r = 0; r < rank; r++)
+                acc += hidden[r] * loraB.data<const float>()[n * rank + r];
+            y[m * N + n] = acc;
+        }
+    }
+    return output;
+}
+}  // namespace
+
+TEST(LoraFullyConnectedTest, SwitchAdaptersAtRuntime) {
+    const ov::test::utils::InputGenerateData data(-1, 2, 100);
+    auto weights = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{N, K}, data);
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{1, M, K}, data);
+
+    ov::Core core;
+    auto compiled = core.compile_model(makeLoraModel(weights),
+                                       ov::test::utils::DEVICE_CPU,
+                                       ov::hint::inference_precision(ov::element::f32));
+    // the adapter branch is executed by the FullyConnected node
+    CPUTestUtils::CheckNumberOfNodesWithType(compiled, "FullyConnected", 1);
+    CPUTestUtils::CheckNumberOfNodesWithTypes(compiled, {"MatMul", "Eltwise", "Subgraph"}, 0);
+
+    auto request = compiled.create_infer_request();
+    request.set_input_tensor(input);
+    auto setAdapter = [&](const ov::Tensor& loraA, const ov::Tensor& loraAlpha, const ov::Tensor& loraB) {
+        for (auto&& state : request.query_state()) {
+            if (state.get_name() == "lora_A") {
+                state.set_state(loraA);
+            } else if (state.get_name() == "lora_alpha") {
+                state.set_state(loraAlpha);
+            } else {
+                state.set_state(loraB);
+            }
+        }
+    };
+    auto makeAdapter = [&](size_t rank, int seed) {
+        const ov::test::utils::InputGenerateData matrixData(-1, 2, 100, seed);
+        const ov::test::utils::InputGenerateData alphaData(0, 1, 100, seed);
+        return std::vector<ov::Tensor>{
+            ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{rank, K}, matrixData),
+            ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{1, rank}, alphaData),
+            ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{N, rank}, matrixData)};
+    };
+
+    // the adapters of different ranks including the empty one (no adapter) are used by the same compiled model
+    for (size_t rank : {4, 8, 0, 4}) {
+        const auto adapter = makeAdapter(rank, static_cast<int>(rank));
+        setAdapter(adapter[0], adapter[1], adapter[2]);
+        request.infer();
+        ov::test::utils::compare(loraReference(input, weights, adapter[0], adapter[1], adapter[2]),
+                                 request.get_output_tensor(0),
+                                 1e-4f,
+                                 1e-4f);
+    }
+}
+
+// The single alpha value scales all the rank channels
+TEST(LoraFullyConnectedTest, ScalarAlpha) {
+    const ov::test::utils::InputGenerateData data(-1, 2, 100);
+    auto weights = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{N, K}, data);
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{1, M, K}, data);
+    ov::Tensor alpha(ov::element::f32, ov::Shape{});
+    alpha.data<float>()[0] = 0.5f;
+
+    ov::Core core;
+    auto compiled = core.compile_model(makeLoraModel(weights, alpha),
+                                       ov::test::utils::DEVICE_CPU,
+                                       ov::hint::inference_precision(ov::element::f32));
+    CPUTestUtils::CheckNumberOfNodesWithType(compiled, "FullyConnected", 1);
+    CPUTestUtils::CheckNumberOfNodesWithTypes(compiled, {"MatMul", "Eltwise", "Subgraph"}, 0);
+
+    const size_t rank = 4;
+    auto loraA = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{rank, K}, data);
+    auto loraB = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{N, rank}, data);
+    auto request = compiled.create_infer_request();
+    request.set_input_tensor(input);
+    for (auto&& state : request.query_state()) {
+        state.set_state(state.get_name() == "lora_A" ? loraA : loraB);
+    }
+    request.infer();
+    ov::test::utils::compare(loraReference(input, weights, loraA, alpha, loraB),
+                             request.get_output_tensor(0),
+                             1e-4f,
+                             1e-4f);
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/opsets/opset13.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+/*This test runs the activation x activation MatMul (e.g. Q x K^T of the attention):
+
+        param0   param1
+            \     /
+            MatMul
+               |
+            Result
+
+with the dynamic quantization of the inputs enabled, the results are compared with the f32 ones. The inputs are
+quantized by the whole rows, the group size smaller than K keeps the f32 MatMul.
+*/
+
+namespace ov {
+namespace test {
+
+namespace {
+std::shared_ptr<ov::Model> makeMatMulModel(const ov::PartialShape& shape0,
+                                           const ov::PartialShape& shape1,
+                                           bool transposeB) {
+    auto param0 = std::make_shared<ov::opset13::Parameter>(ov::element::f32, shape0);
+    auto param1 = std::make_shared<ov::opset13::Parameter>(ov::element::f32, shape1);
+    auto matmul = std::make_shared<ov::opset13::MatMul>(param0, param1, false, transposeB);
+    auto result = std::make_shared<ov::opset13::Result>(matmul);
+    return std::make_shared<ov::Model>(ov::ResultVector{result},
+                                       ov::ParameterVector{param0, param1},
+                                       "MatMulDynamicQuantization");
+}
+
+bool hasVnni() {
+    return ov::with_cpu_x86_avx2_vnni() || ov::with_cpu_x86_avx512_core_vnni();
+}
+
+void checkDynamicQuantization(const ov::Shape& shape0,
+                              const ov::Shape& shape1,
+                              bool transposeB,
+                              uint64_t groupSize,
+                              bool expectQuantized = true) {
+    const ov::test::utils::InputGenerateData data(-2, 4, 64, 1);
+    auto input0 = ov::test::utils::create_and_fill_tensor(ov::element::f32, shape0, data);
+    auto input1 = ov::test::utils::create_and_fill_tensor(ov::element::f32, shape1, data);
+
+    ov::Core core;
+    auto infer = [&](uint64_t dqGroupSize, const std::string& expectedPrecision) {
+        auto compiled = core.compile_model(makeMatMulModel(ov::PartialShape::dynamic(shape0.size()),
+                                                           ov::PartialShape::dynamic(shape1.size()),
+                                                           transposeB),
+                                           ov::test::utils::DEVICE_CPU,
+                                           ov::hint::inference_precision(ov::element::f32),
+                                           ov::hint::dynamic_quantization_group_size(dqGroupSize));
+        CPUTestUtils::CheckNumberOfNodesWithType(compiled, "MatMul", 1);
+        auto request = compiled.create_infer_request();
+        request.set_input_tensor(0, input0);
+        request.set_input_tensor(1, input1);
+        request.infer();
+
+        // the quantized inputs are multiplied by the int8 matmul
+        for (const auto& node : compiled.get_runtime_model()->get_ordered_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() == "MatMul") {
+                EXPECT_EQ(expectedPrecision, rtInfo.at(ov::exec_model_info::RUNTIME_PRECISION).as<std::string>());
+            }
+        }
+
+        auto output = request.get_output_tensor(0);
+        ov::Tensor copy(output.get_element_type(), output.get_shape());
+        output.copy_to(copy);
+        return copy;
+    };
+
+    const auto expected = infer(0, "f32");
+    // the int8 products of the inputs in [-2, 2] keep about two significant digits
+    ov::test::utils::compare(expected, infer(groupSize, expectQuantized ? "u8" : "f32"), 0.05f * shape0.back(), 0.05f);
+}
+}  // namespace
+
+TEST(MatMulDynamicQuantizationTest, TransposedSecondInput) {
+    if (!hasVnni())
+        GTEST_SKIP();
+    checkDynamicQuantization({2, 4, 40, 64}, {2, 4, 48, 64}, true, UINT64_MAX);
+}
+
+TEST(MatMulDynamicQuantizationTest, BroadcastedSecondInput) {
+    if (!hasVnni())
+        GTEST_SKIP();
+    checkDynamicQuantization({2, 3, 17, 96}, {1, 3, 96, 70}, false, 96);
+}
+
+TEST(MatMulDynamicQuantizationTest, GroupsSmallerThanRow) {
+    if (!hasVnni())
+        GTEST_SKIP();
+    // the row split into several groups keeps the f32 matmul
+    checkDynamicQuantization({1, 33, 80}, {1, 80, 20}, false, 16, false);
+}
+
+}  // namespace test
+}  // namespace ov
@@ -327,6 +327,33 @@ TEST_P(MatmulWeightsDecompression, CompareWithRefs) {
     check_results();
 }
 
+// the prompt sized bf16 inputs are multiplied by the weights decompressed by tiles in the jit kernel
+class MatmulWeightsDecompressionTiles : public MatmulWeightsDecompression {
+protected:
+    void check_impl_type() {
+        const auto expected = ov::with_cpu_x86_avx512_core_amx() ? "jit_avx512_amx" : "jit_avx512";
+        size_t fc_count = 0;
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            const auto& rt_info = n->get_rt_info();
+            if (rt_info.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            const auto impl_type = rt_info.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+            ASSERT_EQ(0u, impl_type.rfind(std::string(expected) + "_", 0)) << "unexpected implementation " << impl_type;
+            fc_count++;
+        }
+        ASSERT_EQ(1u, fc_count);
+    }
+};
+
+TEST_P(MatmulWeightsDecompressionTiles, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    run();
+    check_results();
+    check_impl_type();
+}
+
 namespace {
 
 std::vector<ov::AnyMap> filter_additional_config_basic() {
@@ -363,6 +390,9 @@ const std::vector<ShapeParams> input_shapes_amx = {
     {{{}, {{3, 12, 768}}}, {768, 1024}},
     {{{}, {{3, 339, 577}}}, {577, 335}},
     {{{}, {{1, 1, 256}}}, {256, 128}, 64ul},
+    // the prompt sized inputs decompressing the weights by tiles
+    {{{-1, -1, -1}, {{1, 4, 512}, {1, 128, 512}, {1, 4, 512}}}, {512, 256}, 128ul},
+    {{{}, {{2, 96, 256}}}, {256, 160}},
 };
 const std::vector<fusingSpecificParams> fusing_params{emptyFusingSpec, fusingBias};
 
@@ -394,6 +424,28 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_amx,
                                             ::testing::Values(true)),
                          MatmulWeightsDecompression::getTestCaseName);
 
+const std::vector<ShapeParams> input_shapes_tiles = {
+    {{{}, {{2, 96, 256}}}, {256, 160}},
+    {{{}, {{1, 128, 512}}}, {512, 256}, 128ul},
+    // the odd group size starts the 4 bit groups in the middle of a byte
+    {{{}, {{1, 70, 90}}}, {90, 64}, 45ul},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_tiles,
+                         MatmulWeightsDecompressionTiles,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_tiles),
+                                            ::testing::Values(ov::element::u8, ov::element::u4, ov::element::i4),
+                                            ::testing::ValuesIn(decompression_precisions),
+                                            ::testing::Values(true),
+                                            ::testing::Values(DecompressionSubtractType::full,
+                                                              DecompressionSubtractType::empty),
+                                            ::testing::Values(false),
+                                            ::testing::Values(ov::AnyMap{
+                                                {ov::hint::inference_precision(ov::element::bf16)}}),
+                                            ::testing::Values(emptyFusingSpec),
+                                            ::testing::Values(true)),
+                         MatmulWeightsDecompression::getTestCaseName);
+
 const std::vector<ShapeParams> input_shapes_corner_cases_basic = {
     {{{-1, -1, -1}, {{1, 4, 16}}}, {1, 16, 32}},
     {{{-1, -1, -1}, {{1, 4, 16}}}, {16, 32}},
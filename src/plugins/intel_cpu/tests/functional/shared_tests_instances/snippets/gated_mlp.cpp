@@ -0,0 +1,43 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/gated_mlp.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 64, 64}}},
+    {{}, {{2, 17, 33}}},
+    {{}, {{49, 128}}},
+};
+
+const std::vector<GatingActivation> activations = {GatingActivation::None, GatingActivation::Swish, GatingActivation::Gelu};
+
+// The tokenization of FullyConnected is disabled by default
+static ov::AnyMap enable_fc_tokenization() {
+    return ov::AnyMap({ov::intel_cpu::snippets_fc_tokenization(true)});
+}
+
+// Both FullyConnected, the activation and the gating Multiply are executed by one Subgraph
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_GatedMLP, GatedMLP,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(96, 19),
+                                            ::testing::ValuesIn(activations),
+                                            ::testing::Values(1),
+                                            ::testing::Values(1),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                            ::testing::Values(enable_fc_tokenization())),
+                         GatedMLP::getTestCaseName);
+
+} // namespace
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,100 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/norm.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+
+namespace {
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {{{}, {{1, 16, 64}}}},
+    {{{}, {{2, 5, 19}}}},
+    {{{}, {{1, 16, 64}}}, {{}, {{1, 16, 64}}}},
+    {{{}, {{3, 10, 33}}}, {{}, {{3, 10, 33}}}},
+};
+
+const std::vector<NormType> normTypes = {NormType::LayerNorm, NormType::RMSNorm};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Norm, Norm,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(normTypes),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(1),
+                                            ::testing::Values(1),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                            ::testing::Values(ov::AnyMap{})),
+                         Norm::getTestCaseName);
+
+// The plugin callback decides on the tokenization: the Subgraph is created for the f32 rows fitting in L2 if there
+// is at least one row per thread, the thread count is fixed to keep the decision independent of the machine
+static ov::AnyMap enable_callback() {
+    return ov::AnyMap({ov::intel_cpu::snippets_mode(ov::intel_cpu::SnippetsMode::ENABLE),
+                       ov::hint::inference_precision(ov::element::f32),
+                       ov::inference_num_threads(4)});
+}
+
+const std::vector<std::vector<InputShape>> inputShapesResidual = {
+    {{{}, {{1, 64, 2048}}}, {{}, {{1, 64, 2048}}}},
+    {{{}, {{2, 32, 3072}}}, {{}, {{2, 32, 3072}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Norm_Callback, Norm,
+                         ::testing::Combine(::testing::ValuesIn(inputShapesResidual),
+                                            ::testing::ValuesIn(normTypes),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(1),
+                                            ::testing::Values(1),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                            ::testing::Values(enable_callback())),
+                         Norm::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Norm_Callback_RMSNorm, Norm,
+                         ::testing::Combine(::testing::Values(std::vector<InputShape>{{{}, {{1, 64, 2048}}}}),
+                                            ::testing::Values(NormType::RMSNorm),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(1),
+                                            ::testing::Values(1),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                            ::testing::Values(enable_callback())),
+                         Norm::getTestCaseName);
+
+// MVN node fuses the scale and the bias itself, so LayerNorm without the residual Add is not tokenized
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Norm_Callback_MVN, Norm,
+                         ::testing::Combine(::testing::Values(std::vector<InputShape>{{{}, {{1, 64, 2048}}}}),
+                                            ::testing::Values(NormType::LayerNorm),
+                                            ::testing::Values(false),
+                                            ::testing::Values(1),
+                                            ::testing::Values(0),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                            ::testing::Values(enable_callback())),
+                         Norm::getTestCaseName);
+
+// Typical hidden sizes of LLMs
+const std::vector<std::vector<InputShape>> inputShapesLLM = {
+    {{{}, {{1, 128, 2048}}}, {{}, {{1, 128, 2048}}}},
+    {{{}, {{1, 128, 4096}}}, {{}, {{1, 128, 4096}}}},
+    {{{}, {{1, 128, 5120}}}, {{}, {{1, 128, 5120}}}},
+    {{{}, {{1, 128, 8192}}}, {{}, {{1, 128, 8192}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(nightly_Snippets_Norm_LLM, Norm,
+                         ::testing::Combine(::testing::ValuesIn(inputShapesLLM),
+                                            ::testing::ValuesIn(normTypes),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(1),
+                                            ::testing::Values(1),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                            ::testing::Values(enable_callback())),
+                         Norm::getTestCaseName);
+
+} // namespace
+} // namespace snippets
+} // namespace test
+} // namespace ov
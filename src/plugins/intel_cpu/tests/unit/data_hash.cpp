@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "utils/data_hash.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(DataHashTest, DependsOnEachByte) {
+    // a few chunks and the tail shorter than a word
+    std::vector<uint8_t> data((3 << 20) + 13);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>(i * 7);
+    const auto hash = hashData(data.data(), data.size());
+    ASSERT_EQ(hash, hashData(std::vector<uint8_t>(data).data(), data.size()));
+
+    for (size_t pos : {size_t(0), size_t(5), size_t(1 << 20), data.size() - 1}) {
+        data[pos] ^= 1;
+        ASSERT_NE(hash, hashData(data.data(), data.size())) << "byte " << pos;
+        data[pos] ^= 1;
+    }
+    // the zero bytes at the end are not ignored
+    ASSERT_NE(hashData(std::vector<uint8_t>(8).data(), 8), hashData(std::vector<uint8_t>(9).data(), 9));
+}
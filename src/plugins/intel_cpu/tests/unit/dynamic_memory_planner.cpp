@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "dynamic_memory_planner.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::vector<ov::MemorySolver::Box> makeBoxes() {
+    // tensors 0 and 2 don't overlap in time, tensor 1 overlaps with both of them
+    return {{0, 1, 0, 0}, {1, 2, 0, 0}, {2, 3, 0, 0}};
+}
+
+MemoryDescPtr makeDesc(size_t elements) {
+    return std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{elements});
+}
+}  // namespace
+
+TEST(DynamicMemoryPlannerTest, OverflowThenArena) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    DynamicMemoryPlanner planner(makeBoxes());
+
+    std::vector<std::unique_ptr<Memory>> memories;
+    for (size_t i = 0; i < 3; i++) {
+        memories.emplace_back(new Memory(eng, makeDesc(256), planner.getMemoryMngr(i)));
+    }
+    // the arena is empty before the first update, so the tensors are in the overflow buffers shared by the tensors
+    // with non-overlapping lifetimes
+    ASSERT_EQ(planner.getArenaSize(), 0u);
+    for (const auto& memory : memories) {
+        ASSERT_NE(memory->getData(), nullptr);
+    }
+    ASSERT_EQ(memories[0]->getData(), memories[2]->getData());
+    ASSERT_NE(memories[0]->getData(), memories[1]->getData());
+
+    planner.update();
+    // the tensors 0 and 2 share the slot
+    ASSERT_EQ(planner.getArenaSize(), 2 * 256 * sizeof(float));
+    ASSERT_EQ(memories[0]->getData(), memories[2]->getData());
+    ASSERT_NE(memories[0]->getData(), memories[1]->getData());
+    // the oneDNN memory objects follow the new slots
+    ASSERT_EQ(memories[1]->getPrimitive().get_data_handle(), memories[1]->getData());
+    ASSERT_EQ(planner.getPeakSize(), 2 * 256 * sizeof(float));
+
+    // smaller shapes stay in the arena
+    auto arenaPtr = memories[1]->getData();
+    memories[1]->redefineDesc(makeDesc(128));
+    ASSERT_EQ(memories[1]->getData(), arenaPtr);
+    planner.update();
+    ASSERT_EQ(planner.getArenaSize(), 2 * 256 * sizeof(float));
+
+    // a bigger shape moves the tensor to the overflow buffer until the offsets are re-solved
+    memories[1]->redefineDesc(makeDesc(1024));
+    ASSERT_NE(memories[1]->getData(), arenaPtr);
+    planner.update();
+    ASSERT_EQ(planner.getArenaSize(), (256 + 1024) * sizeof(float));
+    ASSERT_EQ(memories[0]->getData(), memories[2]->getData());
+    ASSERT_EQ(memories[1]->getPrimitive().get_data_handle(), memories[1]->getData());
+}
+
+TEST(DynamicMemoryPlannerTest, SharedOverflowFollowsGrowth) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    DynamicMemoryPlanner planner(makeBoxes());
+
+    Memory memory0(eng, makeDesc(256), planner.getMemoryMngr(0));
+    Memory memory2(eng, makeDesc(256), planner.getMemoryMngr(2));
+    // the buffer shared before the first update is reallocated by the tensor 2, the tensor 0 follows it
+    memory2.redefineDesc(makeDesc(1024));
+    ASSERT_EQ(memory0.getData(), memory2.getData());
+    ASSERT_EQ(memory0.getPrimitive().get_data_handle(), memory2.getData());
+}
+
+TEST(DynamicMemoryPlannerTest, Budget) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    // the budget is below the sum of the tensors after the growth, but fits the solved arena
+    const size_t budget = (256 + 1024) * sizeof(float);
+    DynamicMemoryPlanner planner(makeBoxes(), budget);
+
+    std::vector<std::unique_ptr<Memory>> memories;
+    for (size_t i = 0; i < 3; i++) {
+        memories.emplace_back(new Memory(eng, makeDesc(256), planner.getMemoryMngr(i)));
+    }
+    ASSERT_TRUE(planner.update());
+    ASSERT_EQ(planner.getArenaSize(), 2 * 256 * sizeof(float));
+
+    // the arena and the overflow buffer would exceed the budget
+    ASSERT_THROW(memories[1]->redefineDesc(makeDesc(1024)), ov::Exception);
+    ASSERT_TRUE(planner.isBudgetExceeded());
+
+    // the failed size is taken into account by the next solve, so the tensor fits into the new slot
+    ASSERT_TRUE(planner.update());
+    ASSERT_FALSE(planner.isBudgetExceeded());
+    ASSERT_EQ(planner.getArenaSize(), budget);
+    ASSERT_NO_THROW(memories[1]->redefineDesc(makeDesc(1024)));
+    ASSERT_EQ(memories[0]->getData(), memories[2]->getData());
+    ASSERT_NE(memories[0]->getData(), memories[1]->getData());
+    ASSERT_LE(planner.getPeakSize(), budget);
+}
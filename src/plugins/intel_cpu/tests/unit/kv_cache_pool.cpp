@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "kv_cache_pool.h"
+#include "openvino/core/except.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(KVCachePagePoolTests, AllocateRelease) {
+    KVCachePagePool pool(16);
+    auto arena = pool.getArena(1024);
+    ASSERT_EQ(arena, pool.getArena(1024));
+    ASSERT_NE(arena, pool.getArena(2048));
+
+    auto page0 = arena->allocate();
+    auto page1 = arena->allocate();
+    ASSERT_NE(page0, page1);
+    ASSERT_EQ(arena->getUsedPages(), 2u);
+    ASSERT_EQ(pool.getUsedSize(), 2u * 1024);
+    ASSERT_GE(pool.getAllocatedSize(), arena->getTotalPages() * 1024);
+
+    arena->release(page0);
+    ASSERT_EQ(arena->getUsedPages(), 1u);
+    // the released page is reused first
+    ASSERT_EQ(arena->allocate(), page0);
+    arena->release(page0);
+    arena->release(page1);
+    ASSERT_EQ(pool.getUsedSize(), 0u);
+    ASSERT_THROW(arena->release(page1), ov::Exception);
+}
+
+TEST(KVCachePagePoolTests, SharedPage) {
+    KVCachePagePool pool(16);
+    auto arena = pool.getArena(64);
+    auto page = arena->allocate();
+    ASSERT_FALSE(arena->isShared(page));
+    arena->addRef(page);
+    ASSERT_TRUE(arena->isShared(page));
+    arena->release(page);
+    ASSERT_FALSE(arena->isShared(page));
+    ASSERT_EQ(arena->getUsedPages(), 1u);
+    arena->release(page);
+    ASSERT_EQ(arena->getUsedPages(), 0u);
+}
+
+TEST(KVCachePagePoolTests, GrowKeepsPagesInPlace) {
+    KVCachePagePool pool(16);
+    auto arena = pool.getArena(sizeof(int));
+    auto data = arena->data();
+    auto first = arena->allocate();
+    *reinterpret_cast<int*>(data + first * sizeof(int)) = 42;
+    auto initialPages = arena->getTotalPages();
+    std::vector<int32_t> pages;
+    arena->allocate(initialPages, pages);
+    ASSERT_EQ(pages.size(), initialPages);
+    ASSERT_GT(arena->getTotalPages(), initialPages);
+    // the new chunk is committed right after the previous one, so the pages never move
+    ASSERT_EQ(arena->data(), data);
+    ASSERT_EQ(*reinterpret_cast<int*>(data + first * sizeof(int)), 42);
+    for (auto page : pages) {
+        *reinterpret_cast<int*>(data + page * sizeof(int)) = page;
+    }
+}
+
+TEST(KVCachePagePoolTests, ShrinkKeepsOneFreeChunk) {
+    KVCachePagePool pool(16);
+    auto arena = pool.getArena(64 * 1024);
+    auto chunkPages = arena->getChunkPages();
+    std::vector<int32_t> pages;
+    arena->allocate(4 * chunkPages, pages);
+    ASSERT_EQ(arena->getTotalPages(), 4 * chunkPages);
+    for (auto page : pages) {
+        arena->release(page);
+    }
+    ASSERT_EQ(arena->getUsedPages(), 0u);
+    ASSERT_EQ(arena->getTotalPages(), chunkPages);
+    // the pages of the decommitted chunks are not reused until the chunk is committed again
+    pages.clear();
+    arena->allocate(chunkPages + 1, pages);
+    ASSERT_EQ(arena->getTotalPages(), 2 * chunkPages);
+    for (auto page : pages) {
+        std::memset(arena->data() + page * arena->getPageBytes(), 0, arena->getPageBytes());
+        arena->release(page);
+    }
+}
+
+TEST(KVCachePagePoolTests, ConcurrentAccessDuringGrow) {
+    KVCachePagePool pool(16);
+    auto arena = pool.getArena(256);
+    auto page = arena->allocate();
+    auto* value = reinterpret_cast<std::atomic<int>*>(arena->data() + page * arena->getPageBytes());
+    value->store(0);
+    std::atomic<bool> done{false};
+    // the reader keeps using the page while the other thread grows the arena
+    std::thread reader([&] {
+        while (!done.load()) {
+            value->fetch_add(1);
+            arena->addRef(page);
+            arena->release(page);
+        }
+    });
+    std::vector<int32_t> pages;
+    for (int i = 0; i < 8; i++) {
+        arena->allocate(arena->getChunkPages(), pages);
+    }
+    done = true;
+    reader.join();
+    ASSERT_GT(value->load(), 0);
+    ASSERT_FALSE(arena->isShared(page));
+    ASSERT_EQ(arena->getUsedPages(), pages.size() + 1);
+}
@@ -0,0 +1,188 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "nodes/kernels/scaled_attn/attn_quant.hpp"
+#include "nodes/kernels/scaled_attn/mha_single_token.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::Extensions::Cpu::XARCH;
+
+namespace {
+
+std::vector<float> random_data(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> data(n);
+    for (auto& v : data)
+        v = dist(gen);
+    return data;
+}
+
+// quantizes the rows of [tokens, heads, n] into the pages [blocks, heads, block_size, row_bytes]
+std::vector<uint8_t> quantize_pages(const std::vector<float>& src, size_t tokens, size_t heads, size_t n,
+                                    size_t block_size, size_t groups, ov::element::Type precision) {
+    auto row_bytes = quant_row_bytes(n, groups, precision);
+    auto blocks = (tokens + block_size - 1) / block_size;
+    // garbage in the pages makes sure that each row is fully rewritten
+    std::vector<uint8_t> pages(blocks * heads * block_size * row_bytes, 0xFF);
+    for (size_t t = 0; t < tokens; t++) {
+        for (size_t h = 0; h < heads; h++) {
+            auto row = pages.data() + ((t / block_size * heads + h) * block_size + t % block_size) * row_bytes;
+            attn_quant_row(src.data() + (t * heads + h) * n, row, n, groups, precision);
+        }
+    }
+    return pages;
+}
+
+}  // namespace
+
+TEST(PagedKVCacheKernelsTest, QuantRowU4Tail) {
+    // the sizes not divisible by 16 end with a partially filled chunk of 8 bytes
+    for (size_t n : {8, 24, 40, 72, 136}) {
+        auto src = random_data(n, static_cast<unsigned>(n));
+        std::vector<uint8_t> row(quant_row_bytes(n, 1, ov::element::u4), 0xFF);
+        attn_quant_row(src.data(), row.data(), n, 1, ov::element::u4);
+        std::vector<float> dst(n);
+        attn_dequant_row(row.data(), dst.data(), n, 1, ov::element::u4);
+        auto scale = reinterpret_cast<float*>(row.data())[0];
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_NEAR(src[i], dst[i], scale / 2 + 1e-5f) << "n " << n << " feature " << i;
+        }
+    }
+}
+
+TEST(PagedKVCacheKernelsTest, SingleTokenU4DifferentValueHeadSize) {
+    // the key and value heads differ and neither is a multiple of 16
+    const size_t B = 1, H = 2, S = 40, SV = 24, context_len = 7, block_size = 4;
+    const auto precision = ov::element::u4;
+    const auto blocks = (context_len + block_size - 1) / block_size;
+
+    auto q = random_data(B * H * S, 1);
+    auto k = random_data(context_len * H * S, 2);
+    auto v = random_data(context_len * H * SV, 3);
+    auto k_pages = quantize_pages(k, context_len, H, S, block_size, 1, precision);
+    auto v_pages = quantize_pages(v, context_len, H, SV, block_size, 1, precision);
+
+    PlainTensor query, present_key, present_value, block_table, context_lens, output;
+    query.resize<float>({B, H, 1, S}, q.data());
+    present_key.resize({blocks, H, block_size, quant_row_bytes(S, 1, precision)}, 1, precision, k_pages.data());
+    present_value.resize({blocks, H, block_size, quant_row_bytes(SV, 1, precision)}, 1, precision, v_pages.data());
+    block_table.resize<int32_t>({B, blocks});
+    for (size_t i = 0; i < blocks; i++)
+        block_table.ptr<int32_t>(0)[i] = static_cast<int32_t>(i);
+    context_lens.resize<int32_t>({B});
+    context_lens.ptr<int32_t>()[0] = static_cast<int32_t>(context_len);
+    output.resize<float>({B, H, 1, SV});
+
+    PlainTensor attn_w, attn_score, head_sum;
+    attn_w.resize<float>({B, H, 1, (context_len + 15) / 16 * 16});
+    mha_single_token(query, present_key, present_value, {}, {}, block_table, {}, context_len, context_lens, {},
+                     output, attn_w, attn_score, false, false, 0.0f, {}, {}, head_sum);
+
+    // the reference works on the dequantized cache, so only the rounding of the accumulation differs
+    std::vector<float> k_ref(S), v_ref(SV);
+    for (size_t h = 0; h < H; h++) {
+        std::vector<float> w(context_len);
+        float w_max = -INFINITY;
+        for (size_t t = 0; t < context_len; t++) {
+            attn_dequant_row(present_key.ptr<uint8_t>(t / block_size, h, t % block_size), k_ref.data(), S, 1, precision);
+            float dot = 0.0f;
+            for (size_t i = 0; i < S; i++)
+                dot += q[h * S + i] * k_ref[i];
+            w[t] = dot / std::sqrt(static_cast<float>(S));
+            w_max = std::max(w_max, w[t]);
+        }
+        float w_sum = 0.0f;
+        for (auto& wt : w) {
+            wt = std::exp(wt - w_max);
+            w_sum += wt;
+        }
+        std::vector<float> expected(SV, 0.0f);
+        for (size_t t = 0; t < context_len; t++) {
+            attn_dequant_row(present_value.ptr<uint8_t>(t / block_size, h, t % block_size), v_ref.data(), SV, 1, precision);
+            for (size_t i = 0; i < SV; i++)
+                expected[i] += w[t] / w_sum * v_ref[i];
+        }
+        for (size_t i = 0; i < SV; i++) {
+            ASSERT_NEAR(expected[i], output.ptr<float>(0, h, 0)[i], 1e-4f) << "head " << h << " feature " << i;
+        }
+    }
+}
+
+TEST(PagedKVCacheKernelsTest, ChunkedPrefillMixedBatch) {
+    // the sequence 0 appends a chunk of 3 tokens to the cached prefix of 6 tokens, the sequence 1 decodes 1 token,
+    //  so its last 2 queries are padding
+    const size_t B = 2, H = 2, S = 32, q_len = 3, block_size = 4, max_blocks = 3;
+    const std::vector<int32_t> lens = {9, 5}, q_lens = {3, 1};
+    const std::vector<std::vector<int32_t>> blocks = {{0, 1, 2}, {3, 4}};
+    const size_t total_blocks = 5;
+
+    auto q = random_data(B * H * q_len * S, 1);
+    auto k = random_data(total_blocks * H * block_size * S, 2);
+    auto v = random_data(total_blocks * H * block_size * S, 3);
+
+    PlainTensor query, present_key, present_value, block_table, context_lens, query_lens, output;
+    query.resize<float>({B, H, q_len, S}, q.data());
+    present_key.resize<float>({total_blocks, H, block_size, S}, k.data());
+    present_value.resize<float>({total_blocks, H, block_size, S}, v.data());
+    block_table.resize<int32_t>({B, max_blocks});
+    context_lens.resize<int32_t>({B});
+    query_lens.resize<int32_t>({B});
+    for (size_t b = 0; b < B; b++) {
+        for (size_t i = 0; i < max_blocks; i++)
+            block_table.ptr<int32_t>(b)[i] = i < blocks[b].size() ? blocks[b][i] : -1;
+        context_lens.ptr<int32_t>()[b] = lens[b];
+        query_lens.ptr<int32_t>()[b] = q_lens[b];
+    }
+    // the outputs of the padding queries must be overwritten
+    std::vector<float> out(B * H * q_len * S, NAN);
+    output.resize<float>({B, H, q_len, S}, out.data());
+
+    PlainTensor attn_w, attn_score, head_sum;
+    attn_w.resize<float>({B, H, q_len, (lens[0] + 15) / 16 * 16});
+    mha_single_token(query, present_key, present_value, {}, {}, block_table, {}, lens[0], context_lens, query_lens,
+                     output, attn_w, attn_score, false, true, 0.0f, {}, {}, head_sum);
+
+    for (size_t b = 0; b < B; b++) {
+        for (size_t h = 0; h < H; h++) {
+            for (size_t pq = 0; pq < q_len; pq++) {
+                std::vector<float> expected(S, 0.0f);
+                if (pq < static_cast<size_t>(q_lens[b])) {
+                    // the queries are the last tokens of the sequence and attend causally
+                    auto n = static_cast<size_t>(lens[b] - q_lens[b]) + pq + 1;
+                    std::vector<float> w(n);
+                    float w_max = -INFINITY, w_sum = 0.0f;
+                    for (size_t t = 0; t < n; t++) {
+                        auto* key = present_key.ptr<float>(blocks[b][t / block_size], h, t % block_size);
+                        float dot = 0.0f;
+                        for (size_t i = 0; i < S; i++)
+                            dot += query.ptr<float>(b, h, pq)[i] * key[i];
+                        w[t] = dot / std::sqrt(static_cast<float>(S));
+                        w_max = std::max(w_max, w[t]);
+                    }
+                    for (auto& wt : w) {
+                        wt = std::exp(wt - w_max);
+                        w_sum += wt;
+                    }
+                    for (size_t t = 0; t < n; t++) {
+                        auto* value = present_value.ptr<float>(blocks[b][t / block_size], h, t % block_size);
+                        for (size_t i = 0; i < S; i++)
+                            expected[i] += w[t] / w_sum * value[i];
+                    }
+                }
+                for (size_t i = 0; i < S; i++) {
+                    ASSERT_NEAR(expected[i], output.ptr<float>(b, h, pq)[i], 1e-5f)
+                        << "sequence " << b << " head " << h << " query " << pq << " feature " << i;
+                }
+            }
+        }
+    }
+}
@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 
 using namespace ov::intel_cpu;
 
@@ -96,6 +97,65 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(LruCacheTests, Statistics) {
+    constexpr int capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.size(), capacity);
+
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.get({i});
+    }
+
+    const auto& statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, capacity);
+    ASSERT_EQ(statistics.misses, capacity);
+    ASSERT_EQ(statistics.evictions, capacity);
+}
+
+TEST(ShardedLruCacheTests, Get) {
+    constexpr int capacity = 16;
+    constexpr size_t shards = 4;
+    ShardedLruCache<IntKey, int> cache(capacity, shards);
+    ASSERT_EQ(cache.getShardsNum(), shards);
+    ASSERT_EQ(cache.getCapacity(), capacity);
+
+    // the keys are evenly distributed between the shards, so all of them fit
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.size(), capacity);
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    // the shard of the key 0 is full, so the least recently used key of this shard is evicted
+    ASSERT_NO_THROW(cache.put({0}, 100));
+    ASSERT_EQ(cache.get({0}), 100);
+    ASSERT_EQ(cache.get({4}), int());
+    ASSERT_EQ(cache.get({8}), 8);
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, capacity + 2);
+    ASSERT_EQ(statistics.misses, 1);
+    ASSERT_EQ(statistics.evictions, 1);
+
+    ASSERT_NO_THROW(cache.evict(capacity));
+    ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(ShardedLruCacheTests, SmallCapacity) {
+    ShardedLruCache<IntKey, int> cache(2);
+    ASSERT_EQ(cache.getShardsNum(), 2);
+
+    ShardedLruCache<IntKey, int> empty(0);
+    ASSERT_EQ(empty.getShardsNum(), 1);
+    ASSERT_NO_THROW(empty.put({1}, 1));
+    ASSERT_EQ(empty.get({1}), int());
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -379,3 +439,46 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SharedCacheConcurrentAccess) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 64;
+    constexpr size_t numThreads = 16;
+    constexpr int iterations = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, true);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int j = 0; j < iterations; ++j) {
+            for (int i = 0; i < capacity; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+                auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+                ASSERT_NE(strResult.first, StrValueType());
+                ASSERT_EQ(*strResult.first, std::to_string(i));
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto statistics = cache.getStatistics();
+    const size_t lookups = 2 * capacity * iterations * numThreads;
+    ASSERT_EQ(statistics.hits + statistics.misses, lookups);
+    // the records are built by the first lookups, the rest of the threads reuse them
+    ASSERT_GE(statistics.misses, 2 * capacity);
+    ASSERT_LT(statistics.misses, lookups / 2);
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "scratch_pad_pool.h"
+
+using namespace ov::intel_cpu;
+
+TEST(ScratchPadPoolTest, SharedByCoreSet) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    ScratchPadPool pool;
+
+    auto entry0 = pool.get(eng, 0, {0, 1, 2, 3});
+    // the order of the cores doesn't matter
+    auto entry1 = pool.get(eng, 0, {3, 2, 1, 0});
+    ASSERT_EQ(entry0, entry1);
+    ASSERT_NE(entry0, pool.get(eng, 0, {4, 5, 6, 7}));
+    ASSERT_NE(entry0, pool.get(eng, 1, {0, 1, 2, 3}));
+
+    // the buffer is sized to the biggest scratch pad
+    auto desc = [](size_t elements) {
+        return std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, Shape{elements});
+    };
+    auto mem0 = entry0->scratchPad->createScratchPadMem(desc(1024));
+    auto mem1 = entry1->scratchPad->createScratchPadMem(desc(4096));
+    ASSERT_EQ(mem0->getData(), mem1->getData());
+    ASSERT_EQ(pool.getSize(), 4096u);
+
+    // the scratch pad is released with the last user
+    mem0.reset();
+    mem1.reset();
+    entry0.reset();
+    entry1.reset();
+    ASSERT_EQ(pool.getSize(), 0u);
+}
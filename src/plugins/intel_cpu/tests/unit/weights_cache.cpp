@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(WeightsSharingTest, ContentAddressedKeys) {
+    std::vector<float> weights0(64, 1.f);
+    std::vector<float> weights1(weights0);
+    const size_t size = weights0.size() * sizeof(float);
+    ASSERT_EQ(WeightsSharing::dataKey(weights0.data(), size), WeightsSharing::dataKey(weights1.data(), size));
+    // the data differing beyond the first bytes has different keys
+    weights1.back() = 2.f;
+    ASSERT_NE(WeightsSharing::dataKey(weights0.data(), size), WeightsSharing::dataKey(weights1.data(), size));
+
+    auto desc0 = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{8, 8});
+    auto desc1 = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{4, 16});
+    ASSERT_NE(WeightsSharing::descKey(desc0), WeightsSharing::descKey(desc1));
+}
+
+TEST(WeightsSharingTest, ReleasedEntries) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing cache;
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, Shape{1024});
+
+    std::vector<MemoryPtr> memories;
+    for (int i = 0; i < 128; i++) {
+        MemoryPtr memory = *cache.findOrCreate(std::to_string(i), [&]() {
+            return std::make_shared<Memory>(eng, desc);
+        });
+        // only the even entries stay in use
+        if (i % 2 == 0)
+            memories.push_back(memory);
+    }
+    ASSERT_EQ(cache.getSize(), memories.size() * 1024);
+
+    // the object is shared while in use and created again once released
+    MemoryPtr reused = *cache.findOrCreate("0", [&]() {
+        return std::make_shared<Memory>(eng, desc);
+    });
+    ASSERT_EQ(reused, memories.front());
+    memories.clear();
+    reused.reset();
+    ASSERT_EQ(cache.getSize(), 0u);
+}
+
+TEST(WeightsSharingTest, ContentCollision) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing cache;
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, Shape{64});
+    auto make = [&](uint8_t value) {
+        return [&eng, desc, value]() {
+            MemoryPtr memory = std::make_shared<Memory>(eng, desc);
+            std::memset(memory->getData(), value, memory->getSize());
+            return memory;
+        };
+    };
+
+    MemoryPtr memory0 = cache.findOrCreateByContent("key", make(1));
+    // the same content is shared
+    ASSERT_EQ(cache.findOrCreateByContent("key", make(1)), memory0);
+    // the different content under the same key gets its own memory, the cached one stays intact
+    MemoryPtr memory1 = cache.findOrCreateByContent("key", make(2));
+    ASSERT_NE(memory1, memory0);
+    ASSERT_EQ(memory1->getDataAs<uint8_t>()[0], 2);
+    ASSERT_EQ(memory0->getDataAs<uint8_t>()[0], 1);
+    ASSERT_EQ(cache.findOrCreateByContent("key", make(1)), memory0);
+}
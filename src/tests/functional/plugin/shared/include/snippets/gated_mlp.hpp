@@ -0,0 +1,35 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/base/snippets_test_utils.hpp"
+#include "subgraph_mlp.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        InputShape,                      // Input shape
+        size_t,                          // Hidden size (output channels of FullyConnected)
+        GatingActivation,                // Activation of the gate projection
+        size_t,                          // Expected num nodes
+        size_t,                          // Expected num subgraphs
+        std::string,                     // Target Device
+        ov::AnyMap                       // Config
+> GatedMLPParams;
+
+class GatedMLP : public testing::WithParamInterface<ov::test::snippets::GatedMLPParams>,
+                 virtual public ov::test::SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ov::test::snippets::GatedMLPParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,35 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/base/snippets_test_utils.hpp"
+#include "subgraph_norm.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        std::vector<InputShape>,         // Input shapes: the second one enables residual Add
+        NormType,                        // LayerNorm or RMSNorm
+        bool,                            // FakeQuantize on output
+        size_t,                          // Expected num nodes
+        size_t,                          // Expected num subgraphs
+        std::string,                     // Target Device
+        ov::AnyMap                       // Config
+> NormParams;
+
+class Norm : public testing::WithParamInterface<ov::test::snippets::NormParams>,
+             virtual public ov::test::SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ov::test::snippets::NormParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,70 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/gated_mlp.hpp"
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string GatedMLP::getTestCaseName(testing::TestParamInfo<ov::test::snippets::GatedMLPParams> obj) {
+    InputShape input_shape;
+    size_t hidden_size;
+    GatingActivation activation;
+    std::string targetDevice;
+    size_t num_nodes, num_subgraphs;
+    ov::AnyMap additionalConfig;
+    std::tie(input_shape, hidden_size, activation, num_nodes, num_subgraphs, targetDevice, additionalConfig) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << ov::test::utils::partialShape2str({input_shape.first}) << "_";
+    result << "TS=";
+    for (const auto& shape : input_shape.second) {
+        result << "(" << ov::test::utils::vec2str(shape) << ")_";
+    }
+    result << "Hidden=" << hidden_size << "_";
+    result << "Activation=" << activation << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+
+    if (!additionalConfig.empty()) {
+        result << "_PluginConf";
+        for (auto& item : additionalConfig) {
+            result << "_" << item.first << "=" << item.second.as<std::string>();
+        }
+    }
+    return result.str();
+}
+
+void GatedMLP::SetUp() {
+    InputShape input_shape;
+    size_t hidden_size;
+    GatingActivation activation;
+    ov::AnyMap additionalConfig;
+    std::tie(input_shape, hidden_size, activation, ref_num_nodes, ref_num_subgraphs, targetDevice, additionalConfig) =
+        this->GetParam();
+    init_input_shapes({input_shape});
+
+    auto f = ov::test::snippets::GatedMLPFunction(inputDynamicShapes, hidden_size, activation);
+    function = f.getOriginal();
+
+    configuration.insert(additionalConfig.begin(), additionalConfig.end());
+    if (!configuration.count("SNIPPETS_MODE")) {
+        configuration.insert({"SNIPPETS_MODE", "IGNORE_CALLBACK"});
+    }
+}
+
+TEST_P(GatedMLP, CompareWithRefImpl) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    validateNumSubgraphs();
+}
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,75 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/norm.hpp"
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string Norm::getTestCaseName(testing::TestParamInfo<ov::test::snippets::NormParams> obj) {
+    std::vector<InputShape> input_shapes;
+    NormType type;
+    bool with_fq;
+    std::string targetDevice;
+    size_t num_nodes, num_subgraphs;
+    ov::AnyMap additionalConfig;
+    std::tie(input_shapes, type, with_fq, num_nodes, num_subgraphs, targetDevice, additionalConfig) = obj.param;
+
+    std::ostringstream result;
+    for (size_t i = 0; i < input_shapes.size(); ++i) {
+        result << "IS[" << i << "]=" << ov::test::utils::partialShape2str({input_shapes[i].first}) << "_";
+        result << "TS[" << i << "]=";
+        for (const auto& shape : input_shapes[i].second) {
+            result << "(" << ov::test::utils::vec2str(shape) << ")_";
+        }
+    }
+    result << "Type=" << type << "_";
+    result << "FQ=" << with_fq << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+
+    if (!additionalConfig.empty()) {
+        result << "_PluginConf";
+        for (auto& item : additionalConfig) {
+            result << "_" << item.first << "=" << item.second.as<std::string>();
+        }
+    }
+    return result.str();
+}
+
+void Norm::SetUp() {
+    std::vector<InputShape> input_shapes;
+    NormType type;
+    bool with_fq;
+    ov::AnyMap additionalConfig;
+    std::tie(input_shapes, type, with_fq, ref_num_nodes, ref_num_subgraphs, targetDevice, additionalConfig) =
+        this->GetParam();
+    init_input_shapes(input_shapes);
+
+    auto f = ov::test::snippets::NormFunction(inputDynamicShapes, type, with_fq);
+    function = f.getOriginal();
+    // The quantized values may differ by one quantization step because of the different order of accumulation
+    if (with_fq)
+        abs_threshold = 0.05;
+
+    configuration.insert(additionalConfig.begin(), additionalConfig.end());
+    if (!configuration.count("SNIPPETS_MODE")) {
+        configuration.insert({"SNIPPETS_MODE", "IGNORE_CALLBACK"});
+    }
+}
+
+TEST_P(Norm, CompareWithRefImpl) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    validateNumSubgraphs();
+}
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,44 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "./snippets_helpers.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+enum class GatingActivation { None, Swish, Gelu };
+std::ostream &operator<<(std::ostream& os, const GatingActivation& type);
+
+/// Gated feed-forward block of LLM (SwiGLU, GeGLU): two FullyConnected with the same input and the transposed Constant weights.
+/// The output of the gate projection is activated and multiplied by the output of the up projection.
+//         in0
+//        /   \
+//  MatMul     MatMul
+//  (gate)      (up)
+//    |          |
+// [Activation]  |
+//        \     /
+//       Multiply
+//          |
+//        Result
+class GatedMLPFunction : public SnippetsFunctionBase {
+public:
+    explicit GatedMLPFunction(const std::vector<PartialShape>& inputShapes, size_t hidden_size, GatingActivation activation)
+        : SnippetsFunctionBase(inputShapes), hidden_size(hidden_size), activation(activation) {
+        OPENVINO_ASSERT(input_shapes.size() == 1, "Got invalid number of input shapes");
+        OPENVINO_ASSERT(input_shapes[0].is_static(), "GatedMLPFunction supports only static shapes");
+    }
+
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+
+    size_t hidden_size;
+    GatingActivation activation;
+};
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,49 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "./snippets_helpers.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+enum class NormType { LayerNorm, RMSNorm };
+std::ostream &operator<<(std::ostream& os, const NormType& type);
+
+/// Normalization block of transformer layer with optional residual connection and quantization.
+/// The second input shape enables the residual Add, the output of the residual Add is the second Result.
+/// LayerNorm is MVN over the last dimension, RMSNorm is x / Sqrt(ReduceMean(x ^ 2) + eps).
+// in0      [in1]
+//    \     /
+//    [Add]
+//      |
+//  LayerNorm / RMSNorm
+//      |
+//  Multiply (scale)
+//      |
+//    Add (bias)
+//      |
+// [FakeQuantize]
+//      |
+//    Result
+class NormFunction : public SnippetsFunctionBase {
+public:
+    explicit NormFunction(const std::vector<PartialShape>& inputShapes, NormType type, bool with_fq)
+        : SnippetsFunctionBase(inputShapes), type(type), with_fq(with_fq) {
+        OPENVINO_ASSERT(input_shapes.size() == 1 || input_shapes.size() == 2, "Got invalid number of input shapes");
+        OPENVINO_ASSERT(input_shapes[0].rank().is_static() && input_shapes[0].rbegin()->is_static(),
+                        "Normalized dimension must be static");
+    }
+
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+
+    NormType type;
+    bool with_fq;
+};
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_mlp.hpp"
+
+#include "common_test_utils/data_utils.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/swish.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::ostream &operator<<(std::ostream& os, const GatingActivation& type) {
+    switch (type) {
+        case GatingActivation::None:
+            return os << "None";
+        case GatingActivation::Swish:
+            return os << "Swish";
+        case GatingActivation::Gelu:
+            return os << "Gelu";
+        default:
+            OPENVINO_THROW("Unexpected GatingActivation.");
+    }
+}
+
+std::shared_ptr<ov::Model> GatedMLPFunction::initOriginal() const {
+    const auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    const auto in_size = static_cast<size_t>(input_shapes[0].rbegin()->get_length());
+
+    auto make_fc = [&](int seed) {
+        const auto weights_data = ov::test::utils::generate_float_numbers(hidden_size * in_size, -0.5f, 0.5f, seed);
+        const auto weights = op::v0::Constant::create(precision, {hidden_size, in_size}, weights_data);
+        return std::make_shared<op::v0::MatMul>(data, weights, false, true);
+    };
+
+    std::shared_ptr<ov::Node> gate = make_fc(1);
+    switch (activation) {
+        case GatingActivation::None:
+            break;
+        case GatingActivation::Swish:
+            gate = std::make_shared<op::v4::Swish>(gate);
+            break;
+        case GatingActivation::Gelu:
+            gate = std::make_shared<op::v7::Gelu>(gate);
+            break;
+        default:
+            OPENVINO_THROW("Unexpected GatingActivation.");
+    }
+    const auto multiply = std::make_shared<op::v1::Multiply>(gate, make_fc(2));
+    return std::make_shared<ov::Model>(ResultVector{std::make_shared<op::v0::Result>(multiply)}, ParameterVector{data});
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
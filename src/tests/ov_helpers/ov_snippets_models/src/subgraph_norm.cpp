@@ -0,0 +1,74 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_norm.hpp"
+
+#include "common_test_utils/data_utils.hpp"
+#include "common_test_utils/node_builders/fake_quantize.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/power.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/sqrt.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::ostream &operator<<(std::ostream& os, const NormType& type) {
+    switch (type) {
+        case NormType::LayerNorm:
+            return os << "LayerNorm";
+        case NormType::RMSNorm:
+            return os << "RMSNorm";
+        default:
+            OPENVINO_THROW("Unexpected NormType.");
+    }
+}
+
+std::shared_ptr<ov::Model> NormFunction::initOriginal() const {
+    ParameterVector params;
+    for (const auto& shape : input_shapes)
+        params.push_back(std::make_shared<op::v0::Parameter>(precision, shape));
+
+    std::shared_ptr<ov::Node> data = params[0];
+    if (params.size() == 2)
+        data = std::make_shared<op::v1::Add>(params[0], params[1]);
+
+    const auto axes = op::v0::Constant::create(element::i64, {1}, {-1});
+    std::shared_ptr<ov::Node> norm = nullptr;
+    switch (type) {
+        case NormType::LayerNorm:
+            norm = std::make_shared<op::v6::MVN>(data, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+            break;
+        case NormType::RMSNorm: {
+            const auto sqr = std::make_shared<op::v1::Power>(data, op::v0::Constant::create(precision, {}, {2.f}));
+            const auto mean = std::make_shared<op::v1::ReduceMean>(sqr, axes, true);
+            const auto add_eps = std::make_shared<op::v1::Add>(mean, op::v0::Constant::create(precision, {}, {1e-6f}));
+            norm = std::make_shared<op::v1::Divide>(data, std::make_shared<op::v0::Sqrt>(add_eps));
+            break;
+        }
+        default:
+            OPENVINO_THROW("Unexpected NormType.");
+    }
+
+    const auto hidden = static_cast<size_t>(input_shapes[0].rbegin()->get_length());
+    const auto scale_data = ov::test::utils::generate_float_numbers(hidden, 0.5f, 1.5f);
+    const auto bias_data = ov::test::utils::generate_float_numbers(hidden, -1.f, 1.f);
+    const auto scale = std::make_shared<op::v1::Multiply>(norm, op::v0::Constant::create(precision, {hidden}, scale_data));
+    std::shared_ptr<ov::Node> result = std::make_shared<op::v1::Add>(scale, op::v0::Constant::create(precision, {hidden}, bias_data));
+    if (with_fq)
+        result = ov::test::utils::make_fake_quantize(result, precision, 256, {1}, {-5.f}, {5.f}, {-5.f}, {5.f});
+
+    ResultVector results{std::make_shared<op::v0::Result>(result)};
+    if (params.size() == 2)
+        results.push_back(std::make_shared<op::v0::Result>(data));
+    return std::make_shared<ov::Model>(results, params);
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov